@@ -0,0 +1,271 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "HeadlessContext.h"
+
+#include "src/Utilities/OperationNotifier.h"
+#include "externals/OpenGLLoader/gl_core_3_3.h"
+
+#include <EGL/eglext.h>
+
+#include <cstring>
+#include <vector>
+
+namespace eyegui
+{
+    HeadlessContext::HeadlessContext(int width, int height, HeadlessDevice device)
+    {
+        mDisplay = EGL_NO_DISPLAY;
+        mContext = EGL_NO_CONTEXT;
+        mValid = false;
+        mFramebuffer = 0;
+        mColorRenderbuffer = 0;
+        mWidth = width;
+        mHeight = height;
+
+        // Software rasterizer needs no GPU
+        if (device == HeadlessDevice::SOFTWARE)
+        {
+            mDisplay = getSoftwareDisplay();
+            if (mDisplay == EGL_NO_DISPLAY || !eglInitialize(mDisplay, NULL, NULL))
+            {
+                mDisplay = EGL_NO_DISPLAY;
+                throwWarning(OperationNotifier::Operation::RUNTIME, "Software device for headless rendering not available, using any device");
+            }
+        }
+
+        // Surfaceless platform needs neither window system nor specific device
+        if (mDisplay == EGL_NO_DISPLAY)
+        {
+            PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+                (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+            if (getPlatformDisplay != NULL)
+            {
+                mDisplay = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+            }
+            if (mDisplay == EGL_NO_DISPLAY || !eglInitialize(mDisplay, NULL, NULL))
+            {
+                mDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+                if (mDisplay == EGL_NO_DISPLAY || !eglInitialize(mDisplay, NULL, NULL))
+                {
+                    throwError(OperationNotifier::Operation::RUNTIME, "Could not initialize EGL display for headless rendering");
+                    return;
+                }
+            }
+        }
+
+        // Choose any config for desktop OpenGL
+        EGLint configAttributes[] =
+        {
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_NONE
+        };
+        EGLConfig config = NULL;
+        EGLint configCount = 0;
+        eglChooseConfig(mDisplay, configAttributes, &config, 1, &configCount);
+
+        // Create OpenGL 3.3 core context
+        eglBindAPI(EGL_OPENGL_API);
+        EGLint contextAttributes[] =
+        {
+            EGL_CONTEXT_MAJOR_VERSION, 3,
+            EGL_CONTEXT_MINOR_VERSION, 3,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+        mContext = eglCreateContext(mDisplay, configCount > 0 ? config : NULL, EGL_NO_CONTEXT, contextAttributes);
+        if (mContext == EGL_NO_CONTEXT)
+        {
+            throwError(OperationNotifier::Operation::RUNTIME, "Could not create OpenGL 3.3 core context for headless rendering");
+            return;
+        }
+
+        // Make current without surface
+        if (!eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, mContext))
+        {
+            throwError(OperationNotifier::Operation::RUNTIME, "Could not make OpenGL context for headless rendering current");
+            return;
+        }
+
+        // Load functions
+        if (ogl_LoadFunctions() == ogl_LOAD_FAILED)
+        {
+            throwError(OperationNotifier::Operation::RUNTIME, "Could not load OpenGL functions for headless rendering");
+            return;
+        }
+
+        // There is no default framebuffer, so create one
+        createFramebuffer(width, height);
+        mValid = true;
+    }
+
+    HeadlessContext::~HeadlessContext()
+    {
+        if (mValid)
+        {
+            deleteFramebuffer();
+        }
+        if (mContext != EGL_NO_CONTEXT)
+        {
+            eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            eglDestroyContext(mDisplay, mContext);
+        }
+        if (mDisplay != EGL_NO_DISPLAY)
+        {
+            eglTerminate(mDisplay);
+        }
+    }
+
+    bool HeadlessContext::isValid() const
+    {
+        return mValid;
+    }
+
+    void HeadlessContext::resize(int width, int height)
+    {
+        if (!mValid)
+        {
+            return;
+        }
+
+        deleteFramebuffer();
+        createFramebuffer(width, height);
+        mWidth = width;
+        mHeight = height;
+    }
+
+    void HeadlessContext::clear()
+    {
+        glClearColor(0, 0, 0, 1);
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+
+    void HeadlessContext::clear(const std::vector<DamageRect>& rRects)
+    {
+        // Rects start at top, OpenGL at bottom
+        glClearColor(0, 0, 0, 1);
+        glEnable(GL_SCISSOR_TEST);
+        for (const DamageRect& rRect : rRects)
+        {
+            glScissor(rRect.x, mHeight - rRect.y - rRect.height, rRect.width, rRect.height);
+            glClear(GL_COLOR_BUFFER_BIT);
+        }
+        glDisable(GL_SCISSOR_TEST);
+    }
+
+    void HeadlessContext::finish()
+    {
+        glFinish();
+    }
+
+    void HeadlessContext::read(FrameCapture& rCapture) const
+    {
+        if (!mValid)
+        {
+            return;
+        }
+
+        // Read bottom row first and flip afterwards
+        int rowSize = mWidth * 4;
+        std::vector<unsigned char> pixels(rowSize * mHeight);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, mFramebuffer);
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        glReadPixels(0, 0, mWidth, mHeight, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+        rCapture.width = mWidth;
+        rCapture.height = mHeight;
+        rCapture.pixels.resize(pixels.size());
+        for (int y = 0; y < mHeight; y++)
+        {
+            std::memcpy(
+                rCapture.pixels.data() + y * rowSize,
+                pixels.data() + (mHeight - 1 - y) * rowSize,
+                rowSize);
+        }
+    }
+
+    std::string HeadlessContext::getRenderer() const
+    {
+        if (!mValid)
+        {
+            return "";
+        }
+        return std::string((const char*)glGetString(GL_RENDERER));
+    }
+
+    int HeadlessContext::getWidth() const
+    {
+        return mWidth;
+    }
+
+    int HeadlessContext::getHeight() const
+    {
+        return mHeight;
+    }
+
+    EGLDisplay HeadlessContext::getSoftwareDisplay() const
+    {
+        // Enumeration of devices is an extension
+        PFNEGLQUERYDEVICESEXTPROC queryDevices =
+            (PFNEGLQUERYDEVICESEXTPROC)eglGetProcAddress("eglQueryDevicesEXT");
+        PFNEGLQUERYDEVICESTRINGEXTPROC queryDeviceString =
+            (PFNEGLQUERYDEVICESTRINGEXTPROC)eglGetProcAddress("eglQueryDeviceStringEXT");
+        PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+            (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if (queryDevices == NULL || queryDeviceString == NULL || getPlatformDisplay == NULL)
+        {
+            return EGL_NO_DISPLAY;
+        }
+
+        // Go over devices
+        EGLint deviceCount = 0;
+        if (!queryDevices(0, NULL, &deviceCount) || deviceCount <= 0)
+        {
+            return EGL_NO_DISPLAY;
+        }
+        std::vector<EGLDeviceEXT> devices(deviceCount);
+        queryDevices(deviceCount, devices.data(), &deviceCount);
+        for (EGLint i = 0; i < deviceCount; i++)
+        {
+            // Software device of Mesa announces itself by extension
+            const char* pExtensions = queryDeviceString(devices[i], EGL_EXTENSIONS);
+            if (pExtensions != NULL && std::strstr(pExtensions, "EGL_MESA_device_software") != NULL)
+            {
+                return getPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, devices[i], NULL);
+            }
+        }
+
+        return EGL_NO_DISPLAY;
+    }
+
+    void HeadlessContext::createFramebuffer(int width, int height)
+    {
+        glGenRenderbuffers(1, &mColorRenderbuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, mColorRenderbuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+
+        glGenFramebuffers(1, &mFramebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, mColorRenderbuffer);
+
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            throwError(OperationNotifier::Operation::RUNTIME, "Offscreen framebuffer for headless rendering not complete");
+        }
+
+        glViewport(0, 0, width, height);
+    }
+
+    void HeadlessContext::deleteFramebuffer()
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &mFramebuffer);
+        glDeleteRenderbuffers(1, &mColorRenderbuffer);
+        mFramebuffer = 0;
+        mColorRenderbuffer = 0;
+    }
+}
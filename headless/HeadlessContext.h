@@ -0,0 +1,82 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// OpenGL 3.3 core context without window, created with EGL. Software device
+// is the software rasterizer of Mesa (llvmpipe or softpipe), which needs no
+// GPU. Otherwise the surfaceless platform or the default display is used.
+// Renders into an offscreen framebuffer, which stays bound while the context
+// exists, since there is no default framebuffer.
+
+#ifndef HEADLESS_CONTEXT_H_
+#define HEADLESS_CONTEXT_H_
+
+#include "include/eyeGUIHeadless.h"
+
+#include <EGL/egl.h>
+
+#include <string>
+#include <vector>
+
+namespace eyegui
+{
+    class HeadlessContext
+    {
+    public:
+
+        // Constructor
+        HeadlessContext(int width, int height, HeadlessDevice device);
+
+        // Destructor
+        virtual ~HeadlessContext();
+
+        // Whether context could be created
+        bool isValid() const;
+
+        // Resize offscreen framebuffer
+        void resize(int width, int height);
+
+        // Clear offscreen framebuffer
+        void clear();
+
+        // Clear areas of offscreen framebuffer
+        void clear(const std::vector<DamageRect>& rRects);
+
+        // Wait until all OpenGL commands are executed
+        void finish();
+
+        // Read pixels of offscreen framebuffer with top row first
+        void read(FrameCapture& rCapture) const;
+
+        // Name of renderer
+        std::string getRenderer() const;
+
+        // Getter for size of offscreen framebuffer
+        int getWidth() const;
+        int getHeight() const;
+
+    private:
+
+        // Try to get display of software device
+        EGLDisplay getSoftwareDisplay() const;
+
+        // Create offscreen framebuffer with given size
+        void createFramebuffer(int width, int height);
+
+        // Delete offscreen framebuffer
+        void deleteFramebuffer();
+
+        // Members
+        EGLDisplay mDisplay;
+        EGLContext mContext;
+        bool mValid;
+        unsigned int mFramebuffer;
+        unsigned int mColorRenderbuffer;
+        int mWidth;
+        int mHeight;
+    };
+}
+
+#endif // HEADLESS_CONTEXT_H_
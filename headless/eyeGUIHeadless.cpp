@@ -0,0 +1,58 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "include/eyeGUIHeadless.h"
+
+#include "HeadlessContext.h"
+
+namespace eyegui
+{
+    HeadlessContext* createHeadlessContext(int width, int height, HeadlessDevice device)
+    {
+        return new HeadlessContext(width, height, device);
+    }
+
+    bool isHeadlessContextValid(HeadlessContext const * pContext)
+    {
+        return pContext->isValid();
+    }
+
+    void resizeHeadlessContext(HeadlessContext* pContext, int width, int height)
+    {
+        pContext->resize(width, height);
+    }
+
+    void clearHeadlessContext(HeadlessContext* pContext)
+    {
+        pContext->clear();
+    }
+
+    void clearHeadlessContext(HeadlessContext* pContext, const std::vector<DamageRect>& rRects)
+    {
+        pContext->clear(rRects);
+    }
+
+    void finishHeadlessContext(HeadlessContext* pContext)
+    {
+        pContext->finish();
+    }
+
+    void readHeadlessContext(HeadlessContext const * pContext, FrameCapture& rCapture)
+    {
+        pContext->read(rCapture);
+    }
+
+    std::string getRendererOfHeadlessContext(HeadlessContext const * pContext)
+    {
+        return pContext->getRenderer();
+    }
+
+    void terminateHeadlessContext(HeadlessContext* pContext)
+    {
+        delete pContext;
+    }
+}
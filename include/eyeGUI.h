@@ -34,6 +34,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
 
 namespace eyegui
 {
@@ -59,6 +60,9 @@ namespace eyegui
     //! Enumeration of cases of keyboard.
     enum class KeyboardCase { LOWER, UPPER };
 
+    //! Enumeration of profiled phases. Phases may be nested, e.g. text meshing is part of element update.
+    enum class ProfilePhase { UPDATE, JOBS, NOTIFICATIONS, RESIZING, ELEMENT_UPDATE, TEXT_MESHING, FONT_ATLAS, DRAW, LAYOUT_DRAW_GPU };
+
     //! Abstract listener class for buttons.
     class ButtonListener
     {
@@ -138,6 +142,41 @@ namespace eyegui
         \param value is the string given by pressed key.
         */
         void virtual keyPressed(Layout* pLayout, std::string id, std::string value) = 0;
+
+        //! Callback for new suggestions of words. Only called when keyboard has a dictionary. Does nothing by default.
+        /*!
+        \param pLayout pointer to layout from which callback is coming.
+        \param id is the unique id of the keyboard which causes the callback.
+        \param suggestions are u16strings of words completing the typed word, most frequent first.
+        */
+        void virtual wordsSuggested(Layout* pLayout, std::string id, std::vector<std::u16string> suggestions);
+
+        //! Callback for new suggestions of words. Only called when keyboard has a dictionary. Does nothing by default.
+        /*!
+        \param pLayout pointer to layout from which callback is coming.
+        \param id is the unique id of the keyboard which causes the callback.
+        \param suggestions are strings of words completing the typed word, most frequent first.
+        */
+        void virtual wordsSuggested(Layout* pLayout, std::string id, std::vector<std::string> suggestions);
+    };
+
+    //! Abstract listener class for asynchronous loading.
+    class LoadingListener
+    {
+    public:
+
+        //! Constructor.
+        LoadingListener();
+
+        //! Destructor.
+        virtual ~LoadingListener() = 0;
+
+        //! Callback for finished loading, called by update.
+        /*!
+        \param pLayout pointer to added layout or layout of added floating frame. Null if layout of floating frame was removed before.
+        \param frameIndex is index of added floating frame. Minus one for layouts.
+        */
+        void virtual loaded(Layout* pLayout, int frameIndex) = 0;
     };
 
     //! Struct for relative values of position and size
@@ -167,6 +206,40 @@ namespace eyegui
         bool instantInteraction = false; //!< Instant interaction with element beneath gaze
     };
 
+    //! Struct for statistics of profiled phase over recent frames
+    struct ProfileStatistics
+    {
+        float minimum = 0; //!< Minimal time per frame in milliseconds
+        float mean = 0; //!< Mean time per frame in milliseconds
+        float p99 = 0; //!< 99th percentile of time per frame in milliseconds
+        unsigned int frameCount = 0; //!< Count of frames used for statistics
+    };
+
+    //! Struct for pixels of captured frame
+    struct FrameCapture
+    {
+        int width = 0; //!< Width of frame in pixels
+        int height = 0; //!< Height of frame in pixels
+        std::vector<unsigned char> pixels; //!< RGBA with one byte per channel, first row is top of frame. Alpha is always opaque, since alpha of screen depends on blending and is not captured
+    };
+
+    //! Struct for area of GUI, which has changed since last drawing
+    struct DamageRect
+    {
+        int x = 0; //!< Position of upper left corner in pixels
+        int y = 0; //!< Position of upper left corner in pixels
+        int width = 0; //!< Width in pixels
+        int height = 0; //!< Height in pixels
+    };
+
+    //! Struct for state of asynchronous loading, filled by update
+    struct AsyncLoading
+    {
+        bool done = false; //!< Indicates whether loading is finished
+        Layout* pLayout = NULL; //!< Added layout or layout of added floating frame. Null if layout of floating frame was removed before
+        int frameIndex = -1; //!< Index of added floating frame, minus one for layouts
+    };
+
     //! Builder for GUI
     class GUIBuilder
     {
@@ -182,6 +255,7 @@ namespace eyegui
         float fontTallSize = 0.1f; //!< Height of tall font in percentage of GUI height
         float fontMediumSize = 0.04f; //!< Height of medium font in percentage of GUI height
         float fontSmallSize = 0.0175f; //!< Height of small font in percentage of GUI height
+        std::string recordingFilepath = ""; //!< recordingFilepath is path to binary log of input and calls for replay, empty for no recording
     };
 
     //! Creates layout inside GUI and returns pointer to it. Is executed at update call.
@@ -200,6 +274,20 @@ namespace eyegui
     */
     void removeLayout(GUI* pGUI, Layout const * pLayout);
 
+    //! Creates layout inside GUI without waiting for files. Files are read and images decoded on loading thread, elements and textures are all created by one of the following update calls. Errors of reading are reported by that update call.
+    /*!
+      \param pGUI pointer to GUI.
+      \param filepath is path to layout xml file.
+      \param visible shall added layout be visible.
+      \param wpListener is listener told about added layout.
+      \return state of loading, which contains pointer to layout when done.
+    */
+    std::shared_ptr<const AsyncLoading> addLayoutAsync(
+        GUI* pGUI,
+        std::string filepath,
+        bool visible = true,
+        std::weak_ptr<LoadingListener> wpListener = std::weak_ptr<LoadingListener>());
+
     //! Update whole GUI.
     /*!
       \param pGUI pointer to GUI.
@@ -209,6 +297,15 @@ namespace eyegui
     */
     Input updateGUI(GUI* pGUI, float tpf, const Input input);
 
+    //! Push timestamped gaze sample of eye tracker. Lock-free, may be called by one thread of eye tracker. Samples are consumed at update, latest one replaces gaze of input. Thresholds of buttons, sensors and keyboards accumulate over every sample.
+    /*!
+      \param pGUI pointer to GUI.
+      \param gazeX is x coordinate of gaze in pixels.
+      \param gazeY is y coordinate of gaze in pixels.
+      \param timestamp of sample in seconds. Must increase with each sample.
+    */
+    void pushGazeSample(GUI* pGUI, float gazeX, float gazeY, double timestamp);
+
     //! Draw whole GUI.
     /*!
     \param pGUI pointer to GUI.
@@ -236,6 +333,13 @@ namespace eyegui
     */
     void loadConfig(GUI* pGUI, std::string filepath);
 
+    //! Switch localization without waiting for file. File is parsed on loading thread and replaces current localization at one of the following update calls. Afterwards, text blocks whose key resolves to different content are changed, a limited count per update call. Errors of parsing are reported by the update call, which keeps the current localization then.
+    /*!
+      \param pGUI pointer to GUI.
+      \param filepath is path to localization file.
+    */
+    void switchLocalization(GUI* pGUI, std::string filepath);
+
     //! Set gaze visualization drawing.
     /*!
       \param pGUI pointer to GUI.
@@ -256,6 +360,106 @@ namespace eyegui
     */
     void prefetchImage(GUI* pGUI, std::string filepath);
 
+    //! Forget loaded brick, so changes of its file are used by the next instantiation.
+    /*!
+      \param pGUI pointer to GUI.
+      \param filepath is path to brick file which was changed.
+    */
+    void invalidateBrick(GUI* pGUI, std::string filepath);
+
+    //! Forget all loaded bricks, so changes of their files are used by the next instantiations.
+    /*!
+      \param pGUI pointer to GUI.
+    */
+    void invalidateAllBricks(GUI* pGUI);
+
+    //! Forget parsed stylesheet, so changes of its file are used by layouts added afterwards. Layouts already added keep their styles.
+    /*!
+      \param pGUI pointer to GUI.
+      \param filepath is path to stylesheet file which was changed.
+    */
+    void invalidateStylesheet(GUI* pGUI, std::string filepath);
+
+    //! Forget all parsed stylesheets, so changes of their files are used by layouts added afterwards. Layouts already added keep their styles.
+    /*!
+      \param pGUI pointer to GUI.
+    */
+    void invalidateAllStylesheets(GUI* pGUI);
+
+    //! Enable or disable frame profiler. Has no effect if profiler was not compiled into library.
+    /*!
+      \param pGUI pointer to GUI.
+      \param enabled indicates whether phases of update and draw should be timed.
+      \param gpuTiming indicates whether drawing of each layout should be measured by OpenGL timer queries.
+    */
+    void setProfiling(GUI* pGUI, bool enabled, bool gpuTiming = false);
+
+    //! Get statistics of phase over recent frames.
+    /*!
+      \param pGUI pointer to GUI.
+      \param phase of which statistics are returned.
+      \return statistics of phase. All values are zero if no frame was profiled.
+    */
+    ProfileStatistics getProfileStatistics(GUI const * pGUI, ProfilePhase phase);
+
+    //! Draw GUI into offscreen framebuffer and read pixels back. Call it after update, instead of or in addition to draw.
+    /*!
+      \param pGUI pointer to GUI.
+      \param rCapture is filled with pixels of captured frame.
+      \param wait indicates whether to wait for readback of this frame. Otherwise readback is asynchronous and the newest completed capture of previous calls is returned, which avoids stalling the pipeline.
+      \return true if capture was filled.
+    */
+    bool captureFrame(GUI* pGUI, FrameCapture& rCapture, bool wait = true);
+
+    //! Enable or disable caching of static elements in layers. Elements without interaction, which have not changed for some frames, are drawn once into a texture per frame and composed from there afterwards. Disabled by default.
+    /*!
+      \param pGUI pointer to GUI.
+      \param enabled indicates whether static elements should be cached.
+    */
+    void setLayerCaching(GUI* pGUI, bool enabled);
+
+    //! Get count of elements, which are drawn from layers instead of being drawn themselves.
+    /*!
+      \param pGUI pointer to GUI.
+      \return count of elements served from layers in the current frame.
+    */
+    unsigned int getCountOfCachedElements(GUI const * pGUI);
+
+    //! Check whether anything has changed since last drawing. If not, application may skip drawing and swapping of buffers.
+    /*!
+      \param pGUI pointer to GUI.
+      \return true if GUI has to be drawn again.
+    */
+    bool needsRedraw(GUI const * pGUI);
+
+    //! Get areas, which have changed since last drawing. Overlapping areas are merged. With partial redraw, application has to restore its own background within these areas before drawing.
+    /*!
+      \param pGUI pointer to GUI.
+      \return areas in pixels, empty if nothing has changed.
+    */
+    std::vector<DamageRect> getDamageRects(GUI const * pGUI);
+
+    //! Enable or disable partial redraw. Drawing is then restricted to areas, which have changed since last drawing. Application has to preserve content of framebuffer between frames, for example by copying back buffer or using a preserving swap behavior. Before drawing, it has to restore its own background within every area from getDamageRects, for example by clearing them, since translucent elements would be blended over their previous pixels otherwise. Disabled by default.
+    /*!
+      \param pGUI pointer to GUI.
+      \param enabled indicates whether only changed areas should be drawn.
+    */
+    void setPartialRedraw(GUI* pGUI, bool enabled);
+
+    //! Enable or disable render snapshots, so update can run on other thread than drawing. Update then records drawing into snapshot, which is drawn by next drawing while update already works on next frame. Updating thread needs current OpenGL context sharing objects with context of drawing. All other calls have to be made by updating thread, except drawing, needsRedraw and getDamageRects, which tell about snapshot not drawn yet. Frame capture must not run at the same time as updating, termination has to be done by drawing thread and profiling measures no GPU time. Disabled by default.
+    /*!
+      \param pGUI pointer to GUI.
+      \param enabled indicates whether update records snapshots for drawing.
+    */
+    void setRenderSnapshots(GUI* pGUI, bool enabled);
+
+    //! Enable or disable parallel update. Elements of all frames in all layouts are then updated on worker threads. Before, gaze is given to the foremost frame with an element beneath it, using the positions of the elements from the last update. Notifications are still processed by the thread calling update, but the order of notifications from different frames of one layout is not determined. Disabled by default.
+    /*!
+      \param pGUI pointer to GUI.
+      \param enabled indicates whether frames are updated in parallel.
+    */
+    void setParallelUpdate(GUI* pGUI, bool enabled);
+
     //! Sets value of config attribute. Is executed at update call.
     /*!
     \param pLayout pointer to layout.
@@ -571,6 +775,70 @@ namespace eyegui
     */
     void setKeyOfTextBlock(Layout* pLayout, std::string id, std::string key);
 
+    //! Set content of text edit. Cursor is placed at end of content.
+    /*!
+    \param pLayout pointer to layout.
+    \param id is the unique id of an element.
+    \param content is new content for text edit as 16 bit string.
+    */
+    void setContentOfTextEdit(Layout* pLayout, std::string id, std::u16string content);
+
+    //! Set content of text edit. Cursor is placed at end of content.
+    /*!
+    \param pLayout pointer to layout.
+    \param id is the unique id of an element.
+    \param content is new content for text edit as 8 bit string.
+    */
+    void setContentOfTextEdit(Layout* pLayout, std::string id, std::string content);
+
+    //! Get content of text edit.
+    /*!
+    \param pLayout pointer to layout.
+    \param id is the unique id of an element.
+    \return content of text edit as 16 bit string. Empty if text edit not found.
+    */
+    std::u16string getContentOfTextEdit(Layout const * pLayout, std::string id);
+
+    //! Add content at cursor of text edit. Only edited lines are laid out again.
+    /*!
+    \param pLayout pointer to layout.
+    \param id is the unique id of an element.
+    \param content is inserted in front of cursor as 16 bit string.
+    */
+    void addContentAtCursorInTextEdit(Layout* pLayout, std::string id, std::u16string content);
+
+    //! Add content at cursor of text edit. Only edited lines are laid out again.
+    /*!
+    \param pLayout pointer to layout.
+    \param id is the unique id of an element.
+    \param content is inserted in front of cursor as 8 bit string.
+    */
+    void addContentAtCursorInTextEdit(Layout* pLayout, std::string id, std::string content);
+
+    //! Delete content at cursor of text edit.
+    /*!
+    \param pLayout pointer to layout.
+    \param id is the unique id of an element.
+    \param letterCount is count of deleted letters behind cursor. Negative count deletes letters in front of cursor, like backspace.
+    */
+    void deleteContentAtCursorInTextEdit(Layout* pLayout, std::string id, int letterCount);
+
+    //! Move cursor of text edit over letters.
+    /*!
+    \param pLayout pointer to layout.
+    \param id is the unique id of an element.
+    \param letterCount is count of letters to move over. Negative count moves towards beginning.
+    */
+    void moveCursorOverLettersInTextEdit(Layout* pLayout, std::string id, int letterCount);
+
+    //! Move cursor of text edit over displayed lines. Text is scrolled to keep cursor visible.
+    /*!
+    \param pLayout pointer to layout.
+    \param id is the unique id of an element.
+    \param lineCount is count of lines to move over. Negative count moves upwards.
+    */
+    void moveCursorOverLinesInTextEdit(Layout* pLayout, std::string id, int lineCount);
+
     //! Set fast typing for keyboard.
     /*!
     \param pLayout pointer to layout.
@@ -603,6 +871,30 @@ namespace eyegui
     */
     void setKeymapOfKeyboard(Layout* pLayout, std::string id, unsigned int keymapIndex);
 
+    //! Set dictionary of keyboard. Words completing the typed word are suggested to the listeners of the keyboard. Dictionary is loaded by a background thread and shared by all keyboards using it.
+    /*!
+    \param pLayout pointer to layout.
+    \param id is the unique id of an element.
+    \param filepath is path to dictionary file with one word per line, optionally followed by its frequency. Empty path removes dictionary.
+    */
+    void setDictionaryOfKeyboard(Layout* pLayout, std::string id, std::string filepath);
+
+    //! Set word which is completed by suggestions of keyboard, e.g. after the user has deleted characters.
+    /*!
+    \param pLayout pointer to layout.
+    \param id is the unique id of an element.
+    \param word is typed word as 16 bit string.
+    */
+    void setWordOfKeyboard(Layout* pLayout, std::string id, std::u16string word);
+
+    //! Set word which is completed by suggestions of keyboard, e.g. after the user has deleted characters.
+    /*!
+    \param pLayout pointer to layout.
+    \param id is the unique id of an element.
+    \param word is typed word as 8 bit string.
+    */
+    void setWordOfKeyboard(Layout* pLayout, std::string id, std::string word);
+
     //! Register listener to button.
     /*!
       \param pLayout pointer to layout.
@@ -829,6 +1121,34 @@ namespace eyegui
         bool visible = true,
         bool fade = false);
 
+    //! Creates floating frame with brick inside without waiting for files. Files are read and images decoded on loading thread, elements and textures are all created by one of the following update calls. Errors of reading are reported by that update call.
+    /*!
+    \param pGUI pointer to GUI.
+    \param pLayout pointer to layout.
+    \param filepath is path to brick xml file.
+    \param relativePositionX initial relative x position.
+    \param relativePositionY initial relative y position.
+    \param relativeSizeX initial relative x size.
+    \param relativeSizeY initial relative y size.
+    \param idMapper changes ids inside brick to ones in map.
+    \param visible indicates, whether frame should be visible or not.
+    \param fade indicates, whether frame should fade in.
+    \param wpListener is listener told about added floating frame.
+    \return state of loading, which contains index of floating frame when done.
+    */
+    std::shared_ptr<const AsyncLoading> addFloatingFrameWithBrickAsync(
+        GUI* pGUI,
+        Layout* pLayout,
+        std::string filepath,
+        float relativePositionX,
+        float relativePositionY,
+        float relativeSizeX,
+        float relativeSizeY,
+        std::map<std::string, std::string> idMapper = std::map<std::string, std::string>(),
+        bool visible = true,
+        bool fade = false,
+        std::weak_ptr<LoadingListener> wpListener = std::weak_ptr<LoadingListener>());
+
     //! Set visibility of floating frame.
     /*!
       \param pLayout pointer to layout.
@@ -953,6 +1273,19 @@ namespace eyegui
     */
     void setWarningCallback(void(*pCallbackFunction)(std::string));
 
+    //! Enable or disable tracing of internal events. Enabling discards previously traced events. Has no effect if tracing was not compiled into library.
+    /*!
+      \param enabled indicates whether spans of internal events should be traced.
+    */
+    void setTracing(bool enabled);
+
+    //! Write traced events in JSON format of chrome://tracing and Perfetto.
+    /*!
+      \param filepath is path to written file. Not relative to root filepath.
+      \return true if file could be written.
+    */
+    bool writeTrace(std::string filepath);
+
     //! Return string describing the version of the linked library.
     /*!
       \return version given as string.
@@ -964,6 +1297,20 @@ namespace eyegui
       \param rootFilepath is used as prefix for used filepaths.
     */
     void setRootFilepath(std::string rootFilepath);
+
+    //! Set whether compiled layouts, bricks and stylesheets are saved next to their source files.
+    /*!
+      \param enabled indicates whether compiled files are saved while loading. Existing compiled files
+             are used anyway, as long as they were compiled from the current content of the source file.
+    */
+    void setCompiledCaching(bool enabled);
+
+    //! Compile layout, brick or stylesheet file and save the result next to it.
+    /*!
+      \param filepath is path to layout, brick or stylesheet file.
+      \return true if file could be compiled without errors and saved.
+    */
+    bool compileFile(std::string filepath);
 }
 
 #endif // EYE_GUI_H_
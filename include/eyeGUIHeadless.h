@@ -0,0 +1,110 @@
+//	The MIT License (MIT)
+//
+//	Copyright(c) 2016 Raphael Menges
+//
+//	Permission is hereby granted, free of charge, to any person obtaining a copy
+//	of this software and associated documentation files(the "Software"), to deal
+//	in the Software without restriction, including without limitation the rights
+//	to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+//	copies of the Software, and to permit persons to whom the Software is
+//	furnished to do so, subject to the following conditions :
+//
+//	The above copyright notice and this permission notice shall be included in all
+//	copies or substantial portions of the Software.
+//
+//	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//	SOFTWARE.
+
+/*!
+ *  \brief     Optional interface for headless rendering of eyeGUI.
+ *  \details   This interface creates an OpenGL context without window, which renders into an offscreen framebuffer. It is only available if the eyeGUIHeadless library was built (requires EGL).
+ *  \author    Raphael Menges
+ *  \version   0.8
+ *  \license   This project is released under the MIT License (MIT)
+ */
+
+#ifndef EYE_GUI_HEADLESS_H_
+#define EYE_GUI_HEADLESS_H_
+
+#include "eyeGUI.h"
+
+#include <string>
+#include <vector>
+
+namespace eyegui
+{
+    class HeadlessContext;
+
+    //! Enumeration of devices for headless rendering. Software uses the rasterizer of Mesa on the CPU and needs no GPU.
+    enum class HeadlessDevice { SOFTWARE, ANY };
+
+    //! Create headless context, which is current afterwards. Create it before constructing the GUI.
+    /*!
+      \param width of offscreen framebuffer in pixels.
+      \param height of offscreen framebuffer in pixels.
+      \param device which should be used. Falls back to any device if software rasterizer is not available.
+      \return pointer to created headless context. Check validity before usage.
+    */
+    HeadlessContext* createHeadlessContext(int width, int height, HeadlessDevice device = HeadlessDevice::SOFTWARE);
+
+    //! Check whether headless context could be created.
+    /*!
+      \param pContext pointer to headless context.
+      \return true if context is usable.
+    */
+    bool isHeadlessContextValid(HeadlessContext const * pContext);
+
+    //! Resize offscreen framebuffer. Resize the GUI accordingly.
+    /*!
+      \param pContext pointer to headless context.
+      \param width of offscreen framebuffer in pixels.
+      \param height of offscreen framebuffer in pixels.
+    */
+    void resizeHeadlessContext(HeadlessContext* pContext, int width, int height);
+
+    //! Clear offscreen framebuffer, call it before drawing the GUI.
+    /*!
+      \param pContext pointer to headless context.
+    */
+    void clearHeadlessContext(HeadlessContext* pContext);
+
+    //! Clear given areas of offscreen framebuffer, which restores background for partial redraw. Call it with the damage rects of the GUI before drawing.
+    /*!
+      \param pContext pointer to headless context.
+      \param rRects areas in pixels, like the ones from getDamageRects.
+    */
+    void clearHeadlessContext(HeadlessContext* pContext, const std::vector<DamageRect>& rRects);
+
+    //! Wait until all drawing is executed.
+    /*!
+      \param pContext pointer to headless context.
+    */
+    void finishHeadlessContext(HeadlessContext* pContext);
+
+    //! Read pixels of offscreen framebuffer, which contains what was drawn into it since the last clearing.
+    /*!
+      \param pContext pointer to headless context.
+      \param rCapture reference to capture, which is filled with pixels of framebuffer. Alpha is not changed to opaque.
+    */
+    void readHeadlessContext(HeadlessContext const * pContext, FrameCapture& rCapture);
+
+    //! Get name of used renderer.
+    /*!
+      \param pContext pointer to headless context.
+      \return name of renderer as reported by OpenGL.
+    */
+    std::string getRendererOfHeadlessContext(HeadlessContext const * pContext);
+
+    //! Terminate headless context. Terminate the GUI before.
+    /*!
+      \param pContext pointer to headless context.
+    */
+    void terminateHeadlessContext(HeadlessContext* pContext);
+}
+
+#endif // EYE_GUI_HEADLESS_H_
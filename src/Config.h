@@ -13,6 +13,9 @@
 
 namespace eyegui
 {
+    // Filters for gaze applied by GUI before updating elements
+    enum class GazeFilterType { NONE, FIXATION, ONE_EURO, KALMAN };
+
     struct Config
     {
         // Initialize with fallback values
@@ -36,6 +39,13 @@ namespace eyegui
         float gazeVisualizationMinSize = 0.02f;
         float gazeVisualizationMaxSize = 0.075f;
 		float keyboardSpeedMultiplier = 1.0f;
+        GazeFilterType gazeFilterType = GazeFilterType::NONE;
+        float gazeFilterFixationRadius = 0.03f; // Relative to smaller side of GUI
+        float gazeFilterOneEuroMinCutoff = 1.0f; // Hertz
+        float gazeFilterOneEuroBeta = 0.007f;
+        float gazeFilterOneEuroDerivativeCutoff = 1.0f; // Hertz
+        float gazeFilterKalmanProcessNoise = 50000.0f; // Pixels squared per seconds cubed
+        float gazeFilterKalmanMeasurementNoise = 100.0f; // Pixels squared
     };
 }
 
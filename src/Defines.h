@@ -32,6 +32,9 @@ namespace eyegui
     static const std::string CONFIG_EXTENSION = "ceyegui";
     static const std::string STYLESHEET_EXTENSION = "seyegui";
     static const std::string LOCALIZATION_EXTENSION = "leyegui";
+    static const std::string DICTIONARY_EXTENSION = "deyegui";
+    static const std::string COMPILED_FILE_SUFFIX = ".compiled"; // Appended to filepath of source file
+    static const unsigned int COMPILED_DOCUMENT_VERSION = 1; // Increase when format of compiled documents changes
     static const int NOTIFICATION_MAX_LOOP_COUNT = 10;
     static const float ACCUMULATED_TIME_PERIOD = 1800.0f;
     static const float FONT_CHARACTER_PADDING = 0.07f; // Percentage of height
@@ -39,6 +42,7 @@ namespace eyegui
     static const float RESIZE_WAIT_DURATION = 0.3f;
     static const glm::vec4 RESIZE_BLEND_COLOR = glm::vec4(0.75f, 0.75f, 0.75f, 0.75f);
     static const std::u16string LOCALIZATION_NOT_FOUND = u"";
+    static const uint LOCALIZATION_REFRESHES_PER_UPDATE = 16; // Text blocks getting content of switched localization per update
     static const float KEY_CIRCLE_CHARACTER_SIZE_RATIO = 0.6f;
     static const float KEYBOARD_HORIZONTAL_KEY_DISTANCE = 0.15f;
     static const ImageAlignment STANDARD_IMAGE_ALIGNMENT = ImageAlignment::ZOOMED;
@@ -46,8 +50,21 @@ namespace eyegui
     static const float KEY_FOCUS_DURATION = 0.3f;
     static const float KEY_SELECT_DURATION = 0.1f;
     static const float KEY_MIN_SCALE = 0.5f;
+    static const unsigned int KEYBOARD_SUGGESTION_COUNT = 5; // Words suggested by guesser of keyboard
+    static const std::u16string KEYBOARD_WORD_DELIMITERS = u" \t\n.,;:!?\"()"; // Characters ending the word being guessed
+    static const unsigned int PIECE_TABLE_MAX_PIECE_LENGTH = 1024; // Bounds scanning for newlines when piece is split
+    static const float TEXT_EDIT_CURSOR_WIDTH = 0.1f; // Relative to height of line
+    static const uint TEXT_EDIT_LAYOUT_CHUNK = 256; // Letters fetched at once while laying out
+    static const unsigned int GAZE_VISUALIZATION_MAX_POINTS = 1024; // Oldest point is dropped when trail is longer
     static const char16_t FONT_FALLBACK_CHARACTER = u' ';
     static const float FONT_KEYBOARD_SIZE = 0.1f; // Percentage of screen height
+    static const unsigned int GAZE_SAMPLE_BUFFER_CAPACITY = 2048; // Some seconds of high frequency eye tracker
+    static const unsigned int PROFILER_FRAME_COUNT = 300; // Frames kept for statistics
+    static const unsigned int TRACE_BUFFER_CAPACITY = 65536; // Events per thread
+    static const unsigned int FRAME_CAPTURE_BUFFER_COUNT = 3; // Pixel buffers in flight for asynchronous readback
+    static const unsigned int LAYER_STATIC_FRAME_COUNT = 30; // Frames without change before element is drawn from layer
+    static const unsigned int DAMAGE_RECT_MAX_COUNT = 4; // Areas drawn separately by partial redraw, more are merged
+    static const unsigned int ELEMENT_ARENA_CHUNK_SIZE = 16384; // Bytes per chunk of arena for elements of parsed layout or brick
 }
 
 #endif // DEFINES_H_
@@ -0,0 +1,257 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "Dictionary.h"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+
+namespace eyegui
+{
+    Dictionary::Dictionary(std::vector<Word> words)
+    {
+        // Empty words cannot be completed
+        words.erase(
+            std::remove_if(words.begin(), words.end(), [](const Word& rWord) { return rWord.value.empty(); }),
+            words.end());
+
+        // Sorted words sharing a prefix are next to each other
+        std::sort(words.begin(), words.end(), [](const Word& rA, const Word& rB) { return rA.value < rB.value; });
+
+        // Merge duplicates
+        size_t count = 0;
+        for (size_t i = 0; i < words.size(); i++)
+        {
+            if (count > 0 && words[count - 1].value == words[i].value)
+            {
+                uint64_t sum = (uint64_t)words[count - 1].frequency + words[i].frequency;
+                words[count - 1].frequency = (uint32_t)std::min(sum, (uint64_t)std::numeric_limits<uint32_t>::max());
+            }
+            else
+            {
+                if (count != i)
+                {
+                    words[count] = std::move(words[i]);
+                }
+                count++;
+            }
+        }
+        words.resize(count);
+        mCount = (uint)count;
+
+        // Build trie, root has no label
+        mNodes.resize(1);
+        mNodes[0].parent = 0;
+        build(0, words, 0, words.size(), 0);
+    }
+
+    Dictionary::~Dictionary()
+    {
+        // Nothing to do
+    }
+
+    Dictionary::Position Dictionary::getRoot() const
+    {
+        Position position;
+        position.node = 0;
+        position.depth = 0;
+        position.valid = true;
+        return position;
+    }
+
+    void Dictionary::advance(Position& rPosition, char16_t character) const
+    {
+        if (!rPosition.valid)
+        {
+            return;
+        }
+
+        // Continue within label of node
+        const Node& rNode = mNodes[rPosition.node];
+        if (rPosition.depth < rNode.labelLength)
+        {
+            if (mLabels[rNode.labelOffset + rPosition.depth] == character)
+            {
+                rPosition.depth++;
+            }
+            else
+            {
+                rPosition.valid = false;
+            }
+            return;
+        }
+
+        // Search child starting with character
+        uint32_t low = rNode.firstChild;
+        uint32_t high = rNode.firstChild + rNode.childCount;
+        while (low < high)
+        {
+            uint32_t middle = low + (high - low) / 2;
+            if (mLabels[mNodes[middle].labelOffset] < character)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        if (low < rNode.firstChild + rNode.childCount && mLabels[mNodes[low].labelOffset] == character)
+        {
+            rPosition.node = low;
+            rPosition.depth = 1;
+        }
+        else
+        {
+            rPosition.valid = false;
+        }
+    }
+
+    void Dictionary::complete(const Position& rPosition, uint count, std::vector<std::u16string>& rCompletions) const
+    {
+        rCompletions.clear();
+        if (!rPosition.valid || count == 0)
+        {
+            return;
+        }
+
+        // Candidate is either a word or a subtree ranked by its best word
+        struct Candidate
+        {
+            uint32_t frequency;
+            uint32_t node;
+            bool word;
+        };
+
+        // Words are taken before subtrees of same frequency, then ordered like the trie
+        auto lessUrgent = [](const Candidate& rA, const Candidate& rB)
+        {
+            if (rA.frequency != rB.frequency) { return rA.frequency < rB.frequency; }
+            if (rA.word != rB.word) { return !rA.word; }
+            return rA.node > rB.node;
+        };
+        std::priority_queue<Candidate, std::vector<Candidate>, decltype(lessUrgent)> candidates(lessUrgent);
+
+        // Every word below position starts with prefix
+        candidates.push({ mNodes[rPosition.node].bestFrequency, rPosition.node, false });
+        while (!candidates.empty() && rCompletions.size() < count)
+        {
+            Candidate candidate = candidates.top();
+            candidates.pop();
+
+            if (candidate.word)
+            {
+                rCompletions.push_back(getWord(candidate.node));
+            }
+            else
+            {
+                const Node& rNode = mNodes[candidate.node];
+                if (rNode.frequency > 0)
+                {
+                    candidates.push({ rNode.frequency, candidate.node, true });
+                }
+                for (uint32_t i = rNode.firstChild; i < rNode.firstChild + rNode.childCount; i++)
+                {
+                    candidates.push({ mNodes[i].bestFrequency, i, false });
+                }
+            }
+        }
+    }
+
+    uint Dictionary::getCount() const
+    {
+        return mCount;
+    }
+
+    void Dictionary::build(uint32_t nodeIndex, const std::vector<Word>& rWords, size_t begin, size_t end, size_t depth)
+    {
+        // Label is prefix shared by all words of range, except for root
+        size_t shared = depth;
+        if (nodeIndex != 0)
+        {
+            const std::u16string& rFirst = rWords[begin].value;
+            const std::u16string& rLast = rWords[end - 1].value;
+            size_t length = std::min(rFirst.size(), rLast.size());
+            while (shared < length && rFirst[shared] == rLast[shared])
+            {
+                shared++;
+            }
+        }
+        mNodes[nodeIndex].labelOffset = (uint32_t)mLabels.size();
+        mNodes[nodeIndex].labelLength = (uint32_t)(shared - depth);
+        if (shared > depth)
+        {
+            mLabels.append(rWords[begin].value, depth, shared - depth);
+        }
+
+        // Shortest word comes first after sorting
+        mNodes[nodeIndex].frequency = 0;
+        if (begin < end && rWords[begin].value.size() == shared)
+        {
+            mNodes[nodeIndex].frequency = std::max((uint32_t)1, rWords[begin].frequency);
+            begin++;
+        }
+
+        // Count children, one for each character following the label
+        uint32_t childCount = 0;
+        for (size_t i = begin; i < end;)
+        {
+            char16_t character = rWords[i].value[shared];
+            while (i < end && rWords[i].value[shared] == character)
+            {
+                i++;
+            }
+            childCount++;
+        }
+
+        // Children are stored next to each other, so they are reserved before filling them
+        uint32_t firstChild = (uint32_t)mNodes.size();
+        mNodes[nodeIndex].firstChild = firstChild;
+        mNodes[nodeIndex].childCount = childCount;
+        mNodes.resize(mNodes.size() + childCount);
+
+        // Fill children
+        uint32_t bestFrequency = mNodes[nodeIndex].frequency;
+        uint32_t child = firstChild;
+        for (size_t i = begin; i < end;)
+        {
+            size_t j = i;
+            char16_t character = rWords[i].value[shared];
+            while (j < end && rWords[j].value[shared] == character)
+            {
+                j++;
+            }
+            mNodes[child].parent = nodeIndex;
+            build(child, rWords, i, j, shared);
+            bestFrequency = std::max(bestFrequency, mNodes[child].bestFrequency);
+            child++;
+            i = j;
+        }
+        mNodes[nodeIndex].bestFrequency = bestFrequency;
+    }
+
+    std::u16string Dictionary::getWord(uint32_t nodeIndex) const
+    {
+        // Collect labels up to root
+        std::vector<uint32_t> path;
+        size_t length = 0;
+        for (uint32_t node = nodeIndex; node != 0; node = mNodes[node].parent)
+        {
+            path.push_back(node);
+            length += mNodes[node].labelLength;
+        }
+
+        std::u16string word;
+        word.reserve(length);
+        for (auto it = path.rbegin(); it != path.rend(); it++)
+        {
+            word.append(mLabels, mNodes[*it].labelOffset, mNodes[*it].labelLength);
+        }
+        return word;
+    }
+}
@@ -0,0 +1,88 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Words with frequencies in a compressed trie. Nodes and their labels are
+// kept in flat arrays without pointers, children of a node are stored next to
+// each other and sorted by first character. Each node knows the highest
+// frequency below it, so completions are found by best first search without
+// visiting the whole subtree. Immutable after construction.
+
+#ifndef DICTIONARY_H_
+#define DICTIONARY_H_
+
+#include "Defines.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace eyegui
+{
+    class Dictionary
+    {
+    public:
+
+        // Word with frequency, higher frequency is suggested first
+        struct Word
+        {
+            std::u16string value;
+            uint32_t frequency;
+        };
+
+        // Position in trie reached by some prefix
+        struct Position
+        {
+            uint32_t node;
+            uint32_t depth; // count of characters of label of node already matched
+            bool valid; // false if no word starts with prefix
+        };
+
+        // Constructor, frequencies of duplicates are summed up
+        Dictionary(std::vector<Word> words);
+
+        // Destructor
+        virtual ~Dictionary();
+
+        // Get position of empty prefix
+        Position getRoot() const;
+
+        // Extend prefix of position by character
+        void advance(Position& rPosition, char16_t character) const;
+
+        // Fill most frequent words starting with prefix of position, ordered by frequency
+        void complete(const Position& rPosition, uint count, std::vector<std::u16string>& rCompletions) const;
+
+        // Get count of words
+        uint getCount() const;
+
+    private:
+
+        // Node of trie
+        struct Node
+        {
+            uint32_t parent;
+            uint32_t labelOffset;
+            uint32_t labelLength;
+            uint32_t firstChild;
+            uint32_t childCount;
+            uint32_t frequency; // zero if no word ends at node
+            uint32_t bestFrequency; // highest frequency of words ending at node or below
+        };
+
+        // Fill node with sorted words of range, which share given count of characters
+        void build(uint32_t nodeIndex, const std::vector<Word>& rWords, size_t begin, size_t end, size_t depth);
+
+        // Get word ending at node
+        std::u16string getWord(uint32_t nodeIndex) const;
+
+        // Members
+        std::vector<Node> mNodes; // root is first node
+        std::u16string mLabels;
+        uint mCount;
+    };
+}
+
+#endif // DICTIONARY_H_
@@ -11,7 +11,7 @@ namespace eyegui
 {
     Blank::Blank(
         std::string id,
-        std::string styleName,
+        uint styleId,
         Element* pParent,
         Layout const * pLayout,
         Frame* pFrame,
@@ -22,7 +22,7 @@ namespace eyegui
         bool dimming,
         bool adaptiveScaling) : Element(
             id,
-            styleName,
+            styleId,
             pParent,
             pLayout,
             pFrame,
@@ -65,4 +65,10 @@ namespace eyegui
     {
         return false;
     }
+
+    bool Blank::isLayerCacheable() const
+    {
+        // Nothing is drawn
+        return true;
+    }
 }
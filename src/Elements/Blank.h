@@ -21,7 +21,7 @@ namespace eyegui
         // Constructor
         Blank(
             std::string id,
-            std::string styleName,
+            uint styleId,
             Element* pParent,
             Layout const * pLayout,
             Frame* pFrame,
@@ -51,6 +51,9 @@ namespace eyegui
 
         // Implemented by subclasses
         virtual bool mayConsumeInput();
+
+        // Drawing depends only on state
+        virtual bool isLayerCacheable() const;
     };
 }
 
@@ -11,7 +11,7 @@ namespace eyegui
 {
     Block::Block(
         std::string id,
-        std::string styleName,
+        uint styleId,
         Element* pParent,
         Layout const * pLayout,
         Frame* pFrame,
@@ -26,7 +26,7 @@ namespace eyegui
         ImageAlignment backgroundAlignment,
         float innerBorder) : Element(
             id,
-            styleName,
+            styleId,
             pParent,
             pLayout,
             pFrame,
@@ -156,4 +156,10 @@ namespace eyegui
     {
         return mConsumeInput;
     }
+
+    bool Block::isLayerCacheable() const
+    {
+        // Background, image and children do not change over time
+        return true;
+    }
 }
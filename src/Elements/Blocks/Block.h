@@ -20,7 +20,7 @@ namespace eyegui
         // Constructor
         Block(
             std::string id,
-            std::string styleName,
+            uint styleId,
             Element* pParent,
             Layout const * pLayout,
             Frame* pFrame,
@@ -55,6 +55,9 @@ namespace eyegui
         // Implemented by subclasses
         virtual bool mayConsumeInput();
 
+        // Drawing depends only on state
+        virtual bool isLayerCacheable() const;
+
         // Members
         int mInnerX;
         int mInnerY;
@@ -13,7 +13,7 @@ namespace eyegui
 {
     Grid::Grid(
         std::string id,
-        std::string styleName,
+        uint styleId,
         Element* pParent,
         Layout const * pLayout,
         Frame* pFrame,
@@ -30,7 +30,7 @@ namespace eyegui
         bool showBackground,
         int rows) : Container(
             id,
-            styleName,
+            styleId,
             pParent,
             pLayout,
             pFrame,
@@ -24,7 +24,7 @@ namespace eyegui
         // Constructor
         Grid(
             std::string id,
-            std::string styleName,
+            uint styleId,
             Element* pParent,
             Layout const * pLayout,
             Frame* pFrame,
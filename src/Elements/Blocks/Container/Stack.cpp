@@ -14,7 +14,7 @@ namespace eyegui
 {
     Stack::Stack(
         std::string id,
-        std::string styleName,
+        uint styleId,
         Element* pParent,
         Layout const * pLayout,
         Frame* pFrame,
@@ -34,7 +34,7 @@ namespace eyegui
         float padding,
         float separator) : Container(
             id,
-            styleName,
+            styleId,
             pParent,
             pLayout,
             pFrame,
@@ -34,7 +34,7 @@ namespace eyegui
         // Constructor
         Stack(
             std::string id,
-            std::string styleName,
+            uint styleId,
             Element* pParent,
             Layout const * pLayout,
             Frame* pFrame,
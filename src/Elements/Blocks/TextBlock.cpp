@@ -14,7 +14,7 @@ namespace eyegui
 {
     TextBlock::TextBlock(
         std::string id,
-        std::string styleName,
+        uint styleId,
         Element* pParent,
         Layout const * pLayout,
         Frame* pFrame,
@@ -35,7 +35,7 @@ namespace eyegui
         std::u16string content,
         std::string key) : Block(
             id,
-            styleName,
+            styleId,
             pParent,
             pLayout,
             pFrame,
@@ -54,12 +54,13 @@ namespace eyegui
 
         // Fill members
         mKey = key;
+        mLocalizationGeneration = 0;
 
         // Content of text flow
         std::u16string textFlowContent;
         if (mKey != EMPTY_STRING_ATTRIBUTE)
         {
-            std::u16string localization = mpLayout->getContentFromLocalization(mKey);
+            const std::u16string& localization = mpLayout->getContentFromLocalization(mKey);
             if (localization == LOCALIZATION_NOT_FOUND)
             {
                 throwWarning(
@@ -90,6 +91,8 @@ namespace eyegui
 
     void TextBlock::setContent(std::u16string content)
     {
+        EYEGUI_TRACE_SCOPE("TextBlock::setContent", getId());
+
         // Check whether value from key is in use
         if (mKey != EMPTY_STRING_ATTRIBUTE && mpLayout->getContentFromLocalization(mKey) == LOCALIZATION_NOT_FOUND)
         {
@@ -100,11 +103,14 @@ namespace eyegui
         else
         {
             mupTextFlow->setContent(content);
+            mDrawingChanged = true;
         }
     }
 
     void TextBlock::setKey(std::string key)
     {
+        EYEGUI_TRACE_SCOPE("TextBlock::setKey", getId() + ", key: " + key);
+
         if (key == EMPTY_STRING_ATTRIBUTE)
         {
             throwWarning(
@@ -113,7 +119,7 @@ namespace eyegui
         }
         else
         {
-            std::u16string localization = mpLayout->getContentFromLocalization(key);
+            const std::u16string& localization = mpLayout->getContentFromLocalization(key);
             if (localization == LOCALIZATION_NOT_FOUND)
             {
                 throwWarning(
@@ -124,8 +130,37 @@ namespace eyegui
             {
                 mKey = key;
                 mupTextFlow->setContent(localization);
+                mDrawingChanged = true;
+            }
+        }
+    }
+
+    void TextBlock::refreshLocalization(uint generation, uint& rBudget)
+    {
+        // Super call
+        Block::refreshLocalization(generation, rBudget);
+
+        if (mKey == EMPTY_STRING_ATTRIBUTE || mLocalizationGeneration == generation)
+        {
+            return;
+        }
+
+        // Current content is kept if key is missing or content did not change
+        const std::u16string& localization = mpLayout->getContentFromLocalization(mKey);
+        if (localization != LOCALIZATION_NOT_FOUND && localization != mupTextFlow->getContent())
+        {
+            // Without budget, it is tried again at next update
+            if (rBudget == 0)
+            {
+                return;
             }
+            rBudget--;
+
+            EYEGUI_TRACE_SCOPE("TextBlock::refreshLocalization", getId());
+            mupTextFlow->setContent(localization);
+            mDrawingChanged = true;
         }
+        mLocalizationGeneration = generation;
     }
 
     void TextBlock::specialDraw() const
@@ -146,6 +181,8 @@ namespace eyegui
 
     void TextBlock::specialTransformAndSize()
     {
+        EYEGUI_TRACE_SCOPE("TextBlock::specialTransformAndSize", getId());
+
         // Super call
         Block::specialTransformAndSize();
 
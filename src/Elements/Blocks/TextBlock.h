@@ -21,7 +21,7 @@ namespace eyegui
         // Constructors
         TextBlock(
             std::string id,
-            std::string styleName,
+            uint styleId,
             Element* pParent,
             Layout const * pLayout,
             Frame* pFrame,
@@ -51,6 +51,9 @@ namespace eyegui
         // Setter for key
         void setKey(std::string key);
 
+        // Take content of switched localization if it differs and budget is left
+        virtual void refreshLocalization(uint generation, uint& rBudget);
+
     protected:
 
         // Drawing filled by subclasses
@@ -63,6 +66,7 @@ namespace eyegui
 
         // Members
         std::string mKey;
+        uint mLocalizationGeneration; // generation of localization content was compared with
         std::unique_ptr<TextFlow> mupTextFlow;
     };
 }
@@ -0,0 +1,127 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "TextEdit.h"
+
+#include "Layout.h"
+
+namespace eyegui
+{
+    TextEdit::TextEdit(
+        std::string id,
+        uint styleId,
+        Element* pParent,
+        Layout const * pLayout,
+        Frame* pFrame,
+        AssetManager* pAssetManager,
+        NotificationQueue* pNotificationQueue,
+        float relativeScale,
+        float border,
+        bool dimming,
+        bool adaptiveScaling,
+        bool consumeInput,
+        std::string backgroundFilepath,
+        ImageAlignment backgroundAlignment,
+        float innerBorder,
+        FontSize fontSize,
+        float textScale,
+        std::u16string content) : Block(
+            id,
+            styleId,
+            pParent,
+            pLayout,
+            pFrame,
+            pAssetManager,
+            pNotificationQueue,
+            relativeScale,
+            border,
+            dimming,
+            adaptiveScaling,
+            consumeInput,
+            backgroundFilepath,
+            backgroundAlignment,
+            innerBorder)
+    {
+        mType = Type::TEXT_EDIT;
+
+        // Create text flow
+        mupTextFlow = std::move(mpAssetManager->createEditableTextFlow(fontSize, textScale, content));
+    }
+
+    TextEdit::~TextEdit()
+    {
+        // Nothing to do
+    }
+
+    void TextEdit::setContent(std::u16string content)
+    {
+        EYEGUI_TRACE_SCOPE("TextEdit::setContent", getId());
+
+        mupTextFlow->setContent(content);
+        mDrawingChanged = true;
+    }
+
+    std::u16string TextEdit::getContent() const
+    {
+        return mupTextFlow->getContent();
+    }
+
+    void TextEdit::addContentAtCursor(std::u16string content)
+    {
+        EYEGUI_TRACE_SCOPE("TextEdit::addContentAtCursor", getId());
+
+        mupTextFlow->insertAtCursor(content);
+        mDrawingChanged = true;
+    }
+
+    void TextEdit::deleteContentAtCursor(int letterCount)
+    {
+        EYEGUI_TRACE_SCOPE("TextEdit::deleteContentAtCursor", getId());
+
+        mupTextFlow->eraseAtCursor(letterCount);
+        mDrawingChanged = true;
+    }
+
+    void TextEdit::moveCursorOverLetters(int letterCount)
+    {
+        mupTextFlow->moveCursorOverLetters(letterCount);
+        mDrawingChanged = true;
+    }
+
+    void TextEdit::moveCursorOverLines(int lineCount)
+    {
+        mupTextFlow->moveCursorOverLines(lineCount);
+        mDrawingChanged = true;
+    }
+
+    void TextEdit::specialDraw() const
+    {
+        // Super call
+        Block::specialDraw();
+
+        // Drawing of text flow
+        mupTextFlow->draw(
+            getStyle()->fontColor,
+            mAlpha,
+            mActivity.getValue(),
+            getStyle()->dimColor,
+            mDim.getValue(),
+            getStyle()->markColor,
+            mMark.getValue());
+    }
+
+    void TextEdit::specialTransformAndSize()
+    {
+        EYEGUI_TRACE_SCOPE("TextEdit::specialTransformAndSize", getId());
+
+        // Super call
+        Block::specialTransformAndSize();
+
+        // Tell text flow about transformation
+        mupTextFlow->transformAndSize(mInnerX, mInnerY, mInnerWidth, mInnerHeight);
+    }
+}
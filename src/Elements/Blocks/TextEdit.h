@@ -0,0 +1,78 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Block displaying text which is edited at a cursor, e.g. by a keyboard.
+// Delegating an editable text flow object for this task.
+
+#ifndef TEXT_EDIT_H_
+#define TEXT_EDIT_H_
+
+#include "Block.h"
+
+namespace eyegui
+{
+    class TextEdit : public Block
+    {
+    public:
+
+        // Constructors
+        TextEdit(
+            std::string id,
+            uint styleId,
+            Element* pParent,
+            Layout const * pLayout,
+            Frame* pFrame,
+            AssetManager* pAssetManager,
+            NotificationQueue* pNotificationQueue,
+            float relativeScale,
+            float border,
+            bool dimming,
+            bool adaptiveScaling,
+            bool consumeInput,
+            std::string backgroundFilepath,
+            ImageAlignment backgroundAlignment,
+            float innerBorder,
+            FontSize fontSize,
+            float textScale,
+            std::u16string content);
+
+        // Destructor
+        virtual ~TextEdit();
+
+        // Setter for content, cursor is placed at end
+        void setContent(std::u16string content);
+
+        // Getter for content
+        std::u16string getContent() const;
+
+        // Insert content in front of cursor
+        void addContentAtCursor(std::u16string content);
+
+        // Delete letters behind cursor, or in front of it for negative count
+        void deleteContentAtCursor(int letterCount);
+
+        // Move cursor over letters
+        void moveCursorOverLetters(int letterCount);
+
+        // Move cursor over displayed lines
+        void moveCursorOverLines(int lineCount);
+
+    protected:
+
+        // Drawing filled by subclasses
+        virtual void specialDraw() const;
+
+        // Transformation
+        virtual void specialTransformAndSize();
+
+    private:
+
+        // Members
+        std::unique_ptr<EditableTextFlow> mupTextFlow;
+    };
+}
+
+#endif // TEXT_EDIT_H_
@@ -8,6 +8,7 @@
 #include "Element.h"
 
 #include "Layout.h"
+#include "src/Rendering/DamageRegion.h"
 #include "src/Utilities/Helper.h"
 #include "externals/GLM/glm/gtc/matrix_transform.hpp"
 #include "src/Utilities/OperationNotifier.h"
@@ -18,7 +19,7 @@ namespace eyegui
 {
     Element::Element(
         std::string id,
-        std::string styleName,
+        uint styleId,
         Element* pParent,
         Layout const * pLayout,
         Frame* pFrame,
@@ -37,7 +38,7 @@ namespace eyegui
         mOrientation = Element::Orientation::VERTICAL;
         mType = Type::ELEMENT;
         mId = id;
-        mStyleName = styleName;
+        mStyleId = styleId;
         mpParent = pParent;
         mpLayout = pLayout;
         mpFrame = pFrame;
@@ -57,16 +58,22 @@ namespace eyegui
         mHidden = false;
         mMarking = false;
         mMark.setValue(0);
+        mDrawingChanged = true;
+        mDrawingState = {};
+        mStaticFrameCount = 0;
+        mStatic = false;
+        mLayerCached = false;
 
         // Fetch style from layout
-        mpStyle = mpLayout->getStyleFromStylesheet(mStyleName);
+        mpStyle = mpLayout->getStyles()->getStyle(mStyleId);
 
         if(mpStyle == NULL)
         {
-            throwError(OperationNotifier::Operation::BUG, "Cannot find style with name at initialization of element: " + styleName);
+            throwError(OperationNotifier::Operation::BUG, "Cannot find style with id at initialization of element: " + std::to_string(styleId));
 
             // Ok, try to rescue by getting default style. Should be NEVER necessary
-            mpStyle = mpLayout->getStyleFromStylesheet(DEFAULT_STYLE_NAME);
+            mStyleId = mpLayout->getStyles()->getDefaultId();
+            mpStyle = mpLayout->getStyles()->getStyle(mStyleId);
         }
     }
 
@@ -146,11 +153,11 @@ namespace eyegui
 
     void Element::setStyle(std::string styleName)
     {
-        Style const * pStyle = mpLayout->getStyleFromStylesheet(styleName);
-
-        if(pStyle != NULL)
+        uint styleId = 0;
+        if(mpLayout->getStyles()->findId(styleName, styleId))
         {
-            mpStyle = pStyle;
+            mStyleId = styleId;
+            mpStyle = mpLayout->getStyles()->getStyle(mStyleId);
         }
         else
         {
@@ -158,9 +165,14 @@ namespace eyegui
         }
     }
 
+    uint Element::getStyleId() const
+    {
+        return mStyleId;
+    }
+
     std::string Element::getStyleName() const
     {
-        return mStyleName;
+        return mpLayout->getStyles()->getName(mStyleId);
     }
 
     void Element::setAlpha(float alpha)
@@ -510,7 +522,47 @@ namespace eyegui
         return mAdaptiveScale.getValue();
     }
 
+    bool Element::consumesGaze(Input const * pInput, float alpha)
+    {
+        // Mirrors usage of input in update
+        if (penetratedByInput(pInput) && mayConsumeInput())
+        {
+            return true;
+        }
+
+        // Children get no input from inactive or fading element
+        if (alpha < 1 || !mActive)
+        {
+            return false;
+        }
+        for (const std::unique_ptr<Element>& rupChild : mChildren)
+        {
+            if (rupChild->consumesGaze(pInput, alpha))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     void Element::draw() const
+    {
+        // Element and its children are skipped outside of redrawn area
+        if (mpLayout->getDamageRegion()->isClipped(mX, mY, mWidth, mHeight))
+        {
+            return;
+        }
+
+        // Element and its children may be served from layer of frame
+        if (mLayerCached && mpFrame->drawFromLayer(this))
+        {
+            return;
+        }
+
+        drawWithoutLayer();
+    }
+
+    void Element::drawWithoutLayer() const
     {
         // Only draw if visible
         if (mAlpha > 0 && !mHidden)
@@ -526,6 +578,122 @@ namespace eyegui
         }
     }
 
+    void Element::trackDrawing(DamageRegion* pDamageRegion)
+    {
+        // Drawing state of current frame
+        DrawingState state;
+        state.x = mX;
+        state.y = mY;
+        state.width = mWidth;
+        state.height = mHeight;
+        state.alpha = mAlpha;
+        state.activity = mActivity.getValue();
+        state.dim = mDim.getValue();
+        state.mark = mMark.getValue();
+        state.adaptiveScale = mAdaptiveScale.getValue();
+        state.pStyle = mpStyle;
+        state.hidden = mHidden;
+
+        // Any change restarts counting of static frames. Subclass is asked
+        // first, so it can remember its values for the next frame
+        bool changed = specialDrawingChanged()
+            || mDrawingChanged
+            || state.x != mDrawingState.x
+            || state.y != mDrawingState.y
+            || state.width != mDrawingState.width
+            || state.height != mDrawingState.height
+            || state.alpha != mDrawingState.alpha
+            || state.activity != mDrawingState.activity
+            || state.dim != mDrawingState.dim
+            || state.mark != mDrawingState.mark
+            || state.adaptiveScale != mDrawingState.adaptiveScale
+            || state.pStyle != mDrawingState.pStyle
+            || state.hidden != mDrawingState.hidden;
+        if (changed)
+        {
+            mStaticFrameCount = 0;
+
+            // Nothing to draw again if element was and is invisible
+            if (isVisible(mDrawingState))
+            {
+                pDamageRegion->add(mDrawingState.x, mDrawingState.y, mDrawingState.width, mDrawingState.height);
+            }
+            if (isVisible(state))
+            {
+                pDamageRegion->add(state.x, state.y, state.width, state.height);
+            }
+        }
+        else if (mStaticFrameCount < LAYER_STATIC_FRAME_COUNT)
+        {
+            mStaticFrameCount++;
+        }
+        mDrawingState = state;
+        mDrawingChanged = false;
+
+        // Fading replaced element is drawn on top of this
+        if (mupReplacedElement.get() != NULL)
+        {
+            mupReplacedElement->trackDrawing(pDamageRegion);
+        }
+
+        for (std::unique_ptr<Element>& rupChild : mChildren)
+        {
+            rupChild->trackDrawing(pDamageRegion);
+        }
+    }
+
+    void Element::updateLayerCaching(std::vector<Element*>& rCachedElements)
+    {
+        if (collectStaticElements(rCachedElements))
+        {
+            // Whole tree is static
+            mLayerCached = true;
+            rCachedElements.push_back(this);
+        }
+    }
+
+    void Element::resetLayerCaching()
+    {
+        mStatic = false;
+        mLayerCached = false;
+
+        for (std::unique_ptr<Element>& rupChild : mChildren)
+        {
+            rupChild->resetLayerCaching();
+        }
+    }
+
+    void Element::refetchStyle()
+    {
+        mpStyle = mpLayout->getStyles()->getStyle(mStyleId);
+
+        for (std::unique_ptr<Element>& rupChild : mChildren)
+        {
+            rupChild->refetchStyle();
+        }
+        if (mupReplacedElement.get() != NULL)
+        {
+            mupReplacedElement->refetchStyle();
+        }
+    }
+
+    void Element::refreshLocalization(uint generation, uint& rBudget)
+    {
+        for (std::unique_ptr<Element>& rupChild : mChildren)
+        {
+            rupChild->refreshLocalization(generation, rBudget);
+        }
+        if (mupReplacedElement.get() != NULL)
+        {
+            mupReplacedElement->refreshLocalization(generation, rBudget);
+        }
+    }
+
+    bool Element::isLayerCached() const
+    {
+        return mLayerCached;
+    }
+
     void Element::reset()
     {
         mActive = true;
@@ -535,6 +703,7 @@ namespace eyegui
         mForceUndim = false;
 
         mAdaptiveScale.setValue(0);
+        mDrawingChanged = true;
 
         // TODO: one could reset marking, too
 
@@ -618,6 +787,9 @@ namespace eyegui
 
     void Element::commitReplacedElement(std::unique_ptr<Element> upElement, bool fade)
     {
+        // Replaced element is drawn by this and not from layer anymore
+        upElement->resetLayerCaching();
+
         if (fade)
         {
             // Fading is wished, so remember the replaced element
@@ -645,4 +817,66 @@ namespace eyegui
         }
         return false;
     }
+
+    bool Element::penetratedBySample(Input const * pInput, const GazeSample& rSample) const
+    {
+        if (pInput == NULL)
+        {
+            return false;
+        }
+
+        // Sample replaces gaze of input, like the latest sample does for whole update
+        Input sampleInput = *pInput;
+        sampleInput.gazeX = (int)rSample.gazeX;
+        sampleInput.gazeY = (int)rSample.gazeY;
+        return penetratedByInput(&sampleInput);
+    }
+
+    bool Element::isLayerCacheable() const
+    {
+        return false;
+    }
+
+    bool Element::specialDrawingChanged()
+    {
+        return false;
+    }
+
+    bool Element::isVisible(const DrawingState& rState)
+    {
+        return rState.alpha > 0 && !rState.hidden;
+    }
+
+    bool Element::collectStaticElements(std::vector<Element*>& rCachedElements)
+    {
+        // Frames without change are counted while tracking drawing
+        mLayerCached = false;
+
+        // Fading replaced element is drawn on top of this
+        mStatic = isLayerCacheable()
+            && mupReplacedElement.get() == NULL
+            && mStaticFrameCount >= LAYER_STATIC_FRAME_COUNT;
+
+        // Children have to be visited anyway to keep their state up to date
+        for (std::unique_ptr<Element>& rupChild : mChildren)
+        {
+            bool childStatic = rupChild->collectStaticElements(rCachedElements);
+            mStatic = mStatic && childStatic;
+        }
+
+        // Static children of dynamic element are drawn from layer
+        if (!mStatic)
+        {
+            for (std::unique_ptr<Element>& rupChild : mChildren)
+            {
+                if (rupChild->mStatic)
+                {
+                    rupChild->mLayerCached = true;
+                    rCachedElements.push_back(rupChild.get());
+                }
+            }
+        }
+
+        return mStatic;
+    }
 }
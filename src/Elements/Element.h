@@ -25,6 +25,8 @@
 #include "Rendering/AssetManager.h"
 #include "Style.h"
 #include "src/Utilities/LerpValue.h"
+#include "src/Utilities/ElementArena.h"
+#include "src/Utilities/GazeSampleBuffer.h"
 #include "externals/GLM/glm/glm.hpp"
 
 #include <memory>
@@ -38,8 +40,9 @@ namespace eyegui
     class NotificationQueue;
     class Frame;
     class InteractiveElement;
+    class DamageRegion;
 
-    class Element : public Object
+    class Element : public Object, public ArenaAllocated
     {
     public:
 
@@ -60,7 +63,8 @@ namespace eyegui
             STACK,
             GRID,
             TEXT_BLOCK,
-            KEYBOARD
+            KEYBOARD,
+            TEXT_EDIT
         };
 
         // Orientation of element
@@ -69,7 +73,7 @@ namespace eyegui
         // Constructor
         Element(
             std::string id,
-            std::string styleName,
+            uint styleId,
             Element* pParent,
             Layout const * pLayout,
             Frame* pFrame,
@@ -116,6 +120,9 @@ namespace eyegui
         // Setter for style
         void setStyle(std::string styleName);
 
+        // Getter for id of style
+        uint getStyleId() const;
+
         // Getter for name of style
         std::string getStyleName() const;
 
@@ -179,9 +186,38 @@ namespace eyegui
         // Updating, returns adaptive scale
         float update(float tpf, float alpha, Input* pInput, float dim);
 
-        // Drawing
+        // Whether element or some child would consume gaze of input when updated with alpha
+        bool consumesGaze(Input const * pInput, float alpha);
+
+        // Drawing, served from layer of frame if element is cached there and
+        // skipped if outside of area currently redrawn
         void draw() const;
 
+        // Drawing without using layer of frame
+        void drawWithoutLayer() const;
+
+        // Compare state used by drawing with the one of last update. Old and
+        // new area of changed elements are added to damaged region
+        void trackDrawing(DamageRegion* pDamageRegion);
+
+        // Update caching in layer of frame after tracking drawing. Elements and
+        // their children, which have not changed for some frames, are static. Highest
+        // static elements are collected and marked for being drawn from layer
+        void updateLayerCaching(std::vector<Element*>& rCachedElements);
+
+        // Stop drawing element and children from layer
+        void resetLayerCaching();
+
+        // Fetch style of element, children and replaced element again from layout
+        void refetchStyle();
+
+        // Take content of switched localization in element, children and replaced element.
+        // Budget is decreased by each text block which has to change its content
+        virtual void refreshLocalization(uint generation, uint& rBudget);
+
+        // Whether element is drawn from layer
+        bool isLayerCached() const;
+
         // Resetting
         void reset();
 
@@ -226,6 +262,15 @@ namespace eyegui
         // Checks, whether element is penetrated by input
         virtual bool penetratedByInput(Input const * pInput) const;
 
+        // Checks, whether element is penetrated by single gaze sample of input
+        bool penetratedBySample(Input const * pInput, const GazeSample& rSample) const;
+
+        // Whether drawing depends only on state of element and not on time
+        virtual bool isLayerCacheable() const;
+
+        // Whether drawing of subclass has changed since last call, called once per frame
+        virtual bool specialDrawingChanged();
+
         // Members
         int mX, mY, mWidth, mHeight; // ONLY PIXEL BASED VALUES HERE
         Type mType;
@@ -247,21 +292,41 @@ namespace eyegui
         LerpValue mAdaptiveScale; // [0..1]
         bool mMarking;
         LerpValue mMark;
+        bool mDrawingChanged; // Set by subclasses if drawing changes without state of element
 
         // This vector is the owner of all children. May be empty!
         std::vector<std::unique_ptr<Element> > mChildren;
 
     private:
 
+        // State of element used by drawing
+        struct DrawingState
+        {
+            int x, y, width, height;
+            float alpha, activity, dim, mark, adaptiveScale;
+            Style const * pStyle;
+            bool hidden;
+        };
+
+        // Whether element was visible in drawing state
+        static bool isVisible(const DrawingState& rState);
+
+        // Collect highest static elements, returns whether element and children are static
+        bool collectStaticElements(std::vector<Element*>& rCachedElements);
+
         // Members
         std::string mId;
         Element* mpParent;
         float mBorder; // [0..1]
         Orientation mOrientation;
-        std::string mStyleName;
+        uint mStyleId;
         Style const * mpStyle;
         std::unique_ptr<Element> mupReplacedElement;
         bool mHidden;
+        DrawingState mDrawingState;
+        uint mStaticFrameCount;
+        bool mStatic;
+        bool mLayerCached;
     };
 }
 
@@ -132,4 +132,17 @@ namespace eyegui
         }
         return NULL;
     }
+
+    TextEdit* toTextEdit(Element* pElement)
+    {
+        if (pElement != NULL)
+        {
+            Element::Type type = pElement->getType();
+            if (type == Element::Type::TEXT_EDIT)
+            {
+                return static_cast<TextEdit*>(pElement);
+            }
+        }
+        return NULL;
+    }
 }
@@ -33,6 +33,9 @@ namespace eyegui
 
     // Tries to cast pointer, returns NULL if fails
     Keyboard* toKeyboard(Element* pElement);
+
+    // Tries to cast pointer, returns NULL if fails
+    TextEdit* toTextEdit(Element* pElement);
 }
 
 #endif // ELEMENT_CASTING_H_
@@ -16,7 +16,7 @@ namespace eyegui
 {
     Button::Button(
         std::string id,
-        std::string styleName,
+        uint styleId,
         Element* pParent,
         Layout const * pLayout,
         Frame* pFrame,
@@ -29,7 +29,7 @@ namespace eyegui
         std::string iconFilepath,
         bool isSwitch) : IconInteractiveElement(
             id,
-            styleName,
+            styleId,
             pParent,
             pLayout,
             pFrame,
@@ -50,6 +50,8 @@ namespace eyegui
         mIsDown = false;
         mThreshold.setValue(0);
         mPressing.setValue(0);
+        mDrawnThreshold = 0;
+        mDrawnPressing = 0;
     }
 
     Button::~Button()
@@ -133,9 +135,6 @@ namespace eyegui
         // Super call
         float adaptiveScale = IconInteractiveElement::specialUpdate(tpf, pInput);
 
-        // Check for penetration by input
-        bool penetrated = penetratedByInput(pInput);
-
         // Pressing animation
         if (mIsDown && mPressing.getValue() < 1)
         {
@@ -154,18 +153,28 @@ namespace eyegui
             up();
         }
 
-        // Threshold
+        // Threshold, accumulated over every gaze sample since last update
         if (
             (mPressing.getValue() == 0 || mPressing.getValue() == 1) // Only when completey up or down
-            && penetrated // Penetration
             && !(!mIsSwitch && mPressing.getValue() > 0)) // Avoids to add threshold for none switch when at down position
         {
-            mThreshold.update(tpf / mpLayout->getConfig()->buttonThresholdIncreaseDuration);
-
-            if (mThreshold.getValue() >= 1)
+            for (const GazeSample& rSample : mpLayout->getGazeSamples())
             {
-                hit();
-                mThreshold.setValue(0);
+                if (penetratedBySample(pInput, rSample))
+                {
+                    mThreshold.update(rSample.duration / mpLayout->getConfig()->buttonThresholdIncreaseDuration);
+
+                    if (mThreshold.getValue() >= 1)
+                    {
+                        hit();
+                        mThreshold.setValue(0);
+                        break;
+                    }
+                }
+                else
+                {
+                    mThreshold.update(-rSample.duration / mpLayout->getConfig()->buttonThresholdDecreaseDuration);
+                }
             }
         }
         else
@@ -229,4 +238,15 @@ namespace eyegui
             break;
         }
     }
+
+    bool Button::specialDrawingChanged()
+    {
+        // Super call first, so it remembers its values
+        bool changed = IconInteractiveElement::specialDrawingChanged()
+            || mThreshold.getValue() != mDrawnThreshold
+            || mPressing.getValue() != mDrawnPressing;
+        mDrawnThreshold = mThreshold.getValue();
+        mDrawnPressing = mPressing.getValue();
+        return changed;
+    }
 }
@@ -21,7 +21,7 @@ namespace eyegui
         // Constructors
         Button(
             std::string id,
-            std::string styleName,
+            uint styleId,
             Element* pParent,
             Layout const * pLayout,
             Frame* pFrame,
@@ -68,6 +68,9 @@ namespace eyegui
         // Filled by subclass and called by layout after updating and before drawing
         virtual void specialPipeNotification(NotificationType notification, Layout* pLayout);
 
+        // Whether threshold or pressing has changed since last call
+        virtual bool specialDrawingChanged();
+
     private:
 
         // Members
@@ -75,6 +78,8 @@ namespace eyegui
         bool mIsSwitch;
         LerpValue mThreshold; // [0..1]
         LerpValue mPressing; // [0..1]
+        float mDrawnThreshold;
+        float mDrawnPressing;
     };
 }
 
@@ -11,7 +11,7 @@ namespace eyegui
 {
     CircleButton::CircleButton(
         std::string id,
-        std::string styleName,
+        uint styleId,
         Element* pParent,
         Layout const * pLayout,
         Frame* pFrame,
@@ -24,7 +24,7 @@ namespace eyegui
         std::string iconFilepath,
         bool isSwitch) : Button(
             id,
-            styleName,
+            styleId,
             pParent,
             pLayout,
             pFrame,
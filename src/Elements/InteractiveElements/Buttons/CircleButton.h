@@ -20,7 +20,7 @@ namespace eyegui
         // Constructor
         CircleButton(
             std::string id,
-            std::string styleName,
+            uint styleId,
             Element* pParent,
             Layout const * pLayout,
             Frame* pFrame,
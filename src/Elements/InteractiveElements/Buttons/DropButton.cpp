@@ -14,7 +14,7 @@ namespace eyegui
 {
     DropButton::DropButton(
         std::string id,
-        std::string styleName,
+        uint styleId,
         Element* pParent,
         Layout const * pLayout,
         Frame* pFrame,
@@ -27,7 +27,7 @@ namespace eyegui
         std::string iconFilepath,
         float space) : BoxButton(
             id,
-            styleName,
+            styleId,
             pParent,
             pLayout,
             pFrame,
@@ -22,7 +22,7 @@ namespace eyegui
         // Constructor
         DropButton(
             std::string id,
-            std::string styleName,
+            uint styleId,
             Element* pParent,
             Layout const * pLayout,
             Frame* pFrame,
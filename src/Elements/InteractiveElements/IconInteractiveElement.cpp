@@ -13,7 +13,7 @@ namespace eyegui
 {
 	IconInteractiveElement::IconInteractiveElement(
 		std::string id,
-		std::string styleName,
+		uint styleId,
 		Element* pParent,
 		Layout const * pLayout,
 		Frame* pFrame,
@@ -25,7 +25,7 @@ namespace eyegui
 		bool adaptiveScaling,
 		std::string iconFilepath) : InteractiveElement(
 			id,
-			styleName,
+			styleId,
 			pParent,
 			pLayout,
 			pFrame,
@@ -58,6 +58,7 @@ namespace eyegui
 		{
 			mpIcon = mpAssetManager->fetchTexture(graphics::Type::NOT_FOUND);
 		}
+		mDrawingChanged = true;
 	}
 
 	void IconInteractiveElement::specialDraw() const
@@ -14,7 +14,7 @@ namespace eyegui
 {
     InteractiveElement::InteractiveElement(
         std::string id,
-        std::string styleName,
+        uint styleId,
         Element* pParent,
         Layout const * pLayout,
         Frame* pFrame,
@@ -25,7 +25,7 @@ namespace eyegui
         bool dimming,
         bool adaptiveScaling) : NotifierElement(
             id,
-            styleName,
+            styleId,
             pParent,
             pLayout,
             pFrame,
@@ -43,6 +43,8 @@ namespace eyegui
         mIsHighlighted = false;
         mSelection.setValue(0);
         mIsSelected = false;
+        mDrawnHighlight = 0;
+        mDrawnSelection = 0;
     }
 
     InteractiveElement::~InteractiveElement()
@@ -96,6 +98,17 @@ namespace eyegui
         return 0;
     }
 
+    bool InteractiveElement::specialDrawingChanged()
+    {
+        // Highlight pulsates over time
+        bool changed = mHighlight.getValue() > 0
+            || mHighlight.getValue() != mDrawnHighlight
+            || mSelection.getValue() != mDrawnSelection;
+        mDrawnHighlight = mHighlight.getValue();
+        mDrawnSelection = mSelection.getValue();
+        return changed;
+    }
+
     void InteractiveElement::specialReset()
     {
         mHighlight.setValue(0);
@@ -22,7 +22,7 @@ namespace eyegui
         // Constructors
         InteractiveElement(
             std::string id,
-            std::string styleName,
+            uint styleId,
             Element* pParent,
             Layout const * pLayout,
             Frame* pFrame,
@@ -65,11 +65,20 @@ namespace eyegui
         // Interaction fill by subclasses
         virtual void specialInteract() = 0;
 
+        // Whether highlight or selection has changed since last call
+        virtual bool specialDrawingChanged();
+
         // Members
         LerpValue mHighlight;
         bool mIsHighlighted;
         LerpValue mSelection;
         bool mIsSelected;
+
+    private:
+
+        // Members
+        float mDrawnHighlight;
+        float mDrawnSelection;
     };
 }
 
@@ -16,7 +16,7 @@ namespace eyegui
 {
     Keyboard::Keyboard(
         std::string id,
-        std::string styleName,
+        uint styleId,
         Element* pParent,
         Layout const * pLayout,
         Frame* pFrame,
@@ -27,7 +27,7 @@ namespace eyegui
         bool dimming,
         bool adaptiveScaling) : InteractiveElement(
             id,
-            styleName,
+            styleId,
             pParent,
             pLayout,
             pFrame,
@@ -53,12 +53,30 @@ namespace eyegui
         mLastFastKeyColumn = -1;
         mUseFastTyping = false;
         mFastBuffer = u"";
+        mDrawnThreshold = 0;
+        mKeysChanged = true;
+        mpDisplacedSubKeymap = NULL;
 
         // Fetch render item for background
         mpBackground = mpAssetManager->fetchRenderItem(
             shaders::Type::BLOCK,
             meshes::Type::QUAD);
 
+        // Keys share one quad, drawn as instances
+        std::vector<InstanceAttribute> circleAttributes;
+        circleAttributes.push_back({ "matrixAttribute", 16 });
+        circleAttributes.push_back({ "pickAttribute", 1 });
+        circleAttributes.push_back({ "alphaAttribute", 1 });
+        std::vector<InstanceAttribute> characterAttributes;
+        characterAttributes.push_back({ "matrixAttribute", 16 });
+        characterAttributes.push_back({ "borderAttribute", 1 });
+        characterAttributes.push_back({ "atlasAttribute", 4 });
+        characterAttributes.push_back({ "alphaAttribute", 1 });
+        mupKeyCircles = mpAssetManager->createInstancedMesh(shaders::Type::KEY, meshes::Type::QUAD, circleAttributes);
+        mupKeyCharacters = mpAssetManager->createInstancedMesh(shaders::Type::CHARACTER_KEY, meshes::Type::QUAD, characterAttributes);
+        mupPressedKeyCircles = mpAssetManager->createInstancedMesh(shaders::Type::KEY, meshes::Type::QUAD, circleAttributes);
+        mupPressedKeyCharacters = mpAssetManager->createInstancedMesh(shaders::Type::CHARACTER_KEY, meshes::Type::QUAD, characterAttributes);
+
         // Create keymaps (mKeymaps)
         initKeymaps(mpLayout->getCharacterSet());
     }
@@ -85,6 +103,7 @@ namespace eyegui
                 mKeymaps[mCurrentKeymapIndex].smallKeys[mFocusedKeyRow][mFocusedKeyColumn]->setPicked(false);
                 mKeymaps[mCurrentKeymapIndex].bigKeys[mFocusedKeyRow][mFocusedKeyColumn]->setPicked(false);
             }
+            mKeysChanged = true;
         }
     }
 
@@ -100,6 +119,7 @@ namespace eyegui
             mBigCharactersActive = true;
         break;
         }
+        mKeysChanged = true;
     }
 
     uint Keyboard::getCountOfKeymaps() const
@@ -123,6 +143,27 @@ namespace eyegui
 
         // Reset state
         resetKeymapsAndState();
+        mKeysChanged = true;
+    }
+
+    void Keyboard::setDictionary(std::string filepath)
+    {
+        if (filepath == EMPTY_STRING_ATTRIBUTE)
+        {
+            mupGuesser = NULL;
+        }
+        else
+        {
+            mupGuesser = mpAssetManager->createGuesser(filepath);
+        }
+    }
+
+    void Keyboard::setWord(std::u16string word)
+    {
+        if (mupGuesser != NULL)
+        {
+            mupGuesser->setWord(word);
+        }
     }
 
     InteractiveElement* Keyboard::internalNextInteractiveElement(Element const * pChildCaller)
@@ -186,6 +227,12 @@ namespace eyegui
             pKeys = &(mKeymaps[mCurrentKeymapIndex].smallKeys);
         }
 
+        // *** SUGGESTIONS OF GUESSER ***
+        if (mupGuesser != NULL && mupGuesser->fetchSuggestions(mSuggestions))
+        {
+            mpNotificationQueue->enqueue(getId(), NotificationType::KEYBOARD_WORDS_SUGGESTED);
+        }
+
         // *** UPDATE ANIMATED PRESSED KEYES ***
         std::vector<int> dyingPressedKeys;
         for (uint i = 0; i < mPressedKeys.size(); i++)
@@ -202,28 +249,49 @@ namespace eyegui
             }
         }
 
-        // Delete dying pressed keys (go backwards through it)
+        // Move dying pressed keys to pool (go backwards through it)
         for (int i = (int)dyingPressedKeys.size()-1; i >= 0; i--)
         {
-            mPressedKeys.erase(mPressedKeys.begin() + i);
+            mPressedKeyPool.push_back(std::move(mPressedKeys[dyingPressedKeys[i]].second));
+            mPressedKeys.erase(mPressedKeys.begin() + dyingPressedKeys[i]);
         }
 
         // *** FILTER USER'S GAZE ***
-        glm::vec2 rawGazeDelta = glm::vec2(0,0);
+
+        // Go over all gaze samples since last update. Own filter is only used when GUI does not filter gaze
+        bool useOwnFilter = mpLayout->getConfig()->gazeFilterType == GazeFilterType::NONE;
+        float gazeFilterRadius = GAZE_FILTER_RADIUS * initialKeySize;
+        float gazeDeltaWeight = 1.f;
+        float gazeDeltaWeightSum = 0;
+        float gazeDurationSum = 0;
         if (pInput != NULL)
         {
-            rawGazeDelta = glm::vec2(pInput->gazeX, pInput->gazeY) - mGazePosition;
-        }
+            for (const GazeSample& rSample : mpLayout->getGazeSamples())
+            {
+                glm::vec2 rawGazeDelta = glm::vec2(rSample.gazeX, rSample.gazeY) - mGazePosition;
 
-        // Filter only, when delta is small
-        float gazeFilterRadius = GAZE_FILTER_RADIUS * initialKeySize;
-        float rawGazeFilter = std::min(1.f, glm::abs(glm::length(rawGazeDelta)) / gazeFilterRadius); // 0 when filtering and 1 when direkt usage of gaze
-        float gazeFilter = rawGazeFilter + (1.f - rawGazeFilter) * std::min(1.f, GAZE_DIRECT_USAGE_MULTIPLIER * tpf);
-        mGazePosition += gazeFilter * rawGazeDelta;
+                // Filter only, when delta is small
+                float gazeFilter = 1.f;
+                if (useOwnFilter)
+                {
+                    float rawGazeFilter = std::min(1.f, glm::abs(glm::length(rawGazeDelta)) / gazeFilterRadius); // 0 when filtering and 1 when direkt usage of gaze
+                    gazeFilter = rawGazeFilter + (1.f - rawGazeFilter) * std::min(1.f, GAZE_DIRECT_USAGE_MULTIPLIER * rSample.duration);
+                }
+                mGazePosition += gazeFilter * rawGazeDelta;
 
-        // Use gaze delta as weight for threshold (is one if low delta in gaze)
-        float gazeDelta = glm::abs(glm::length(rawGazeDelta)); // In pixels!
-        float gazeDeltaWeight = 1.f - clamp(gazeDelta / (GAZE_DELTA_WEIGHT_RADIUS * initialKeySize), 0, 1); // Key size used for normalization
+                // Use gaze delta as weight for threshold (is one if low delta in gaze), accumulated over duration of sample
+                float gazeDelta = glm::abs(glm::length(rawGazeDelta)); // In pixels!
+                gazeDeltaWeight = 1.f - clamp(gazeDelta / (GAZE_DELTA_WEIGHT_RADIUS * initialKeySize), 0, 1); // Key size used for normalization
+                gazeDeltaWeightSum += gazeDeltaWeight * rSample.duration;
+                gazeDurationSum += rSample.duration;
+            }
+        }
+
+        // Use mean weight when samples have a duration
+        if (gazeDurationSum > 0)
+        {
+            gazeDeltaWeight = gazeDeltaWeightSum / gazeDurationSum;
+        }
 
         // *** CHECK FOR PENETRATION ***
 
@@ -248,24 +316,16 @@ namespace eyegui
         // *** DETERMINE FOCUSED KEY ***
         if(penetrated)
         {
-            // Go over keys and search nearest
-            float minDistance = 1000000;
+            // Search nearest key in grid. Keys are displaced from initial position by at most a quarter of focus radius
             int newFocusedKeyRow = -1;
             int newFocusedKeyColumn = -1;
-            for(uint i = 0; i < pKeys->size(); i++)
-            {
-                for(uint j = 0; j < (*pKeys)[i].size(); j++)
-                {
-                    // Use position in keys to get position after last update
-                    float currentDistance = glm::abs(glm::distance(mGazePosition, (*pKeys)[i][j]->getPosition()));
-                    if(currentDistance < minDistance)
-                    {
-                        minDistance = currentDistance;
-                        newFocusedKeyRow = i;
-                        newFocusedKeyColumn = j;
-                    }
-                }
-            }
+            findNearestKey(
+                mKeymaps[mCurrentKeymapIndex],
+                *pKeys,
+                mGazePosition,
+                (KEY_POSITION_DELTA_MULTIPLIER * FOCUS_RADIUS * initialKeySize / 4.f) + 2.f, // Truncation to pixels included
+                newFocusedKeyRow,
+                newFocusedKeyColumn);
 
             // Set focus if necessary
             if(newFocusedKeyRow != mFocusedKeyRow || newFocusedKeyColumn != mFocusedKeyColumn)
@@ -309,42 +369,89 @@ namespace eyegui
 
         // *** UPDATE KEY POSITIONS ***
 
-        // Update keys (they have to be transformed and sized each update)
-        for(uint i = 0; i < pKeys->size(); i++)
+        // Keys of other sub keymap may have been displaced while it was active
+        if (mpDisplacedSubKeymap != pKeys)
         {
-            for(uint j = 0; j < (*pKeys)[i].size(); j++)
+            mDisplacedKeys.clear();
+            for (uint i = 0; i < pKeys->size(); i++)
             {
-                // Get delta between position of initial key position and gaze position
-                glm::vec2 positionDelta = (*pInitialKeyPositions)[i][j] - mGazePosition;
+                for (uint j = 0; j < (*pKeys)[i].size(); j++)
+                {
+                    mDisplacedKeys.push_back(glm::ivec2(i, j));
+                }
+            }
+            mpDisplacedSubKeymap = pKeys;
+        }
+
+        // Keys outside of focus radius are at initial position. Their size delta is below one pixel
+        float focusRadius = FOCUS_RADIUS * initialKeySize; // Key size used for normalization
+        for (const glm::ivec2& rKey : mDisplacedKeys)
+        {
+            const glm::vec2& rInitialPosition = (*pInitialKeyPositions)[rKey.x][rKey.y];
+            if (glm::length(rInitialPosition - mGazePosition) >= focusRadius)
+            {
+                Key* pKey = (*pKeys)[rKey.x][rKey.y].get();
+                glm::ivec2 initialPosition = (glm::ivec2)rInitialPosition;
+                if (pKey->getPosition() != (glm::vec2)initialPosition || pKey->getSize() != (int)initialKeySize)
+                {
+                    pKey->transformAndSize(initialPosition.x, initialPosition.y, (int)initialKeySize);
+                }
+            }
+        }
+
+        // Only keys in focus radius are transformed and sized
+        findKeysInRadius(mKeymaps[mCurrentKeymapIndex], mGazePosition, focusRadius, mFocusedKeys);
+        for (const glm::ivec2& rKey : mFocusedKeys)
+        {
+            int i = rKey.x;
+            int j = rKey.y;
+
+            // Get delta between position of initial key position and gaze position
+            glm::vec2 positionDelta = (*pInitialKeyPositions)[i][j] - mGazePosition;
 
-                // Radius of focus
-                float focusWeight = 1.f - glm::length(positionDelta) / (FOCUS_RADIUS * initialKeySize); // Key size used for normalization
-                focusWeight = clamp(focusWeight, 0, 1);
+            // Radius of focus
+            float focusWeight = 1.f - glm::length(positionDelta) / focusRadius;
+            focusWeight = clamp(focusWeight, 0, 1);
 
-                // Only near keys have to be moved
-                positionDelta *= focusWeight;
-                positionDelta *= KEY_POSITION_DELTA_MULTIPLIER;
+            // Only near keys have to be moved
+            positionDelta *= focusWeight;
+            positionDelta *= KEY_POSITION_DELTA_MULTIPLIER;
 
-                // Calculate delta of size
-                float sizeDelta = initialKeySize - glm::length((*pKeys)[i][j]->getPosition() - mGazePosition);
-                sizeDelta = (1.f - focusWeight) + sizeDelta * focusWeight;
-                sizeDelta = std::max(-(1.f - MINIMAL_KEY_SIZE) * initialKeySize, sizeDelta); // Subtracted from initial size
-                sizeDelta *= KEY_SIZE_DELTA_MULTIPLIER;
+            // Calculate delta of size
+            float sizeDelta = initialKeySize - glm::length((*pKeys)[i][j]->getPosition() - mGazePosition);
+            sizeDelta = (1.f - focusWeight) + sizeDelta * focusWeight;
+            sizeDelta = std::max(-(1.f - MINIMAL_KEY_SIZE) * initialKeySize, sizeDelta); // Subtracted from initial size
+            sizeDelta *= KEY_SIZE_DELTA_MULTIPLIER;
 
-                // Weight with threshold
-                positionDelta *= mThreshold.getValue();
-                sizeDelta *= mThreshold.getValue();
+            // Weight with threshold
+            positionDelta *= mThreshold.getValue();
+            sizeDelta *= mThreshold.getValue();
 
-                // Calc stuff for key
-                int keyPositionX = (int)((*pInitialKeyPositions)[i][j].x + positionDelta.x);
-                int keyPositionY = (int)((*pInitialKeyPositions)[i][j].y + positionDelta.y);
-                int keySize = (int)(initialKeySize + sizeDelta);
+            // Calc stuff for key
+            int keyPositionX = (int)((*pInitialKeyPositions)[i][j].x + positionDelta.x);
+            int keyPositionY = (int)((*pInitialKeyPositions)[i][j].y + positionDelta.y);
+            int keySize = (int)(initialKeySize + sizeDelta);
 
-                // Transform and size
-                (*pKeys)[i][j]->transformAndSize(keyPositionX, keyPositionY, keySize);
+            // Transform and size
+            (*pKeys)[i][j]->transformAndSize(keyPositionX, keyPositionY, keySize);
+        }
+
+        // Keys in focus radius have to be checked at next update
+        mDisplacedKeys.swap(mFocusedKeys);
 
+        // Update keys
+        for(uint i = 0; i < pKeys->size(); i++)
+        {
+            for(uint j = 0; j < (*pKeys)[i].size(); j++)
+            {
                 // Updating
+                float focus = (*pKeys)[i][j]->getFocusValue();
+                float pick = (*pKeys)[i][j]->getPickValue();
                 (*pKeys)[i][j]->update(tpf);
+                if (focus != (*pKeys)[i][j]->getFocusValue() || pick != (*pKeys)[i][j]->getPickValue())
+                {
+                    mKeysChanged = true;
+                }
 
                 // Check for "key pressed"
                 if(!mKeyWasPressed && mThreshold.getValue() >= 1.f && (*pKeys)[i][j]->isFocused())
@@ -353,9 +460,9 @@ namespace eyegui
                     if(
                         glm::abs(
                             glm::distance(
-                                glm::vec2(keyPositionX, keyPositionY),
+                                (*pKeys)[i][j]->getPosition(),
                                 mGazePosition))
-                        < keySize / 2)
+                        < (*pKeys)[i][j]->getSize() / 2)
                     {
                         // Get value of pressed key
                         std::u16string pressedValue = (*pKeys)[i][j]->getValue();
@@ -388,8 +495,25 @@ namespace eyegui
                         // Inform listener after updating
                         mpNotificationQueue->enqueue(getId(), NotificationType::KEYBOARD_KEY_PRESSED);
 
-                        // Add pressed key for nice animation
-                        std::unique_ptr<Key> upPressedKey = std::unique_ptr<Key>(new CharacterKey(*(CharacterKey*)((*pKeys)[i][j].get())));
+                        // Guess word in background
+                        if (mupGuesser != NULL)
+                        {
+                            mupGuesser->type(mLastPressedKeyValue);
+                        }
+
+                        // Add pressed key for nice animation, reuse faded one if available
+                        CharacterKey const * pPressedKey = (CharacterKey const *)((*pKeys)[i][j].get());
+                        std::unique_ptr<Key> upPressedKey;
+                        if (mPressedKeyPool.empty())
+                        {
+                            upPressedKey = std::unique_ptr<Key>(new CharacterKey(*pPressedKey));
+                        }
+                        else
+                        {
+                            upPressedKey = std::move(mPressedKeyPool.back());
+                            mPressedKeyPool.pop_back();
+                            *((CharacterKey*)upPressedKey.get()) = *pPressedKey;
+                        }
                         upPressedKey->transformAndSize();
                         mPressedKeys.push_back(PressedKey(1.f, std::move(upPressedKey)));
                     }
@@ -431,52 +555,73 @@ namespace eyegui
             pSubKeymap = &(mKeymaps[mCurrentKeymapIndex].smallKeys);
         }
 
-        // Draw the sub keymap
+        // Collect instances of the sub keymap, count of keys rarely changes
+        std::vector<float> circleInstances;
+        std::vector<float> characterInstances;
+        circleInstances.reserve(mupKeyCircles->getValueCount());
+        characterInstances.reserve(mupKeyCharacters->getValueCount());
         for(const auto& rLine : *pSubKeymap)
         {
             for(const auto& rupKey : rLine)
             {
-                rupKey->draw(
-                    mX,
-                    mY,
-                    mWidth,
-                    mHeight,
-                    getStyle()->color,
-                    getStyle()->pickColor,
-                    getStyle()->iconColor,
-                    mActivity.getValue(),
-                    getStyle()->dimColor,
-                    mDim.getValue(),
-                    getStyle()->markColor,
-                    mMark.getValue(),
-                    getStyle()->highlightColor,
-                    mHighlight.getValue(),
-                    mAlpha);
+                rupKey->addInstances(circleInstances, characterInstances, mAlpha);
             }
         }
+        drawKeys(mupKeyCircles.get(), mupKeyCharacters.get(), std::move(circleInstances), std::move(characterInstances));
 
         // Render animation of pressed keys
-        for (const auto& rPressedKey : mPressedKeys)
-        {
-            rPressedKey.second->draw(
-                mX,
-                mY,
-                mWidth,
-                mHeight,
-                getStyle()->color,
-                getStyle()->pickColor,
-                getStyle()->iconColor,
-                mActivity.getValue(),
-                getStyle()->dimColor,
-                mDim.getValue(),
-                getStyle()->markColor,
-                mMark.getValue(),
-                getStyle()->highlightColor,
-                mHighlight.getValue(),
-                mAlpha * rPressedKey.first);
+        if (!mPressedKeys.empty())
+        {
+            std::vector<float> pressedCircleInstances;
+            std::vector<float> pressedCharacterInstances;
+            for (const auto& rPressedKey : mPressedKeys)
+            {
+                rPressedKey.second->addInstances(pressedCircleInstances, pressedCharacterInstances, mAlpha * rPressedKey.first);
+            }
+            drawKeys(mupPressedKeyCircles.get(), mupPressedKeyCharacters.get(), std::move(pressedCircleInstances), std::move(pressedCharacterInstances));
         }
     }
 
+    void Keyboard::drawKeys(InstancedMesh* pCircles, InstancedMesh* pCharacters, std::vector<float> circleInstances, std::vector<float> characterInstances) const
+    {
+        // Stencil in OpenGL coordinate system
+        glm::vec4 stencil(mX, mpLayout->getLayoutHeight() - mY - mHeight, mWidth, mHeight);
+
+        // Circles of all keys
+        pCircles->setInstances(std::move(circleInstances));
+        pCircles->bind();
+        Shader const * pShader = pCircles->getShader();
+        pShader->fillValue("color", getStyle()->color);
+        pShader->fillValue("time", mpLayout->getAccPeriodicTime());
+        pShader->fillValue("pickColor", getStyle()->pickColor);
+        pShader->fillValue("stencil", stencil);
+        pShader->fillValue("activity", mActivity.getValue());
+        pShader->fillValue("dimColor", getStyle()->dimColor);
+        pShader->fillValue("dim", mDim.getValue());
+        pShader->fillValue("markColor", getStyle()->markColor);
+        pShader->fillValue("mark", mMark.getValue());
+        pShader->fillValue("highlightColor", getStyle()->highlightColor);
+        pShader->fillValue("highlight", mHighlight.getValue());
+        pCircles->draw();
+
+        // Characters of all keys, which share one atlas
+        pCharacters->setInstances(std::move(characterInstances));
+        pCharacters->bind();
+        mpAssetManager->getDefaultFont()->bindAtlasTexture(FontSize::KEYBOARD, 0, true);
+        pShader = pCharacters->getShader();
+        pShader->fillValue("color", getStyle()->iconColor);
+        pShader->fillValue("time", mpLayout->getAccPeriodicTime());
+        pShader->fillValue("stencil", stencil);
+        pShader->fillValue("activity", mActivity.getValue());
+        pShader->fillValue("dimColor", getStyle()->dimColor);
+        pShader->fillValue("dim", mDim.getValue());
+        pShader->fillValue("markColor", getStyle()->markColor);
+        pShader->fillValue("mark", mMark.getValue());
+        pShader->fillValue("highlightColor", getStyle()->highlightColor);
+        pShader->fillValue("highlight", mHighlight.getValue());
+        pCharacters->draw();
+    }
+
     void Keyboard::specialTransformAndSize()
     {
         // Sets initial key size and position on all keymaps and their submaps
@@ -540,6 +685,9 @@ namespace eyegui
                     rKeymap.bigKeys[i][j]->transformAndSize(pos.x, pos.y, (int)(rKeymap.initialKeySize));
                 }
             }
+
+            // Grid for searching keys near to gaze
+            buildKeyGrid(rKeymap);
         }
     }
 
@@ -550,9 +698,14 @@ namespace eyegui
 
         mFocusPosition = glm::vec2(0,0);
         mGazePosition = glm::vec2(0,0);
+        for (auto& rPressedKey : mPressedKeys)
+        {
+            mPressedKeyPool.push_back(std::move(rPressedKey.second));
+        }
         mPressedKeys.clear();
 
         resetKeymapsAndState();
+        mKeysChanged = true;
 
         // Following should be probably not reset
         // mCurrentKeymapIndex = 0;
@@ -568,6 +721,7 @@ namespace eyegui
     {
         // Has to be declared here, otherwise Visual Studio does not compile...
         std::string lastPressedKeyValue8;
+        std::vector<std::string> suggestions8;
 
         // Pipe notifications to notifier template including own data
         switch (notification)
@@ -583,6 +737,21 @@ namespace eyegui
             // Notify listener method with UTF-8 string
             notifyListener(&KeyboardListener::keyPressed, pLayout, getId(), lastPressedKeyValue8);
             break;
+        case NotificationType::KEYBOARD_WORDS_SUGGESTED:
+
+            // Notify listener method with UTF-16 strings
+            notifyListener(&KeyboardListener::wordsSuggested, pLayout, getId(), mSuggestions);
+
+            // Convert suggestions to UTF-8 strings
+            for (const std::u16string& rSuggestion : mSuggestions)
+            {
+                suggestions8.push_back(std::string());
+                utf8::utf16to8(rSuggestion.begin(), rSuggestion.end(), back_inserter(suggestions8.back()));
+            }
+
+            // Notify listener method with UTF-8 strings
+            notifyListener(&KeyboardListener::wordsSuggested, pLayout, getId(), suggestions8);
+            break;
         default:
             throwWarning(
                 OperationNotifier::Operation::BUG,
@@ -591,6 +760,19 @@ namespace eyegui
         }
     }
 
+    bool Keyboard::specialDrawingChanged()
+    {
+        // Keys follow gaze as long as threshold is above zero and pressed keys fade out
+        bool changed = InteractiveElement::specialDrawingChanged()
+            || mKeysChanged
+            || mThreshold.getValue() != mDrawnThreshold
+            || mThreshold.getValue() > 0
+            || !mPressedKeys.empty();
+        mDrawnThreshold = mThreshold.getValue();
+        mKeysChanged = false;
+        return changed;
+    }
+
     void Keyboard::initKeymaps(CharacterSet set)
     {
 
@@ -725,4 +907,141 @@ namespace eyegui
             }
         }
     }
+
+    void Keyboard::buildKeyGrid(Keymap& rKeymap) const
+    {
+        KeyGrid& rGrid = rKeymap.grid;
+
+        // Bounding box of initial key positions
+        glm::vec2 minimum = glm::vec2(0, 0);
+        glm::vec2 maximum = glm::vec2(0, 0);
+        bool first = true;
+        for (const auto& rLine : rKeymap.initialKeyPositions)
+        {
+            for (const glm::vec2& rPosition : rLine)
+            {
+                minimum = first ? rPosition : glm::min(minimum, rPosition);
+                maximum = first ? rPosition : glm::max(maximum, rPosition);
+                first = false;
+            }
+        }
+
+        // About one key per cell
+        rGrid.origin = minimum;
+        rGrid.cellSize = std::max(1.f, rKeymap.initialKeySize);
+        rGrid.columns = (int)((maximum.x - minimum.x) / rGrid.cellSize) + 1;
+        rGrid.rows = (int)((maximum.y - minimum.y) / rGrid.cellSize) + 1;
+
+        // Count keys per cell
+        std::vector<int> cellIndices;
+        rGrid.cellStarts.assign(rGrid.columns * rGrid.rows + 1, 0);
+        for (const auto& rLine : rKeymap.initialKeyPositions)
+        {
+            for (const glm::vec2& rPosition : rLine)
+            {
+                int column = std::min(rGrid.columns - 1, (int)((rPosition.x - rGrid.origin.x) / rGrid.cellSize));
+                int row = std::min(rGrid.rows - 1, (int)((rPosition.y - rGrid.origin.y) / rGrid.cellSize));
+                cellIndices.push_back(row * rGrid.columns + column);
+                rGrid.cellStarts[cellIndices.back() + 1]++;
+            }
+        }
+        for (uint i = 1; i < rGrid.cellStarts.size(); i++)
+        {
+            rGrid.cellStarts[i] += rGrid.cellStarts[i - 1];
+        }
+
+        // Sort keys into cells, in order of rows and columns of keymap
+        std::vector<uint> fill(rGrid.cellStarts.begin(), rGrid.cellStarts.end() - 1);
+        rGrid.keys.resize(cellIndices.size());
+        uint index = 0;
+        for (uint i = 0; i < rKeymap.initialKeyPositions.size(); i++)
+        {
+            for (uint j = 0; j < rKeymap.initialKeyPositions[i].size(); j++)
+            {
+                rGrid.keys[fill[cellIndices[index++]]++] = glm::ivec2(i, j);
+            }
+        }
+    }
+
+    void Keyboard::findNearestKey(const Keymap& rKeymap, const SubKeymap& rKeys, glm::vec2 position, float maxDisplacement, int& rRow, int& rColumn) const
+    {
+        const KeyGrid& rGrid = rKeymap.grid;
+        rRow = -1;
+        rColumn = -1;
+        float minDistance = 0;
+
+        // Cell of position, which may be outside of grid
+        int centerColumn = (int)std::floor((position.x - rGrid.origin.x) / rGrid.cellSize);
+        int centerRow = (int)std::floor((position.y - rGrid.origin.y) / rGrid.cellSize);
+        int maxRing = std::max(
+            std::max(std::abs(centerColumn), std::abs(centerColumn - (rGrid.columns - 1))),
+            std::max(std::abs(centerRow), std::abs(centerRow - (rGrid.rows - 1))));
+
+        // Go over rings of cells around position, until remaining keys cannot be nearer
+        for (int ring = 0; ring <= maxRing; ring++)
+        {
+            if (rRow >= 0 && ((ring - 1) * rGrid.cellSize) - maxDisplacement > minDistance)
+            {
+                break;
+            }
+
+            int firstRow = std::max(0, centerRow - ring);
+            int lastRow = std::min(rGrid.rows - 1, centerRow + ring);
+            for (int row = firstRow; row <= lastRow; row++)
+            {
+                // Inner rows of ring only have cells at both sides
+                bool fullRow = std::abs(row - centerRow) == ring;
+                int step = fullRow ? 1 : std::max(1, 2 * ring);
+                for (int column = centerColumn - ring; column <= centerColumn + ring; column += step)
+                {
+                    if (column < 0 || column >= rGrid.columns)
+                    {
+                        continue;
+                    }
+                    int cell = row * rGrid.columns + column;
+                    for (uint k = rGrid.cellStarts[cell]; k < rGrid.cellStarts[cell + 1]; k++)
+                    {
+                        // Use position in keys to get position after last update. Ties go to first key in keymap
+                        const glm::ivec2& rKey = rGrid.keys[k];
+                        float distance = glm::abs(glm::distance(position, rKeys[rKey.x][rKey.y]->getPosition()));
+                        if (rRow < 0
+                            || distance < minDistance
+                            || (distance == minDistance && (rKey.x < rRow || (rKey.x == rRow && rKey.y < rColumn))))
+                        {
+                            minDistance = distance;
+                            rRow = rKey.x;
+                            rColumn = rKey.y;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void Keyboard::findKeysInRadius(const Keymap& rKeymap, glm::vec2 position, float radius, std::vector<glm::ivec2>& rKeys) const
+    {
+        const KeyGrid& rGrid = rKeymap.grid;
+        rKeys.clear();
+
+        // Only cells overlapping square around radius are visited
+        int firstColumn = std::max(0, (int)std::floor((position.x - radius - rGrid.origin.x) / rGrid.cellSize));
+        int lastColumn = std::min(rGrid.columns - 1, (int)std::floor((position.x + radius - rGrid.origin.x) / rGrid.cellSize));
+        int firstRow = std::max(0, (int)std::floor((position.y - radius - rGrid.origin.y) / rGrid.cellSize));
+        int lastRow = std::min(rGrid.rows - 1, (int)std::floor((position.y + radius - rGrid.origin.y) / rGrid.cellSize));
+        for (int row = firstRow; row <= lastRow; row++)
+        {
+            for (int column = firstColumn; column <= lastColumn; column++)
+            {
+                int cell = row * rGrid.columns + column;
+                for (uint k = rGrid.cellStarts[cell]; k < rGrid.cellStarts[cell + 1]; k++)
+                {
+                    const glm::ivec2& rKey = rGrid.keys[k];
+                    if (glm::length(rKeymap.initialKeyPositions[rKey.x][rKey.y] - position) < radius)
+                    {
+                        rKeys.push_back(rKey);
+                    }
+                }
+            }
+        }
+    }
 }
@@ -12,6 +12,8 @@
 #include "src/Elements/InteractiveElements/InteractiveElement.h"
 #include "src/Elements/NotifierTemplate.h"
 #include "src/Utilities/LerpValue.h"
+#include "src/Rendering/InstancedMesh.h"
+#include "src/Guesser.h"
 #include "externals/GLM/glm/glm.hpp"
 
 #include <vector>
@@ -28,7 +30,7 @@ namespace eyegui
         // Constructor
         Keyboard(
             std::string id,
-            std::string styleName,
+            uint styleId,
             Element* pParent,
             Layout const * pLayout,
             Frame* pFrame,
@@ -54,6 +56,12 @@ namespace eyegui
         // Set displayed keymap by index
         void setKeymap(uint keymapIndex);
 
+        // Set dictionary used to suggest words, empty path removes it
+        void setDictionary(std::string filepath);
+
+        // Set word completed by suggestions
+        void setWord(std::u16string word);
+
         // Tries to fetch next interactive element for selecting, returns NULL if fails
         virtual InteractiveElement* internalNextInteractiveElement(Element const * pChildCaller);
 
@@ -77,6 +85,9 @@ namespace eyegui
         // Filled by subclass and called by layout after updating and before drawing
         virtual void specialPipeNotification(NotificationType notification, Layout* pLayout);
 
+        // Whether keys have changed since last call
+        virtual bool specialDrawingChanged();
+
     private:
 
         // Typedefs
@@ -84,6 +95,17 @@ namespace eyegui
         typedef std::vector<std::vector<std::unique_ptr<Key> > > SubKeymap; // Sub keymap (only used to hold either small or big versions of characters
         typedef std::vector<std::vector<glm::vec2> > PositionMap; // Positions of keys in keymap
 
+        // Uniform grid over initial key positions, cells have size of a key
+        struct KeyGrid
+        {
+            glm::vec2 origin;
+            float cellSize;
+            int columns;
+            int rows;
+            std::vector<uint> cellStarts; // index of first key of each cell, one more than count of cells
+            std::vector<glm::ivec2> keys; // row and column of keys ordered by cell
+        };
+
         // Struct for keymap which holds sub keymaps of small and big letters
         struct Keymap
         {
@@ -91,6 +113,7 @@ namespace eyegui
             SubKeymap bigKeys;
             PositionMap initialKeyPositions;
             float initialKeySize;
+            KeyGrid grid;
         };
 
         // Struct for pairs of small and big characters used to initialize the keyboard
@@ -127,8 +150,24 @@ namespace eyegui
         // Reset keymaps
         void resetKeymapsAndState();
 
+        // Build grid of keymap from initial key positions
+        void buildKeyGrid(Keymap& rKeymap) const;
+
+        // Find key nearest to position, using positions of keys which differ at most by displacement from initial ones
+        void findNearestKey(const Keymap& rKeymap, const SubKeymap& rKeys, glm::vec2 position, float maxDisplacement, int& rRow, int& rColumn) const;
+
+        // Collect keys whose initial position is nearer to position than radius
+        void findKeysInRadius(const Keymap& rKeymap, glm::vec2 position, float radius, std::vector<glm::ivec2>& rKeys) const;
+
+        // Record drawing of circles and characters of keys given as instances
+        void drawKeys(InstancedMesh* pCircles, InstancedMesh* pCharacters, std::vector<float> circleInstances, std::vector<float> characterInstances) const;
+
         // Members
         RenderItem const * mpBackground;
+        std::unique_ptr<InstancedMesh> mupKeyCircles;
+        std::unique_ptr<InstancedMesh> mupKeyCharacters;
+        std::unique_ptr<InstancedMesh> mupPressedKeyCircles; // pressed keys are drawn on top of the others
+        std::unique_ptr<InstancedMesh> mupPressedKeyCharacters;
         LerpValue mThreshold;
         int mFocusedKeyRow;
         int mFocusedKeyColumn;
@@ -137,6 +176,7 @@ namespace eyegui
         std::u16string mLastPressedKeyValue;
         bool mKeyWasPressed;
         std::vector<PressedKey> mPressedKeys;  // Alpha [0..1] and copy of key
+        std::vector<std::unique_ptr<Key> > mPressedKeyPool; // faded copies reused by next pressed keys
         bool mUseFastTyping;
         std::u16string mFastBuffer;
         std::vector<Keymap> mKeymaps;
@@ -144,6 +184,13 @@ namespace eyegui
         bool mBigCharactersActive;
         int mLastFastKeyRow;
         int mLastFastKeyColumn;
+        float mDrawnThreshold;
+        bool mKeysChanged;
+        std::vector<glm::ivec2> mFocusedKeys; // keys in focus radius, kept to reuse memory
+        std::vector<glm::ivec2> mDisplacedKeys; // keys which may not be at their initial transformation
+        SubKeymap const * mpDisplacedSubKeymap; // sub keymap of displaced keys
+        std::unique_ptr<Guesser> mupGuesser; // only available with dictionary
+        std::vector<std::u16string> mSuggestions;
     };
 }
 
@@ -16,7 +16,7 @@ namespace eyegui
 {
     Sensor::Sensor(
         std::string id,
-        std::string styleName,
+        uint styleId,
         Element* pParent,
         Layout const * pLayout,
         Frame* pFrame,
@@ -28,7 +28,7 @@ namespace eyegui
         bool adaptiveScaling,
         std::string iconFilepath) : IconInteractiveElement(
             id,
-            styleName,
+            styleId,
             pParent,
             pLayout,
             pFrame,
@@ -46,6 +46,7 @@ namespace eyegui
             shaders::Type::SENSOR,
             meshes::Type::QUAD);
         mPenetration.setValue(0);
+        mDrawnPenetration = 0;
     }
 
     Sensor::~Sensor()
@@ -67,20 +68,22 @@ namespace eyegui
         // Super call
         IconInteractiveElement::specialUpdate(tpf, pInput);
 
-        // Penetration by input
-        bool penetrated = penetratedByInput(pInput);
-        if (penetrated)
+        // Penetration by every gaze sample since last update
+        for (const GazeSample& rSample : mpLayout->getGazeSamples())
         {
-            // Remove highlight
-            highlight(false);
-
-            // Update of value
-            mPenetration.update(tpf / mpLayout->getConfig()->sensorPenetrationIncreaseDuration);
-        }
-        else
-        {
-            // Update of value
-            mPenetration.update(-tpf / mpLayout->getConfig()->sensorPenetrationDecreaseDuration);
+            if (penetratedBySample(pInput, rSample))
+            {
+                // Remove highlight
+                highlight(false);
+
+                // Update of value
+                mPenetration.update(rSample.duration / mpLayout->getConfig()->sensorPenetrationIncreaseDuration);
+            }
+            else
+            {
+                // Update of value
+                mPenetration.update(-rSample.duration / mpLayout->getConfig()->sensorPenetrationDecreaseDuration);
+            }
         }
 
         // Inform listener after updating when penetrated
@@ -143,4 +146,13 @@ namespace eyegui
             break;
         }
     }
+
+    bool Sensor::specialDrawingChanged()
+    {
+        // Super call first, so it remembers its values
+        bool changed = IconInteractiveElement::specialDrawingChanged()
+            || mPenetration.getValue() != mDrawnPenetration;
+        mDrawnPenetration = mPenetration.getValue();
+        return changed;
+    }
 }
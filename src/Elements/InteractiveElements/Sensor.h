@@ -21,7 +21,7 @@ namespace eyegui
         // Constructor
         Sensor(
             std::string id,
-            std::string styleName,
+            uint styleId,
             Element* pParent,
             Layout const * pLayout,
             Frame* pFrame,
@@ -59,10 +59,14 @@ namespace eyegui
         // Filled by subclass and called by layout after updating and before drawing
         virtual void specialPipeNotification(NotificationType notification, Layout* pLayout);
 
+        // Whether penetration has changed since last call
+        virtual bool specialDrawingChanged();
+
     private:
 
         // Members
         LerpValue mPenetration; // [0..1]
+        float mDrawnPenetration;
     };
 }
 
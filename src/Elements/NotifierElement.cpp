@@ -11,7 +11,7 @@ namespace eyegui
 {
     NotifierElement::NotifierElement(
         std::string id,
-        std::string styleName,
+        uint styleId,
         Element* pParent,
         Layout const * pLayout,
         Frame* pFrame,
@@ -22,7 +22,7 @@ namespace eyegui
         bool dimming,
         bool adaptiveScaling) : Element(
             id,
-            styleName,
+            styleId,
             pParent,
             pLayout,
             pFrame,
@@ -21,7 +21,7 @@
 namespace eyegui
 {
     // Ugly enumeration, but somehow layout must remember to call correct notification
-    enum class NotificationType { BUTTON_HIT, BUTTON_DOWN, BUTTON_UP, SENSOR_PENETRATED, KEYBOARD_KEY_PRESSED};
+    enum class NotificationType { BUTTON_HIT, BUTTON_DOWN, BUTTON_UP, SENSOR_PENETRATED, KEYBOARD_KEY_PRESSED, KEYBOARD_WORDS_SUGGESTED};
 
     template <class T>
     class NotifierTemplate
@@ -123,6 +123,30 @@ namespace eyegui
             }
         }
 
+        // Notify listener about something (one need to know which method to call from listener)
+        void notifyListener(
+            void (T::*method) (Layout*, std::string, std::vector<std::u16string>),
+            Layout* pLayout, std::string id, const std::vector<std::u16string>& rValues)
+        {
+            // Inform listener
+            for (std::shared_ptr<T>& spListener : getListener())
+            {
+                (spListener.get()->*method)(pLayout, id, rValues);
+            }
+        }
+
+        // Notify listener about something (one need to know which method to call from listener)
+        void notifyListener(
+            void (T::*method) (Layout*, std::string, std::vector<std::string>),
+            Layout* pLayout, std::string id, const std::vector<std::string>& rValues)
+        {
+            // Inform listener
+            for (std::shared_ptr<T>& spListener : getListener())
+            {
+                (spListener.get()->*method)(pLayout, id, rValues);
+            }
+        }
+
     private:
 
         // Helper for notifications (shared pointer somehow expensive)
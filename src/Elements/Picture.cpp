@@ -11,7 +11,7 @@ namespace eyegui
 {
     Picture::Picture(
         std::string id,
-        std::string styleName,
+        uint styleId,
         Element* pParent,
         Layout const * pLayout,
         Frame* pFrame,
@@ -24,7 +24,7 @@ namespace eyegui
         std::string filepath,
         ImageAlignment alignment) : Element(
             id,
-            styleName,
+            styleId,
             pParent,
             pLayout,
             pFrame,
@@ -93,4 +93,10 @@ namespace eyegui
     {
         return true;
     }
+
+    bool Picture::isLayerCacheable() const
+    {
+        // Image does not change over time
+        return true;
+    }
 }
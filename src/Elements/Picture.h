@@ -20,7 +20,7 @@ namespace eyegui
         // Constructors
         Picture(
             std::string id,
-            std::string styleName,
+            uint styleId,
             Element* pParent,
             Layout const * pLayout,
             Frame* pFrame,
@@ -60,6 +60,9 @@ namespace eyegui
         // Implemented by subclasses
         virtual bool mayConsumeInput();
 
+        // Drawing depends only on state
+        virtual bool isLayerCacheable() const;
+
     private:
 
         // Members
@@ -0,0 +1,60 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "FixationGazeFilter.h"
+
+#include "GUI.h"
+
+#include <algorithm>
+
+namespace eyegui
+{
+    FixationGazeFilter::FixationGazeFilter(GUI const * pGUI) : GazeFilter(pGUI)
+    {
+        reset();
+    }
+
+    FixationGazeFilter::~FixationGazeFilter()
+    {
+        // Nothing to do
+    }
+
+    void FixationGazeFilter::filter(std::vector<GazeSample>& rSamples)
+    {
+        // Radius is relative to smaller side of GUI
+        float radius = mpGUI->getConfig()->gazeFilterFixationRadius
+            * (float)std::min(mpGUI->getWindowWidth(), mpGUI->getWindowHeight());
+        float squaredRadius = radius * radius;
+
+        for (GazeSample& rSample : rSamples)
+        {
+            glm::vec2 delta = glm::vec2(rSample.gazeX, rSample.gazeY) - mCenter;
+
+            if (mCount > 0 && glm::dot(delta, delta) <= squaredRadius)
+            {
+                // Still inside of fixation, update running mean
+                mCount++;
+                mCenter += delta / (float)mCount;
+            }
+            else
+            {
+                // Saccade, start new fixation
+                mCenter = glm::vec2(rSample.gazeX, rSample.gazeY);
+                mCount = 1;
+            }
+
+            rSample.gazeX = mCenter.x;
+            rSample.gazeY = mCenter.y;
+        }
+    }
+
+    void FixationGazeFilter::reset()
+    {
+        mCenter = glm::vec2(0, 0);
+        mCount = 0;
+    }
+}
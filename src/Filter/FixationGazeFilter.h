@@ -0,0 +1,43 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Dispersion based fixation filter. As long as samples stay within radius
+// around the center of the current fixation, the mean of the fixation is
+// returned. Leaving the radius counts as saccade and starts a new fixation.
+
+#ifndef FIXATION_GAZE_FILTER_H_
+#define FIXATION_GAZE_FILTER_H_
+
+#include "GazeFilter.h"
+#include "externals/GLM/glm/glm.hpp"
+
+namespace eyegui
+{
+    class FixationGazeFilter : public GazeFilter
+    {
+    public:
+
+        // Constructor
+        FixationGazeFilter(GUI const * pGUI);
+
+        // Destructor
+        virtual ~FixationGazeFilter();
+
+        // Filter samples in place
+        virtual void filter(std::vector<GazeSample>& rSamples);
+
+        // Forget about previous samples
+        virtual void reset();
+
+    private:
+
+        // Members
+        glm::vec2 mCenter;
+        int mCount;
+    };
+}
+
+#endif // FIXATION_GAZE_FILTER_H_
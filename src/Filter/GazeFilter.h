@@ -0,0 +1,46 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Abstract base class of gaze filters. GUI filters all gaze samples of one
+// update as batch before elements are updated, so every element works on the
+// same filtered gaze. Parameters are read from config at each batch.
+
+#ifndef GAZE_FILTER_H_
+#define GAZE_FILTER_H_
+
+#include "src/Utilities/GazeSampleBuffer.h"
+
+#include <vector>
+
+namespace eyegui
+{
+    // Forward declaration
+    class GUI;
+
+    class GazeFilter
+    {
+    public:
+
+        // Constructor
+        GazeFilter(GUI const * pGUI);
+
+        // Destructor
+        virtual ~GazeFilter() = 0;
+
+        // Filter samples in place
+        virtual void filter(std::vector<GazeSample>& rSamples) = 0;
+
+        // Forget about previous samples
+        virtual void reset() = 0;
+
+    protected:
+
+        // Members
+        GUI const * mpGUI;
+    };
+}
+
+#endif // GAZE_FILTER_H_
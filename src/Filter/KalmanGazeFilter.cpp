@@ -0,0 +1,80 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "KalmanGazeFilter.h"
+
+#include "GUI.h"
+
+namespace eyegui
+{
+    KalmanGazeFilter::KalmanGazeFilter(GUI const * pGUI) : GazeFilter(pGUI)
+    {
+        reset();
+    }
+
+    KalmanGazeFilter::~KalmanGazeFilter()
+    {
+        // Nothing to do
+    }
+
+    void KalmanGazeFilter::filter(std::vector<GazeSample>& rSamples)
+    {
+        // Get parameters from config
+        float processNoise = mpGUI->getConfig()->gazeFilterKalmanProcessNoise;
+        float measurementNoise = mpGUI->getConfig()->gazeFilterKalmanMeasurementNoise;
+
+        for (GazeSample& rSample : rSamples)
+        {
+            glm::vec2 measurement = glm::vec2(rSample.gazeX, rSample.gazeY);
+
+            if (!mInitialized)
+            {
+                // First sample is taken as it is
+                mPosition = measurement;
+                mVelocity = glm::vec2(0, 0);
+                mPositionVariance = measurementNoise;
+                mCovariance = 0;
+                mVelocityVariance = processNoise;
+                mInitialized = true;
+            }
+            else
+            {
+                float dt = rSample.duration;
+
+                // Predict
+                mPosition += dt * mVelocity;
+                mPositionVariance += dt * (2.0f * mCovariance + dt * mVelocityVariance) + processNoise * dt * dt * dt / 3.0f;
+                mCovariance += dt * mVelocityVariance + processNoise * dt * dt / 2.0f;
+                mVelocityVariance += processNoise * dt;
+
+                // Correct
+                float innovationVariance = mPositionVariance + measurementNoise;
+                float positionGain = mPositionVariance / innovationVariance;
+                float velocityGain = mCovariance / innovationVariance;
+                glm::vec2 innovation = measurement - mPosition;
+                mPosition += positionGain * innovation;
+                mVelocity += velocityGain * innovation;
+                mVelocityVariance -= velocityGain * mCovariance;
+                mCovariance -= positionGain * mCovariance;
+                mPositionVariance -= positionGain * mPositionVariance;
+            }
+
+            rSample.gazeX = mPosition.x;
+            rSample.gazeY = mPosition.y;
+        }
+    }
+
+    void KalmanGazeFilter::reset()
+    {
+        mInitialized = false;
+        mPosition = glm::vec2(0, 0);
+        mVelocity = glm::vec2(0, 0);
+        mPositionVariance = 0;
+        mCovariance = 0;
+        mVelocityVariance = 0;
+    }
+}
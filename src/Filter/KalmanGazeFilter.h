@@ -0,0 +1,46 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Kalman filter with constant velocity model. Both axes use the same model
+// and noise, so they share one covariance matrix and are filtered at once.
+
+#ifndef KALMAN_GAZE_FILTER_H_
+#define KALMAN_GAZE_FILTER_H_
+
+#include "GazeFilter.h"
+#include "externals/GLM/glm/glm.hpp"
+
+namespace eyegui
+{
+    class KalmanGazeFilter : public GazeFilter
+    {
+    public:
+
+        // Constructor
+        KalmanGazeFilter(GUI const * pGUI);
+
+        // Destructor
+        virtual ~KalmanGazeFilter();
+
+        // Filter samples in place
+        virtual void filter(std::vector<GazeSample>& rSamples);
+
+        // Forget about previous samples
+        virtual void reset();
+
+    private:
+
+        // Members
+        bool mInitialized;
+        glm::vec2 mPosition;
+        glm::vec2 mVelocity;
+        float mPositionVariance;
+        float mCovariance;
+        float mVelocityVariance;
+    };
+}
+
+#endif // KALMAN_GAZE_FILTER_H_
@@ -0,0 +1,72 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "OneEuroGazeFilter.h"
+
+#include "GUI.h"
+#include "externals/GLM/glm/gtc/constants.hpp"
+
+namespace eyegui
+{
+    OneEuroGazeFilter::OneEuroGazeFilter(GUI const * pGUI) : GazeFilter(pGUI)
+    {
+        reset();
+    }
+
+    OneEuroGazeFilter::~OneEuroGazeFilter()
+    {
+        // Nothing to do
+    }
+
+    void OneEuroGazeFilter::filter(std::vector<GazeSample>& rSamples)
+    {
+        // Get parameters from config
+        float minCutoff = mpGUI->getConfig()->gazeFilterOneEuroMinCutoff;
+        float beta = mpGUI->getConfig()->gazeFilterOneEuroBeta;
+        glm::vec2 derivativeCutoff = glm::vec2(mpGUI->getConfig()->gazeFilterOneEuroDerivativeCutoff);
+
+        for (GazeSample& rSample : rSamples)
+        {
+            glm::vec2 value = glm::vec2(rSample.gazeX, rSample.gazeY);
+
+            if (!mInitialized)
+            {
+                // First sample is taken as it is
+                mValue = value;
+                mDerivative = glm::vec2(0, 0);
+                mInitialized = true;
+            }
+            else if (rSample.duration > 0)
+            {
+                // Filter derivative
+                glm::vec2 derivative = (value - mValue) / rSample.duration;
+                mDerivative = glm::mix(mDerivative, derivative, calculateAlpha(derivativeCutoff, rSample.duration));
+
+                // Filter value with cutoff depending on speed
+                glm::vec2 cutoff = glm::vec2(minCutoff) + beta * glm::abs(mDerivative);
+                mValue = glm::mix(mValue, value, calculateAlpha(cutoff, rSample.duration));
+            }
+
+            // Samples without duration just get the last filtered value
+            rSample.gazeX = mValue.x;
+            rSample.gazeY = mValue.y;
+        }
+    }
+
+    void OneEuroGazeFilter::reset()
+    {
+        mInitialized = false;
+        mValue = glm::vec2(0, 0);
+        mDerivative = glm::vec2(0, 0);
+    }
+
+    glm::vec2 OneEuroGazeFilter::calculateAlpha(glm::vec2 cutoff, float duration) const
+    {
+        glm::vec2 tau = 1.0f / (2.0f * glm::pi<float>() * cutoff);
+        return 1.0f / (1.0f + tau / duration);
+    }
+}
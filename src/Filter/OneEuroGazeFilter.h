@@ -0,0 +1,47 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// One Euro filter (Casiez et al., CHI 2012). Low pass filter with a cutoff
+// frequency adapting to the speed of the gaze: strong smoothing while
+// fixating, low lag during saccades. Both axes are filtered separately.
+
+#ifndef ONE_EURO_GAZE_FILTER_H_
+#define ONE_EURO_GAZE_FILTER_H_
+
+#include "GazeFilter.h"
+#include "externals/GLM/glm/glm.hpp"
+
+namespace eyegui
+{
+    class OneEuroGazeFilter : public GazeFilter
+    {
+    public:
+
+        // Constructor
+        OneEuroGazeFilter(GUI const * pGUI);
+
+        // Destructor
+        virtual ~OneEuroGazeFilter();
+
+        // Filter samples in place
+        virtual void filter(std::vector<GazeSample>& rSamples);
+
+        // Forget about previous samples
+        virtual void reset();
+
+    private:
+
+        // Smoothing factor of exponential filter for cutoff frequencies
+        glm::vec2 calculateAlpha(glm::vec2 cutoff, float duration) const;
+
+        // Members
+        bool mInitialized;
+        glm::vec2 mValue;
+        glm::vec2 mDerivative;
+    };
+}
+
+#endif // ONE_EURO_GAZE_FILTER_H_
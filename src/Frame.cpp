@@ -10,6 +10,7 @@
 #include "Layout.h"
 #include "src/Utilities/Helper.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace eyegui
@@ -25,6 +26,7 @@ namespace eyegui
         mpLayout = pLayout;
         mFrameAlpha.setValue(1);
         mCombinedAlpha = 1;
+        mDrawn = false;
         mRemovedFadingAlpha = 1;
         mVisible = true;
         mupRoot = NULL;
@@ -34,6 +36,8 @@ namespace eyegui
         mRelativeSizeX = relativeSizeX;
         mRelativeSizeY = relativeSizeY;
         mRemoved = false;
+        mupLayer = NULL;
+        mCachedElementCount = 0;
 
         clampSize();
     }
@@ -83,6 +87,13 @@ namespace eyegui
     }
 
     void Frame::update(float tpf, float alpha, Input* pInput)
+    {
+        beginUpdate(tpf, alpha);
+        updateElements(tpf, pInput);
+        endUpdate();
+    }
+
+    void Frame::beginUpdate(float tpf, float alpha)
     {
         // *** RESIZING ***
         internalResizing();
@@ -94,7 +105,10 @@ namespace eyegui
 
         // Combine own alpha with layout's
         mCombinedAlpha = mFrameAlpha.getValue() * mRemovedFadingAlpha * alpha;
+    }
 
+    void Frame::updateElements(float tpf, Input* pInput)
+    {
          // *** OWN ROOT AND FRONT ELEMENTS ***
 
         // Update root only if own alpha greater zero
@@ -121,12 +135,55 @@ namespace eyegui
                 mResizeNecessary = true;
             }
         }
+    }
+
+    void Frame::endUpdate()
+    {
+        // *** DAMAGE ***
+
+        // Elements are not updated while frame is invisible, so appearing and
+        // disappearing is tracked by frame itself
+        bool drawn = mCombinedAlpha > 0;
+        if (drawn != mDrawn)
+        {
+            damageArea();
+            mDrawn = drawn;
+        }
+        if (mDrawn)
+        {
+            mupRoot->trackDrawing(mpLayout->getDamageRegion());
+        }
 
         // *** DELETION OF REPLACED ELEMENTS ***
 
         // Delete replaced elements which has been only kept alive for notifications for one frame
         mDyingReplacedElements.clear();
 
+        // *** CACHING IN LAYER ***
+
+        // After deletion, so no dying element is cached
+        updateLayerCaching();
+    }
+
+    bool Frame::consumesGaze(Input const * pInput) const
+    {
+        // Same conditions as in updating of elements
+        if (pInput == NULL || pInput->gazeUsed || mCombinedAlpha < 1)
+        {
+            return false;
+        }
+
+        // Front elements are updated with their own alpha
+        for (Element* pElement : mFrontElements)
+        {
+            auto it = mFrontElementAlphas.find(pElement);
+            float alpha = it != mFrontElementAlphas.end() ? it->second : 0;
+            if (pElement->consumesGaze(pInput, alpha))
+            {
+                return true;
+            }
+        }
+        return mupRoot->consumesGaze(pInput, mCombinedAlpha);
     }
 
     void Frame::draw() const
@@ -134,6 +191,9 @@ namespace eyegui
         // Use alpha because while fading it should still draw
         if (mCombinedAlpha > 0)
         {
+            // Static elements are drawn once into layer
+            drawLayer();
+
             // Draw standard elements
             mupRoot->draw();
 
@@ -311,10 +371,53 @@ namespace eyegui
         mResizeNecessary = true;
     }
 
+    bool Frame::drawFromLayer(Element const * pElement) const
+    {
+        return mupLayer != NULL
+            && mupLayer->draw(pElement->getX(), pElement->getY(), pElement->getWidth(), pElement->getHeight());
+    }
+
+    void Frame::invalidateLayer()
+    {
+        if (mupLayer != NULL)
+        {
+            mupLayer->invalidate();
+        }
+    }
+
+    void Frame::refetchStyles()
+    {
+        if (mupRoot != NULL)
+        {
+            mupRoot->refetchStyle();
+        }
+        for (std::unique_ptr<Element>& rupElement : mDyingReplacedElements)
+        {
+            rupElement->refetchStyle();
+        }
+    }
+
+    void Frame::refreshLocalization(uint generation, uint& rBudget)
+    {
+        // Dying replaced elements are faded out with their content
+        if (mupRoot != NULL)
+        {
+            mupRoot->refreshLocalization(generation, rBudget);
+        }
+    }
+
+    uint Frame::getCountOfCachedElements() const
+    {
+        return mCombinedAlpha > 0 ? mCachedElementCount : 0;
+    }
+
     void Frame::internalResizing()
     {
         if (mResizeNecessary && mCombinedAlpha > 0)
         {
+            EYEGUI_PROFILE_SCOPE(mpLayout->getProfiler(), ProfilePhase::RESIZING);
+            EYEGUI_TRACE_SCOPE("Frame::internalResizing", mpLayout->getFilepath() + (mupRoot->getId().empty() ? "" : ", root: " + mupRoot->getId()));
+
             // Fetch values from layout
             int layoutWidth = mpLayout->getLayoutWidth();
             int layoutHeight = mpLayout->getLayoutHeight();
@@ -342,4 +445,101 @@ namespace eyegui
         mRelativeSizeX = std::max(mRelativeSizeX, 0.0f);
         mRelativeSizeY = std::max(mRelativeSizeY, 0.0f);
     }
+
+    void Frame::damageArea() const
+    {
+        // Pixel in each direction covers rounding of resizing
+        mpLayout->getDamageRegion()->add(getX() - 1, getY() - 1, getWidth() + 2, getHeight() + 2);
+    }
+
+    void Frame::updateLayerCaching()
+    {
+        std::vector<Element*> cachedElements;
+        if (mpLayout->isLayerCaching() && mCombinedAlpha >= 1)
+        {
+            mupRoot->updateLayerCaching(cachedElements);
+
+            // Front elements are drawn on top of everything else
+            for (Element* pElement : mFrontElements)
+            {
+                pElement->resetLayerCaching();
+            }
+
+            // Composing blank element from layer would draw more than nothing
+            for (Element* pElement : cachedElements)
+            {
+                if (pElement->getType() == Element::Type::BLANK)
+                {
+                    pElement->resetLayerCaching();
+                }
+            }
+            cachedElements.erase(
+                std::remove_if(cachedElements.begin(), cachedElements.end(), [](Element* pElement) { return !pElement->isLayerCached(); }),
+                cachedElements.end());
+        }
+        else if (!mCachedElements.empty())
+        {
+            // Fading or disabled caching
+            mupRoot->resetLayerCaching();
+        }
+
+        // Layer has to be drawn again if other elements are cached
+        if (cachedElements != mCachedElements)
+        {
+            mCachedElements = cachedElements;
+            mCachedElementCount = 0;
+            for (Element const * pElement : mCachedElements)
+            {
+                mCachedElementCount += (uint)pElement->getAllChildren().size() + 1;
+            }
+            invalidateLayer();
+        }
+
+        // Create layer when necessary and free it when not used
+        if (mCachedElements.empty())
+        {
+            mupLayer = NULL;
+        }
+        else if (mupLayer == NULL)
+        {
+            mupLayer = std::unique_ptr<Layer>(new Layer(mupRoot->getAssetManager()));
+        }
+    }
+
+    void Frame::drawLayer() const
+    {
+        if (mupLayer == NULL)
+        {
+            return;
+        }
+
+        // Layer covers frame like in resizing
+        int layoutWidth = mpLayout->getLayoutWidth();
+        int layoutHeight = mpLayout->getLayoutHeight();
+        int x = (int)std::round(mRelativePositionX * (float)layoutWidth);
+        int y = (int)std::round(mRelativePositionY * (float)layoutHeight);
+        int width = (int)std::round(mRelativeSizeX * (float)layoutWidth);
+        int height = (int)std::round(mRelativeSizeY * (float)layoutHeight);
+
+        if (mupLayer->isDirty() || !mupLayer->covers(layoutWidth, layoutHeight, x, y, width, height))
+        {
+            // Layer is drawn completely, even while only parts of screen are redrawn
+            DamageRegion* pDamageRegion = mpLayout->getDamageRegion();
+            bool clipping = pDamageRegion->isClipping();
+            DamageRect clip = pDamageRegion->getClip();
+            pDamageRegion->endClip();
+
+            mupLayer->begin(layoutWidth, layoutHeight, x, y, width, height);
+            for (Element const * pElement : mCachedElements)
+            {
+                pElement->drawWithoutLayer();
+            }
+            mupLayer->end();
+
+            if (clipping)
+            {
+                pDamageRegion->beginClip(clip);
+            }
+        }
+    }
 }
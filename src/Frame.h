@@ -14,6 +14,7 @@
 #include "include/eyeGUI.h"
 #include "Object.h"
 #include "Elements/Elements.h"
+#include "Rendering/Layer.h"
 #include "src/Utilities/LerpValue.h"
 
 #include <memory>
@@ -55,6 +56,15 @@ namespace eyegui
         // Updating
         void update(float tpf, float alpha, Input* pInput);
 
+        // Phases of updating. Only updating of elements may run in parallel
+        // to other frames, other phases touch resources shared with them
+        void beginUpdate(float tpf, float alpha);
+        void updateElements(float tpf, Input* pInput);
+        void endUpdate();
+
+        // Whether some element would consume gaze of input when updated
+        bool consumesGaze(Input const * pInput) const;
+
         // Drawing
         void draw() const;
 
@@ -118,6 +128,24 @@ namespace eyegui
         // Set size
         void setSize(float relativeSizeX, float relativeSizeY);
 
+        // Compose element and its children from layer, returns false if not possible
+        bool drawFromLayer(Element const * pElement) const;
+
+        // Draw layer again before next composition
+        void invalidateLayer();
+
+        // Fetch styles of elements again from layout, after layout has copied them
+        void refetchStyles();
+
+        // Take content of switched localization in elements, budget is decreased by changed text blocks
+        void refreshLocalization(uint generation, uint& rBudget);
+
+        // Get count of elements drawn from layer
+        uint getCountOfCachedElements() const;
+
+        // Add area covered by frame to damaged region of GUI
+        void damageArea() const;
+
     private:
 
         // Resize function
@@ -126,11 +154,18 @@ namespace eyegui
         // Clamp size
         void clampSize();
 
+        // Update caching of static elements in layer
+        void updateLayerCaching();
+
+        // Draw static elements into layer if necessary
+        void drawLayer() const;
+
         // Members
         Layout const * mpLayout;
         std::unique_ptr<Element> mupRoot;
         LerpValue mFrameAlpha;
         float mCombinedAlpha;
+        bool mDrawn;
         bool mVisible;
         std::vector<Element*> mFrontElements;
         std::map<Element*, float> mFrontElementAlphas;
@@ -142,6 +177,9 @@ namespace eyegui
         float mRelativeSizeY;
         bool mRemoved;
         float mRemovedFadingAlpha;
+        std::unique_ptr<Layer> mupLayer;
+        std::vector<Element*> mCachedElements;
+        uint mCachedElementCount;
     };
 }
 
@@ -8,11 +8,16 @@
 #include "GUI.h"
 
 #include "Defines.h"
+#include "Filter/FixationGazeFilter.h"
+#include "Filter/OneEuroGazeFilter.h"
+#include "Filter/KalmanGazeFilter.h"
 #include "src/Utilities/OperationNotifier.h"
+#include "src/Parser/DocumentCompiler.h"
 #include "externals/GLM/glm/gtc/matrix_transform.hpp"
 #include "externals/OpenGLLoader/gl_core_3_3.h"
 
 #include <algorithm>
+#include <set>
 
 namespace eyegui
 {
@@ -25,17 +30,25 @@ namespace eyegui
         float vectorGraphicsDPI,
         float fontTallSize,
         float fontMediumSize,
-        float fontSmallSize)
+        float fontSmallSize,
+        std::string recordingFilepath) : mGazeSampleBuffer(GAZE_SAMPLE_BUFFER_CAPACITY)
     {
         // Initialize OpenGL
         GLSetup::init();
 
-        // Initialize members
+        // Initialize members, recording before assets which record into it
+        mupDeletionQueue = std::unique_ptr<DeletionQueue>(new DeletionQueue());
+        mupRecording = std::unique_ptr<RenderSnapshot>(new RenderSnapshot());
+        mupPending = std::unique_ptr<RenderSnapshot>(new RenderSnapshot());
+        mupFront = std::unique_ptr<RenderSnapshot>(new RenderSnapshot());
+        mPendingNew = false;
+        mRenderSnapshots = false;
         mWidth = width;
         mHeight = height;
         mNewWidth = 0;
         mNewHeight = 0;
         mCharacterSet = characterSet;
+        mupProfiler = std::unique_ptr<Profiler>(new Profiler()); // Before assets, which may be profiled
         mAccPeriodicTime = -(ACCUMULATED_TIME_PERIOD / 2);
         mupAssetManager = std::unique_ptr<AssetManager>(new AssetManager(this));
         mpDefaultFont = NULL;
@@ -47,6 +60,33 @@ namespace eyegui
         mFontTallSize = fontTallSize;
         mFontMediumSize = fontMediumSize;
         mFontSmallSize = fontSmallSize;
+        mLastGazeSampleTimestamp = -1;
+        mGazeFilterType = GazeFilterType::NONE;
+        mupInputRecorder = std::unique_ptr<InputRecorder>(new InputRecorder());
+        mupFrameCapturer = std::unique_ptr<FrameCapturer>(new FrameCapturer());
+        mLayerCaching = false;
+        mupDamageRegion = std::unique_ptr<DamageRegion>(new DamageRegion());
+        mPartialRedraw = false;
+        mupWorkerPool = NULL;
+        mLocalizationGeneration = 0;
+        mLocalizationRefreshing = false;
+        mupLoadingThread = NULL;
+
+        // Start recording
+        if (recordingFilepath != EMPTY_STRING_ATTRIBUTE)
+        {
+            mupInputRecorder->open(
+                recordingFilepath,
+                width,
+                height,
+                fontFilepath,
+                characterSet,
+                localizationFilepath,
+                vectorGraphicsDPI,
+                fontTallSize,
+                fontMediumSize,
+                fontSmallSize);
+        }
 
         // Initialize default font ("" handled by asset manager)
         mpDefaultFont = mupAssetManager->fetchFont(fontFilepath);
@@ -54,7 +94,7 @@ namespace eyegui
         // Load initial localization
         if (localizationFilepath != EMPTY_STRING_ATTRIBUTE)
         {
-            mupLocalizationMap = std::move(localization_parser::parse(localizationFilepath));
+            mupLocalizationStore = std::move(localization_parser::parse(localizationFilepath));
         }
         else
         {
@@ -69,7 +109,19 @@ namespace eyegui
 
     GUI::~GUI()
     {
-        // Nothing to do so far
+        // Stop loading, pending loadings are dropped
+        mupLoadingThread.reset();
+        mPendingLoadings.clear();
+        mspPendingLocalization = NULL;
+
+        // Release everything using objects of deletion queue, then delete them
+        mJobs.clear();
+        mLayouts.clear();
+        mupGazeDrawer.reset();
+        mupRecording->clear();
+        mupPending->clear();
+        mupFront->clear();
+        mupDeletionQueue->flush();
     }
 
     Layout* GUI::addLayout(std::string filepath, bool visible)
@@ -77,25 +129,87 @@ namespace eyegui
         // Parse layout
         std::unique_ptr<Layout> upLayout = layout_parser::parse(this, mupAssetManager.get(), filepath);
 
-        // Get raw pointer to return
-        Layout* pLayout = upLayout.get();
+        return enqueueLayout(std::move(upLayout), filepath, visible);
+    }
 
-        // Set visibility
-        pLayout->setVisibility(visible, false);
+    void GUI::removeLayout(Layout const * pLayout)
+    {
+        mupInputRecorder->recordRemoveLayout(pLayout);
+        mJobs.push_back(std::move(std::unique_ptr<GUIJob>(new RemoveLayoutJob(this, pLayout))));
 
-        // Give unique pointer to job so it will be pushed back before next rendering but not during
-        mJobs.push_back(std::move(std::unique_ptr<GUIJob>(new AddLayoutJob(this, std::move(upLayout)))));
+        // Bricks pending for layout are not added anymore
+        for (std::shared_ptr<PendingLoading>& rspLoading : mPendingLoadings)
+        {
+            if (rspLoading->brick && rspLoading->pLayout == pLayout)
+            {
+                rspLoading->pLayout = NULL;
+            }
+        }
+    }
 
-        return pLayout;
+    std::shared_ptr<const AsyncLoading> GUI::addLayoutAsync(std::string filepath, bool visible, std::weak_ptr<LoadingListener> wpListener)
+    {
+        std::shared_ptr<PendingLoading> spLoading = std::make_shared<PendingLoading>();
+        spLoading->spHandle = std::make_shared<AsyncLoading>();
+        spLoading->wpListener = wpListener;
+        spLoading->filepath = filepath;
+        spLoading->brick = false;
+        spLoading->visible = visible;
+        spLoading->pLayout = NULL;
+        spLoading->relativePositionX = 0;
+        spLoading->relativePositionY = 0;
+        spLoading->relativeSizeX = 0;
+        spLoading->relativeSizeY = 0;
+        spLoading->fade = false;
+        spLoading->ready = false;
+        enqueuePendingLoading(spLoading);
+        return spLoading->spHandle;
     }
 
-    void GUI::removeLayout(Layout const * pLayout)
+    std::shared_ptr<const AsyncLoading> GUI::addFloatingFrameWithBrickAsync(
+        Layout* pLayout,
+        std::string filepath,
+        float relativePositionX,
+        float relativePositionY,
+        float relativeSizeX,
+        float relativeSizeY,
+        std::map<std::string, std::string> idMapper,
+        bool visible,
+        bool fade,
+        std::weak_ptr<LoadingListener> wpListener)
     {
-        mJobs.push_back(std::move(std::unique_ptr<GUIJob>(new RemoveLayoutJob(this, pLayout))));
+        std::shared_ptr<PendingLoading> spLoading = std::make_shared<PendingLoading>();
+        spLoading->spHandle = std::make_shared<AsyncLoading>();
+        spLoading->wpListener = wpListener;
+        spLoading->filepath = filepath;
+        spLoading->brick = true;
+        spLoading->visible = visible;
+        spLoading->pLayout = pLayout;
+        spLoading->relativePositionX = relativePositionX;
+        spLoading->relativePositionY = relativePositionY;
+        spLoading->relativeSizeX = relativeSizeX;
+        spLoading->relativeSizeY = relativeSizeY;
+        spLoading->idMapper = idMapper;
+        spLoading->fade = fade;
+        spLoading->ready = false;
+
+        // Brick kept by asset manager needs no reading
+        if (mupAssetManager->hasBrick(filepath))
+        {
+            spLoading->ready = true;
+            mPendingLoadings.push_back(spLoading);
+        }
+        else
+        {
+            enqueuePendingLoading(spLoading);
+        }
+        return spLoading->spHandle;
     }
 
     void GUI::resize(int width, int height)
     {
+        mupInputRecorder->recordResize(width, height);
+
         // Not necessary but saves one from resizing after minimizing
         if (width > 0 && height > 0)
         {
@@ -103,6 +217,7 @@ namespace eyegui
             {
                 // Initializes resizing, piped to layouts during updating
                 mResizing = true;
+                mupDamageRegion->addFull();
                 mResizeWaitTime = RESIZE_WAIT_DURATION;
 
                 // Save to members
@@ -114,12 +229,45 @@ namespace eyegui
 
     Input GUI::update(float tpf, const Input input)
     {
+        // Each update begins new frame of profiler
+        mupProfiler->beginFrame();
+        EYEGUI_PROFILE_SCOPE(mupProfiler.get(), ProfilePhase::UPDATE);
+        EYEGUI_TRACE_SCOPE("GUI::update", "");
+
+        // Finish asynchronous loading, which may add a job
+        if (!mPendingLoadings.empty())
+        {
+            EYEGUI_PROFILE_SCOPE(mupProfiler.get(), ProfilePhase::JOBS);
+            finishPendingLoading();
+        }
+        if (mspPendingLocalization != NULL)
+        {
+            EYEGUI_PROFILE_SCOPE(mupProfiler.get(), ProfilePhase::JOBS);
+            finishPendingLocalization();
+        }
+        mupAssetManager->finishDictionaryLoading();
+
         // Execute all jobs
-        for (std::unique_ptr<GUIJob>& rupJob : mJobs)
         {
-            rupJob->execute();
+            EYEGUI_PROFILE_SCOPE(mupProfiler.get(), ProfilePhase::JOBS);
+
+            // Jobs change layouts or config, which may affect everything
+            if (!mJobs.empty())
+            {
+                mupDamageRegion->addFull();
+            }
+            for (std::unique_ptr<GUIJob>& rupJob : mJobs)
+            {
+                rupJob->execute();
+            }
+            mJobs.clear();
+
+            // Text blocks of switched localization, after jobs which may have changed keys or layouts
+            if (mLocalizationRefreshing)
+            {
+                refreshLocalization();
+            }
         }
-        mJobs.clear();
 
         // Resizing
         if (mResizing)
@@ -129,6 +277,7 @@ namespace eyegui
             // Resizing should take place?
             if (mResizeWaitTime <= 0)
             {
+                EYEGUI_PROFILE_SCOPE(mupProfiler.get(), ProfilePhase::RESIZING);
                 internalResizing();
                 mResizing = false;
                 mResizeWaitTime = 0;
@@ -142,33 +291,226 @@ namespace eyegui
             mAccPeriodicTime -= ACCUMULATED_TIME_PERIOD;
         }
 
+        // Consume gaze samples pushed since last update
+        consumeGazeSamples();
+        mupInputRecorder->recordUpdate(tpf, input);
+
+        // Without pushed samples, gaze of input is the only sample
+        if (mGazeSamples.empty())
+        {
+            GazeSample sample;
+            sample.gazeX = (float)input.gazeX;
+            sample.gazeY = (float)input.gazeY;
+            sample.timestamp = 0;
+            sample.duration = tpf;
+            mGazeSamples.push_back(sample);
+        }
+
+        // Filter all samples at once, so every element gets the same gaze
+        updateGazeFilter();
+        if (mupGazeFilter != NULL)
+        {
+            mupGazeFilter->filter(mGazeSamples);
+        }
+
         // Copy constant input
         Input copyInput = input;
 
+        // Latest gaze sample replaces gaze of input
+        copyInput.gazeX = (int)mGazeSamples.back().gazeX;
+        copyInput.gazeY = (int)mGazeSamples.back().gazeY;
+
         // Update all layouts in reversed order
-        for (int i = (int)mLayouts.size() - 1; i >= 0; i--)
+        if (mupWorkerPool != NULL)
+        {
+            updateLayoutsInParallel(tpf, &copyInput);
+        }
+        else
+        {
+            for (int i = (int)mLayouts.size() - 1; i >= 0; i--)
+            {
+                // Update and use input
+                mLayouts[i]->update(tpf, &copyInput);
+            }
+        }
+
+        // Update gaze drawer, at full rate of eye tracker if samples available
+        DamageRect previousGazeBounds = mupGazeDrawer->getBounds();
+        for (const GazeSample& rSample : mGazeSamples)
         {
-            // Update and use input
-            mLayouts[i]->update(tpf, &copyInput);
+            mupGazeDrawer->update((int)rSample.gazeX, (int)rSample.gazeY, rSample.duration);
         }
 
-        // Update gaze drawer
-        mupGazeDrawer->update(input.gazeX, input.gazeY, tpf);
+        // Visualization of gaze changes with every sample
+        if (mDrawGazeVisualization)
+        {
+            mupGazeDrawer->updateInstances();
+            DamageRect gazeBounds = mupGazeDrawer->getBounds();
+            mupDamageRegion->add(previousGazeBounds.x, previousGazeBounds.y, previousGazeBounds.width, previousGazeBounds.height);
+            mupDamageRegion->add(gazeBounds.x, gazeBounds.y, gazeBounds.width, gazeBounds.height);
+        }
+
+        // Drawing is recorded right after update
+        if (mRenderSnapshots)
+        {
+            publishSnapshot();
+        }
 
         // Return copy of used input
         return copyInput;
     }
 
+    void GUI::pushGazeSample(float gazeX, float gazeY, double timestamp)
+    {
+        GazeSample sample;
+        sample.gazeX = gazeX;
+        sample.gazeY = gazeY;
+        sample.timestamp = timestamp;
+        sample.duration = 0;
+
+        // Never blocks, sample is dropped when buffer is full
+        mGazeSampleBuffer.push(sample);
+    }
+
     void GUI::draw() const
     {
+        // Objects released by snapshots or elements since last drawing
+        mupDeletionQueue->flush();
+
+        if (mRenderSnapshots)
+        {
+            EYEGUI_TRACE_SCOPE("GUI::draw", "snapshot");
+
+            // Take snapshot published by last update
+            bool taken = false;
+            {
+                std::lock_guard<std::mutex> lock(mSnapshotMutex);
+                if (mPendingNew)
+                {
+                    mupFront->swap(*mupPending);
+                    mPendingNew = false;
+                    taken = true;
+                }
+            }
+
+            // Complete snapshot may be drawn again, but areas would be blended twice
+            if (taken || !mPartialRedraw)
+            {
+                executeSnapshot(mupFront.get());
+            }
+        }
+        else
+        {
+            mupInputRecorder->recordDraw();
+            internalDraw(mPartialRedraw);
+
+            // Screen is up to date
+            mupDamageRegion->clear();
+        }
+    }
+
+    void GUI::internalDraw(bool partial) const
+    {
+        EYEGUI_PROFILE_SCOPE(mupProfiler.get(), ProfilePhase::DRAW);
+        EYEGUI_TRACE_SCOPE("GUI::draw", "");
+
+        // Record and execute at once
+        recordDrawing(partial);
+        executeSnapshot(mupRecording.get());
+        mupRecording->clear();
+    }
+
+    void GUI::recordDrawing(bool partial) const
+    {
+        mupRecording->clear();
+        mupRecording->setWindowSize(getWindowWidth(), getWindowHeight());
+
+        if (partial && !mupDamageRegion->isFull())
+        {
+            // Each damaged area is drawn on its own, elements outside of it are skipped
+            std::vector<DamageRect> rects = mupDamageRegion->getRects(getWindowWidth(), getWindowHeight());
+            for (const DamageRect& rRect : rects)
+            {
+                mupRecording->enableScissor(rRect.x, getWindowHeight() - rRect.y - rRect.height, rRect.width, rRect.height);
+                mupDamageRegion->beginClip(rRect);
+                drawEverything();
+            }
+            mupDamageRegion->endClip();
+            mupRecording->setDamageRects(rects);
+        }
+        else
+        {
+            drawEverything();
+            DamageRect rect;
+            rect.width = getWindowWidth();
+            rect.height = getWindowHeight();
+            mupRecording->setDamageRects(std::vector<DamageRect>(1, rect));
+        }
+    }
+
+    void GUI::executeSnapshot(RenderSnapshot const * pSnapshot) const
+    {
+        if (pSnapshot->isEmpty())
+        {
+            return;
+        }
+
         // Setup OpenGL
         GLSetup glSetup;
-        glSetup.setup(0, 0, getWindowWidth(), getWindowHeight());
+        glSetup.setup(0, 0, pSnapshot->getWindowWidth(), pSnapshot->getWindowHeight());
+
+        pSnapshot->execute();
 
-        // Draw all layouts
+        // Restore OpenGL state of application
+        glSetup.restore();
+    }
+
+    void GUI::publishSnapshot()
+    {
+        EYEGUI_PROFILE_SCOPE(mupProfiler.get(), ProfilePhase::DRAW);
+
+        // Previous snapshot not drawn yet or nothing changed, damage is kept
+        {
+            std::lock_guard<std::mutex> lock(mSnapshotMutex);
+            if (mPendingNew)
+            {
+                return;
+            }
+        }
+        if (mupDamageRegion->isEmpty())
+        {
+            return;
+        }
+
+        // Objects created by this thread must be ready for drawing thread
+        recordDrawing(mPartialRedraw);
+        mupDamageRegion->clear();
+        mupRecording->insertFence();
+
+        // Hand over to drawing, recording gets content drawn before
+        {
+            std::lock_guard<std::mutex> lock(mSnapshotMutex);
+            mupPending->swap(*mupRecording);
+            mPendingNew = true;
+        }
+        mupInputRecorder->recordDraw();
+    }
+
+    void GUI::drawEverything() const
+    {
+        // Draw all layouts, timing is only possible when executed right away
+        Profiler* pProfiler = mupProfiler.get();
         for (uint i = 0; i < mLayouts.size(); i++)
         {
+            if (!mRenderSnapshots)
+            {
+                mupRecording->call([pProfiler]() { pProfiler->beginGPUTiming(); });
+            }
             mLayouts[i]->draw();
+            if (!mRenderSnapshots)
+            {
+                mupRecording->call([pProfiler]() { pProfiler->endGPUTiming(); });
+            }
         }
 
         // Render resize blend
@@ -188,47 +530,199 @@ namespace eyegui
         {
             mupGazeDrawer->draw();
         }
-
-        // Restore OpenGL state of application
-        glSetup.restore();
     }
 
     void GUI::moveLayoutToFront(Layout* pLayout)
     {
+        mupInputRecorder->recordMoveLayout(pLayout, true);
         mJobs.push_back(std::move(std::unique_ptr<GUIJob>(new MoveLayoutJob(this, pLayout, true))));
     }
 
     void GUI::moveLayoutToBack(Layout* pLayout)
     {
+        mupInputRecorder->recordMoveLayout(pLayout, false);
         mJobs.push_back(std::move(std::unique_ptr<GUIJob>(new MoveLayoutJob(this, pLayout, false))));
     }
 
     void GUI::loadConfig(std::string filepath)
     {
+        mupInputRecorder->recordLoadConfig(filepath);
         mJobs.push_back(std::move(std::unique_ptr<GUIJob>(new LoadConfigJob(this, filepath))));
     }
 
+    void GUI::switchLocalization(std::string filepath)
+    {
+        mupInputRecorder->recordSwitchLocalization(filepath);
+
+        // Previous switch, which is not yet swapped in, is dropped
+        std::shared_ptr<PendingLocalization> spLocalization = std::make_shared<PendingLocalization>();
+        spLocalization->filepath = filepath;
+        spLocalization->ready = false;
+        mspPendingLocalization = spLocalization;
+
+        // Loading thread keeps its own pointer, so localization may be dropped meanwhile
+        startLoadingThread();
+        mupLoadingThread->enqueue([spLocalization]()
+        {
+            // Localization with errors is not swapped in, so current one keeps working
+            OperationNotifier::collectNotifications(&(spLocalization->notifications));
+            unsigned int errorCount = OperationNotifier::getErrorCount();
+            spLocalization->upStore = localization_parser::parse(spLocalization->filepath);
+            if (errorCount != OperationNotifier::getErrorCount())
+            {
+                spLocalization->upStore = NULL;
+            }
+            OperationNotifier::collectNotifications(NULL);
+            spLocalization->ready = true;
+        });
+    }
+
     void GUI::setGazeVisualizationDrawing(bool draw)
     {
         mDrawGazeVisualization = draw;
+        mupDamageRegion->addFull();
+        mupInputRecorder->recordSetGazeVisualizationDrawing(mDrawGazeVisualization);
     }
 
     void GUI::toggleGazeVisualizationDrawing()
     {
         mDrawGazeVisualization = !mDrawGazeVisualization;
+        mupDamageRegion->addFull();
+        mupInputRecorder->recordSetGazeVisualizationDrawing(mDrawGazeVisualization);
     }
 
     void GUI::prefetchImage(std::string filepath)
     {
+        mupInputRecorder->recordPrefetchImage(filepath);
+
         // Do it immediately
         mupAssetManager->fetchTexture(filepath);
     }
 
+    void GUI::invalidateBrick(std::string filepath)
+    {
+        mupInputRecorder->recordInvalidateBrick(filepath);
+        mupAssetManager->invalidateBrick(filepath);
+    }
+
+    void GUI::invalidateAllBricks()
+    {
+        mupInputRecorder->recordInvalidateAllBricks();
+        mupAssetManager->invalidateAllBricks();
+    }
+
+    void GUI::invalidateStylesheet(std::string filepath)
+    {
+        mupInputRecorder->recordInvalidateStylesheet(filepath);
+        mupAssetManager->invalidateStylesheet(filepath);
+    }
+
+    void GUI::invalidateAllStylesheets()
+    {
+        mupInputRecorder->recordInvalidateAllStylesheets();
+        mupAssetManager->invalidateAllStylesheets();
+    }
+
     void GUI::setValueOfConfigAttribute(std::string attribute, std::string value)
     {
+        mupInputRecorder->recordSetValueOfConfigAttribute(attribute, value);
         mJobs.push_back(std::move(std::unique_ptr<GUIJob>(new SetValueOfConfigAttributeJob(this, attribute, value))));
     }
 
+    void GUI::setProfiling(bool enabled, bool gpuTiming)
+    {
+        mupInputRecorder->recordSetProfiling(enabled, gpuTiming);
+        mupProfiler->setEnabled(enabled, gpuTiming);
+    }
+
+    ProfileStatistics GUI::getProfileStatistics(ProfilePhase phase) const
+    {
+        return mupProfiler->getStatistics(phase);
+    }
+
+    bool GUI::captureFrame(FrameCapture& rCapture, bool wait)
+    {
+        EYEGUI_TRACE_SCOPE("GUI::captureFrame", "");
+
+        // Draw into framebuffer of capturer and start readback
+        mupFrameCapturer->begin(getWindowWidth(), getWindowHeight());
+        internalDraw(false);
+        mupFrameCapturer->end();
+
+        // Pixels of this or some previous frame
+        return mupFrameCapturer->retrieve(rCapture, wait);
+    }
+
+    void GUI::setLayerCaching(bool enabled)
+    {
+        mupInputRecorder->recordSetLayerCaching(enabled);
+        mLayerCaching = enabled;
+    }
+
+    uint GUI::getCountOfCachedElements() const
+    {
+        uint count = 0;
+        for (const std::unique_ptr<Layout>& rupLayout : mLayouts)
+        {
+            count += rupLayout->getCountOfCachedElements();
+        }
+        return count;
+    }
+
+    bool GUI::needsRedraw() const
+    {
+        if (mRenderSnapshots)
+        {
+            std::lock_guard<std::mutex> lock(mSnapshotMutex);
+            return mPendingNew;
+        }
+        return !mupDamageRegion->isEmpty();
+    }
+
+    std::vector<DamageRect> GUI::getDamageRects() const
+    {
+        if (mRenderSnapshots)
+        {
+            std::lock_guard<std::mutex> lock(mSnapshotMutex);
+            return mPendingNew ? mupPending->getDamageRects() : std::vector<DamageRect>();
+        }
+        return mupDamageRegion->getRects(getWindowWidth(), getWindowHeight());
+    }
+
+    void GUI::setPartialRedraw(bool enabled)
+    {
+        mupInputRecorder->recordSetPartialRedraw(enabled);
+        mPartialRedraw = enabled;
+    }
+
+    void GUI::setRenderSnapshots(bool enabled)
+    {
+        mupInputRecorder->recordSetRenderSnapshots(enabled);
+        if (mRenderSnapshots != enabled)
+        {
+            // Start over with complete drawing
+            std::lock_guard<std::mutex> lock(mSnapshotMutex);
+            mRenderSnapshots = enabled;
+            mupPending->clear();
+            mupFront->clear();
+            mPendingNew = false;
+            mupDamageRegion->addFull();
+        }
+    }
+
+    void GUI::setParallelUpdate(bool enabled)
+    {
+        mupInputRecorder->recordSetParallelUpdate(enabled);
+        if (enabled && mupWorkerPool == NULL)
+        {
+            mupWorkerPool = std::unique_ptr<WorkerPool>(new WorkerPool());
+        }
+        else if (!enabled)
+        {
+            mupWorkerPool = NULL;
+        }
+    }
+
     int GUI::getWindowWidth() const
     {
         return mWidth;
@@ -259,13 +753,17 @@ namespace eyegui
         return mpDefaultFont;
     }
 
-    std::u16string GUI::getContentFromLocalization(std::string key) const
+    const std::u16string& GUI::getContentFromLocalization(const std::string& rKey) const
     {
-        auto it = mupLocalizationMap->find(key);
+        std::u16string const * pContent = NULL;
+        if (mupLocalizationStore != NULL)
+        {
+            pContent = mupLocalizationStore->find(rKey);
+        }
 
-        if (it != mupLocalizationMap->end())
+        if (pContent != NULL)
         {
-            return it->second;
+            return *pContent;
         }
         else
         {
@@ -300,6 +798,266 @@ namespace eyegui
         }
     }
 
+    const std::vector<GazeSample>& GUI::getGazeSamples() const
+    {
+        return mGazeSamples;
+    }
+
+    InputRecorder* GUI::getInputRecorder() const
+    {
+        return mupInputRecorder.get();
+    }
+
+    Profiler* GUI::getProfiler() const
+    {
+        return mupProfiler.get();
+    }
+
+    bool GUI::isLayerCaching() const
+    {
+        return mLayerCaching;
+    }
+
+    DamageRegion* GUI::getDamageRegion() const
+    {
+        return mupDamageRegion.get();
+    }
+
+    RenderSnapshot* GUI::getRecording() const
+    {
+        return mupRecording.get();
+    }
+
+    DeletionQueue* GUI::getDeletionQueue() const
+    {
+        return mupDeletionQueue.get();
+    }
+
+    void GUI::readPendingLoading(PendingLoading* pLoading)
+    {
+        EYEGUI_TRACE_SCOPE("GUI::readPendingLoading", pLoading->filepath);
+
+        // Notifications are emitted by update, which calls back user
+        OperationNotifier::collectNotifications(&(pLoading->notifications));
+
+        // Read document, which is compiled if necessary
+        pLoading->upDocument = document_compiler::load(
+            pLoading->filepath,
+            pLoading->brick ? CompiledDocument::Kind::BRICK : CompiledDocument::Kind::LAYOUT);
+
+        if (pLoading->upDocument != NULL)
+        {
+            // Stylesheet of layout is path in first node
+            CompiledDocument const * pDocument = pLoading->upDocument.get();
+            if (!pLoading->brick && pDocument->getNodeCount() > 0)
+            {
+                std::string stylesheetFilepath = pDocument->getString(pDocument->getNode(0)->text);
+                if (stylesheetFilepath != EMPTY_STRING_ATTRIBUTE)
+                {
+                    pLoading->upStylesheet = document_compiler::load(stylesheetFilepath, CompiledDocument::Kind::STYLESHEET);
+                }
+            }
+
+            // Collect images used by elements
+            std::set<std::string> imageFilepaths;
+            for (uint32_t i = 0; i < pDocument->getNodeCount(); i++)
+            {
+                CompiledDocument::Node const * pNode = pDocument->getNode(i);
+                imageFilepaths.insert(pDocument->getString(pNode->backgroundFilepath));
+                switch (pNode->type)
+                {
+                case CompiledDocument::NodeType::PICTURE:
+                case CompiledDocument::NodeType::CIRCLE_BUTTON:
+                case CompiledDocument::NodeType::BOX_BUTTON:
+                case CompiledDocument::NodeType::SENSOR:
+                case CompiledDocument::NodeType::DROP_BUTTON:
+                    imageFilepaths.insert(pDocument->getString(pNode->text));
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            // Decode pixel images, vector graphics are rasterized at finishing. Failures are reported there
+            for (const std::string& rFilepath : imageFilepaths)
+            {
+                int suspectedChannels = 0;
+                if (rFilepath != EMPTY_STRING_ATTRIBUTE && AssetManager::isPixelImage(rFilepath, suspectedChannels))
+                {
+                    std::unique_ptr<DecodedImage> upImage = std::unique_ptr<DecodedImage>(new DecodedImage);
+                    if (PixelTexture::decode(rFilepath, suspectedChannels, *(upImage.get())))
+                    {
+                        pLoading->images.push_back(std::make_pair(rFilepath, std::move(upImage)));
+                    }
+                }
+            }
+        }
+
+        // Everything else is done by update
+        OperationNotifier::collectNotifications(NULL);
+        pLoading->ready = true;
+    }
+
+    void GUI::enqueuePendingLoading(std::shared_ptr<PendingLoading> spLoading)
+    {
+        startLoadingThread();
+        mPendingLoadings.push_back(spLoading);
+
+        // Loading thread keeps its own pointer, so loading may be dropped meanwhile
+        mupLoadingThread->enqueue([spLoading]() { readPendingLoading(spLoading.get()); });
+    }
+
+    void GUI::startLoadingThread()
+    {
+        if (mupLoadingThread == NULL)
+        {
+            mupLoadingThread = std::unique_ptr<LoadingThread>(new LoadingThread());
+        }
+    }
+
+    void GUI::finishPendingLocalization()
+    {
+        if (!mspPendingLocalization->ready)
+        {
+            return;
+        }
+
+        EYEGUI_TRACE_SCOPE("GUI::finishPendingLocalization", mspPendingLocalization->filepath);
+
+        // Report problems of parsing
+        OperationNotifier::emitNotifications(mspPendingLocalization->notifications);
+
+        // Current localization is kept if parsing failed
+        if (mspPendingLocalization->upStore == NULL)
+        {
+            mspPendingLocalization = NULL;
+            return;
+        }
+
+        // Text blocks keep their content until refreshed
+        mupLocalizationStore = std::move(mspPendingLocalization->upStore);
+        mspPendingLocalization = NULL;
+        mLocalizationGeneration++;
+        mLocalizationRefreshing = true;
+    }
+
+    void GUI::refreshLocalization()
+    {
+        EYEGUI_TRACE_SCOPE("GUI::refreshLocalization", "");
+
+        uint budget = LOCALIZATION_REFRESHES_PER_UPDATE;
+        for (std::unique_ptr<Layout>& rupLayout : mLayouts)
+        {
+            rupLayout->refreshLocalization(mLocalizationGeneration, budget);
+        }
+
+        // Budget left means that no text block has to be refreshed anymore
+        mLocalizationRefreshing = budget == 0;
+    }
+
+    void GUI::finishPendingLoading()
+    {
+        // Loadings are read in order, so only first one has to be checked
+        while (!mPendingLoadings.empty())
+        {
+            std::shared_ptr<PendingLoading> spLoading = mPendingLoadings.front();
+
+            // Bricks of removed layouts are dropped without waiting for them
+            bool dropped = spLoading->brick && spLoading->pLayout == NULL;
+            if (!dropped && !spLoading->ready)
+            {
+                return;
+            }
+            mPendingLoadings.pop_front();
+            spLoading->spHandle->done = true;
+
+            // Look for next one in same update
+            if (dropped)
+            {
+                continue;
+            }
+
+            EYEGUI_TRACE_SCOPE("GUI::finishPendingLoading", spLoading->filepath);
+
+            // Report problems of reading
+            OperationNotifier::emitNotifications(spLoading->notifications);
+
+            // Textures are created by elements from decoded images
+            for (auto& rImage : spLoading->images)
+            {
+                mupAssetManager->provideDecodedImage(rImage.first, std::move(rImage.second));
+            }
+
+            // Create elements
+            if (spLoading->brick)
+            {
+                if (spLoading->upDocument != NULL)
+                {
+                    mupAssetManager->provideBrick(spLoading->filepath, std::move(spLoading->upDocument));
+                }
+                Layout* pLayout = spLoading->pLayout;
+                pLayout->getInputRecorder()->recordAddFloatingFrameWithBrick(
+                    pLayout,
+                    spLoading->filepath,
+                    spLoading->relativePositionX,
+                    spLoading->relativePositionY,
+                    spLoading->relativeSizeX,
+                    spLoading->relativeSizeY,
+                    spLoading->idMapper,
+                    spLoading->visible,
+                    spLoading->fade);
+                spLoading->spHandle->pLayout = pLayout;
+                spLoading->spHandle->frameIndex = (int)pLayout->addFloatingFrameWithBrick(
+                    spLoading->filepath,
+                    spLoading->relativePositionX,
+                    spLoading->relativePositionY,
+                    spLoading->relativeSizeX,
+                    spLoading->relativeSizeY,
+                    spLoading->idMapper,
+                    spLoading->visible,
+                    spLoading->fade);
+            }
+            else
+            {
+                // Documents not found are loaded again by parser, which reports it
+                std::unique_ptr<Layout> upLayout = layout_parser::parse(
+                    this,
+                    mupAssetManager.get(),
+                    spLoading->filepath,
+                    spLoading->upDocument.get(),
+                    spLoading->upStylesheet.get());
+                spLoading->spHandle->pLayout = enqueueLayout(std::move(upLayout), spLoading->filepath, spLoading->visible);
+            }
+
+            // Images not used by elements are not kept
+            mupAssetManager->discardDecodedImages();
+
+            // Tell listener
+            if (auto spListener = spLoading->wpListener.lock())
+            {
+                spListener->loaded(spLoading->spHandle->pLayout, spLoading->spHandle->frameIndex);
+            }
+
+            // Only one loading per update, which creates all its elements and textures at once
+            return;
+        }
+    }
+
+    Layout* GUI::enqueueLayout(std::unique_ptr<Layout> upLayout, std::string filepath, bool visible)
+    {
+        // Get raw pointer to return
+        Layout* pLayout = upLayout.get();
+        mupInputRecorder->recordAddLayout(pLayout, filepath, visible);
+
+        // Set visibility
+        pLayout->setVisibility(visible, false);
+
+        // Give unique pointer to job so it will be pushed back before next rendering but not during
+        mJobs.push_back(std::move(std::unique_ptr<GUIJob>(new AddLayoutJob(this, std::move(upLayout)))));
+
+        return pLayout;
+    }
+
     int GUI::findLayout(Layout const * pLayout) const
     {
         // Try to find index of layout in vector
@@ -336,6 +1094,7 @@ namespace eyegui
         // Actual resizing action
         mWidth = mNewWidth;
         mHeight = mNewHeight;
+        mupDamageRegion->addFull();
 
         // Resize font atlases first
         mupAssetManager->resizeFontAtlases();
@@ -343,6 +1102,12 @@ namespace eyegui
         // Reset gaze drawer
         mupGazeDrawer->reset();
 
+        // Reset gaze filter
+        if (mupGazeFilter != NULL)
+        {
+            mupGazeFilter->reset();
+        }
+
         // Then, resize all layouts
         for (std::unique_ptr<Layout>& upLayout : mLayouts)
         {
@@ -351,6 +1116,93 @@ namespace eyegui
         }
     }
 
+    void GUI::consumeGazeSamples()
+    {
+        // Fetch samples of this update
+        mGazeSamples.clear();
+        mGazeSampleBuffer.popAll(mGazeSamples);
+
+        // Calculate duration of each sample
+        for (GazeSample& rSample : mGazeSamples)
+        {
+            mupInputRecorder->recordGazeSample(rSample.gazeX, rSample.gazeY, rSample.timestamp);
+
+            if (mLastGazeSampleTimestamp >= 0)
+            {
+                rSample.duration = std::max(0.0f, (float)(rSample.timestamp - mLastGazeSampleTimestamp));
+            }
+            mLastGazeSampleTimestamp = rSample.timestamp;
+        }
+
+        // Tell about overflow
+        unsigned int droppedCount = mGazeSampleBuffer.fetchDroppedCount();
+        if (droppedCount > 0)
+        {
+            throwWarning(
+                OperationNotifier::Operation::RUNTIME,
+                "Gaze sample buffer overflow, dropped samples: " + std::to_string(droppedCount));
+        }
+    }
+
+    void GUI::updateLayoutsInParallel(float tpf, Input* pInput)
+    {
+        // Layouts update themselves and decide about gaze in same order as serial update
+        std::vector<FrameUpdate> frameUpdates;
+        for (int i = (int)mLayouts.size() - 1; i >= 0; i--)
+        {
+            mLayouts[i]->prepareParallelUpdate(tpf, pInput, frameUpdates);
+        }
+
+        // Elements of frames only touch their own frame and notification queue of layout
+        {
+            EYEGUI_PROFILE_SCOPE(mupProfiler.get(), ProfilePhase::ELEMENT_UPDATE);
+            std::vector<std::function<void()> > tasks;
+            for (FrameUpdate& rFrameUpdate : frameUpdates)
+            {
+                FrameUpdate* pFrameUpdate = &rFrameUpdate;
+                tasks.push_back([pFrameUpdate, tpf]()
+                {
+                    EYEGUI_TRACE_SCOPE("Frame::updateElements", "");
+                    pFrameUpdate->pFrame->updateElements(tpf, pFrameUpdate->useInput ? &(pFrameUpdate->input) : NULL);
+                });
+            }
+            mupWorkerPool->run(tasks);
+        }
+
+        // Damage and layers are shared, so frames finish updating serially
+        for (FrameUpdate& rFrameUpdate : frameUpdates)
+        {
+            rFrameUpdate.pFrame->endUpdate();
+            if (rFrameUpdate.useInput && rFrameUpdate.input.gazeUsed)
+            {
+                pInput->gazeUsed = true;
+            }
+        }
+    }
+
+    void GUI::updateGazeFilter()
+    {
+        if (mConfig.gazeFilterType != mGazeFilterType)
+        {
+            mGazeFilterType = mConfig.gazeFilterType;
+            switch (mGazeFilterType)
+            {
+            case GazeFilterType::FIXATION:
+                mupGazeFilter = std::unique_ptr<GazeFilter>(new FixationGazeFilter(this));
+                break;
+            case GazeFilterType::ONE_EURO:
+                mupGazeFilter = std::unique_ptr<GazeFilter>(new OneEuroGazeFilter(this));
+                break;
+            case GazeFilterType::KALMAN:
+                mupGazeFilter = std::unique_ptr<GazeFilter>(new KalmanGazeFilter(this));
+                break;
+            default:
+                mupGazeFilter = NULL;
+                break;
+            }
+        }
+    }
+
     GUI::GUIJob::GUIJob(GUI* pGUI)
     {
         mpGUI = pGUI;
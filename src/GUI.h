@@ -7,7 +7,9 @@
 // GUI class owning the layouts. Most access through interface is handled
 // using special job objects, which are executed before rendering. This
 // ensures that the vector of layouts is not changed during rendering and
-// notifications from elements can trigger GUI jobs.
+// notifications from elements can trigger GUI jobs. Drawing is recorded into
+// render snapshots, either executed right away or, when update runs on other
+// thread than drawing, published by update and executed by next drawing.
 
 #ifndef GUI_H_
 #define GUI_H_
@@ -22,8 +24,24 @@
 #include "Rendering/GLSetup.h"
 #include "Config.h"
 #include "Rendering/GazeDrawer.h"
-
+#include "Rendering/FrameCapturer.h"
+#include "Rendering/DamageRegion.h"
+#include "Rendering/RenderSnapshot.h"
+#include "Rendering/DeletionQueue.h"
+#include "Filter/GazeFilter.h"
+#include "src/Utilities/GazeSampleBuffer.h"
+#include "src/Utilities/InputRecorder.h"
+#include "src/Utilities/Profiler.h"
+#include "src/Utilities/Tracer.h"
+#include "src/Utilities/WorkerPool.h"
+#include "src/Utilities/LoadingThread.h"
+#include "src/Utilities/OperationNotifier.h"
+
+#include <atomic>
+#include <deque>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace eyegui
@@ -44,7 +62,8 @@ namespace eyegui
             float vectorGraphicsDPI,
             float fontTallSize,
             float fontMediumSize,
-            float fontSmallSize);
+            float fontSmallSize,
+            std::string recordingFilepath);
 
         // Destructor
         virtual ~GUI();
@@ -55,12 +74,31 @@ namespace eyegui
         // Remove layout
         void removeLayout(Layout const * pLayout);
 
+        // Load layout on loading thread, it is added at later update
+        std::shared_ptr<const AsyncLoading> addLayoutAsync(std::string filepath, bool visible, std::weak_ptr<LoadingListener> wpListener);
+
+        // Load brick on loading thread, floating frame with it is added at later update
+        std::shared_ptr<const AsyncLoading> addFloatingFrameWithBrickAsync(
+            Layout* pLayout,
+            std::string filepath,
+            float relativePositionX,
+            float relativePositionY,
+            float relativeSizeX,
+            float relativeSizeY,
+            std::map<std::string, std::string> idMapper,
+            bool visible,
+            bool fade,
+            std::weak_ptr<LoadingListener> wpListener);
+
         // Resize whole gui
         void resize(int width, int height);
 
         // Updating
         Input update(float tpf, const Input input);
 
+        // Push gaze sample, may be called from other thread than update
+        void pushGazeSample(float gazeX, float gazeY, double timestamp);
+
         // Drawing
         void draw() const;
 
@@ -73,6 +111,9 @@ namespace eyegui
         // Load a config
         void loadConfig(std::string filepath);
 
+        // Load localization on loading thread, it replaces current one at later update
+        void switchLocalization(std::string filepath);
+
         // Set gaze visualization drawing
         void setGazeVisualizationDrawing(bool draw);
 
@@ -82,9 +123,51 @@ namespace eyegui
         // Prefatch image to avoid lag
         void prefetchImage(std::string filepath);
 
+        // Forget loaded brick
+        void invalidateBrick(std::string filepath);
+
+        // Forget all loaded bricks
+        void invalidateAllBricks();
+
+        // Forget parsed stylesheet
+        void invalidateStylesheet(std::string filepath);
+
+        // Forget all parsed stylesheets
+        void invalidateAllStylesheets();
+
         // Set value of config attribute
         void setValueOfConfigAttribute(std::string attribute, std::string value);
 
+        // Enable or disable profiler
+        void setProfiling(bool enabled, bool gpuTiming);
+
+        // Get statistics of profiled phase
+        ProfileStatistics getProfileStatistics(ProfilePhase phase) const;
+
+        // Draw into offscreen framebuffer and read pixels back
+        bool captureFrame(FrameCapture& rCapture, bool wait);
+
+        // Enable or disable caching of static elements in layers
+        void setLayerCaching(bool enabled);
+
+        // Get count of elements drawn from layers
+        uint getCountOfCachedElements() const;
+
+        // Whether anything has changed since last drawing
+        bool needsRedraw() const;
+
+        // Get areas changed since last drawing
+        std::vector<DamageRect> getDamageRects() const;
+
+        // Enable or disable drawing of changed areas only
+        void setPartialRedraw(bool enabled);
+
+        // Enable or disable recording of snapshots by update, drawn by next drawing
+        void setRenderSnapshots(bool enabled);
+
+        // Enable or disable updating of frames on worker threads
+        void setParallelUpdate(bool enabled);
+
         // *** Methods accessed by other classes ***
 
         // Getter for window size
@@ -104,7 +187,7 @@ namespace eyegui
         Font const * getDefaultFont() const;
 
         // Get string content from localization
-        std::u16string getContentFromLocalization(std::string key) const;
+        const std::u16string& getContentFromLocalization(const std::string& rKey) const;
 
         // Get dpi for rasterization of vector graphics
         float getVectorGraphicsDPI() const;
@@ -112,6 +195,27 @@ namespace eyegui
         // Get size for font
         float getSizeOfFont(FontSize fontSize) const;
 
+        // Get filtered gaze samples of current update. Contains at least gaze of input
+        const std::vector<GazeSample>& getGazeSamples() const;
+
+        // Get recorder of input and calls, which is inactive if not recording
+        InputRecorder* getInputRecorder() const;
+
+        // Get frame profiler, which is disabled by default
+        Profiler* getProfiler() const;
+
+        // Whether static elements are cached in layers
+        bool isLayerCaching() const;
+
+        // Get areas changed since last drawing, filled by layouts and elements
+        DamageRegion* getDamageRegion() const;
+
+        // Get snapshot into which drawing is recorded
+        RenderSnapshot* getRecording() const;
+
+        // Get queue of OpenGL objects to delete by drawing thread
+        DeletionQueue* getDeletionQueue() const;
+
     private:
 
         // ### INNER CLASSES ###################################################
@@ -198,6 +302,65 @@ namespace eyegui
 
         // #####################################################################
 
+        // ### ASYNCHRONOUS LOADING ############################################
+
+        // Loading, which reads files on loading thread and is finished at update
+        struct PendingLoading
+        {
+            // Set before enqueueing
+            std::shared_ptr<AsyncLoading> spHandle;
+            std::weak_ptr<LoadingListener> wpListener;
+            std::string filepath;
+            bool brick;
+            bool visible;
+            Layout* pLayout; // layout of brick, NULL when removed meanwhile
+            float relativePositionX;
+            float relativePositionY;
+            float relativeSizeX;
+            float relativeSizeY;
+            std::map<std::string, std::string> idMapper;
+            bool fade;
+
+            // Filled by loading thread, read after ready is set
+            std::unique_ptr<CompiledDocument> upDocument;
+            std::unique_ptr<CompiledDocument> upStylesheet;
+            std::vector<std::pair<std::string, std::unique_ptr<DecodedImage> > > images;
+            std::vector<OperationNotifier::Notification> notifications; // emitted by update
+            std::atomic<bool> ready;
+        };
+
+        // Read documents and decode images, executed by loading thread
+        static void readPendingLoading(PendingLoading* pLoading);
+
+        // Enqueue loading for loading thread
+        void enqueuePendingLoading(std::shared_ptr<PendingLoading> spLoading);
+
+        // Create elements and textures of first pending loading if ready
+        void finishPendingLoading();
+
+        // Localization, which is parsed on loading thread and swapped at update
+        struct PendingLocalization
+        {
+            std::string filepath;
+            std::unique_ptr<LocalizationStore> upStore; // filled by loading thread, read after ready is set. NULL if parsing failed
+            std::vector<OperationNotifier::Notification> notifications; // emitted by update
+            std::atomic<bool> ready;
+        };
+
+        // Create loading thread if not yet done
+        void startLoadingThread();
+
+        // Swap in pending localization if ready
+        void finishPendingLocalization();
+
+        // Give text blocks content of switched localization, limited per update
+        void refreshLocalization();
+
+        // #####################################################################
+
+        // Record layout and add it before next update
+        Layout* enqueueLayout(std::unique_ptr<Layout> upLayout, std::string filepath, bool visible);
+
         // Find index of layout, returns -1 if fails
         int findLayout(Layout const * pLayout) const;
 
@@ -207,6 +370,30 @@ namespace eyegui
         // Internal resizing
         void internalResizing();
 
+        // Consume pushed gaze samples
+        void consumeGazeSamples();
+
+        // Update elements of all frames on worker threads, gaze is given to frames front to back beforehand
+        void updateLayoutsInParallel(float tpf, Input* pInput);
+
+        // Create gaze filter if type in config has changed
+        void updateGazeFilter();
+
+        // Drawing without recording of call, optionally restricted to damaged areas
+        void internalDraw(bool partial) const;
+
+        // Record drawing into recording snapshot, optionally restricted to damaged areas
+        void recordDrawing(bool partial) const;
+
+        // Execute snapshot with OpenGL state of GUI
+        void executeSnapshot(RenderSnapshot const * pSnapshot) const;
+
+        // Record drawing at end of update and hand it over to drawing
+        void publishSnapshot();
+
+        // Draw everything once
+        void drawEverything() const;
+
         // Members
         std::vector<std::unique_ptr<Layout> > mLayouts;
         int mWidth, mHeight;
@@ -219,7 +406,7 @@ namespace eyegui
         bool mResizing;
         float mResizeWaitTime;
         RenderItem const * mpResizeBlend;
-        std::unique_ptr<LocalizationMap> mupLocalizationMap;
+        std::unique_ptr<LocalizationStore> mupLocalizationStore;
         std::vector<std::unique_ptr<GUIJob> > mJobs;
         std::unique_ptr<GazeDrawer> mupGazeDrawer;
         bool mDrawGazeVisualization;
@@ -227,6 +414,30 @@ namespace eyegui
         float mFontTallSize;
         float mFontMediumSize;
         float mFontSmallSize;
+        GazeSampleBuffer mGazeSampleBuffer;
+        std::vector<GazeSample> mGazeSamples;
+        double mLastGazeSampleTimestamp;
+        std::unique_ptr<GazeFilter> mupGazeFilter;
+        GazeFilterType mGazeFilterType;
+        std::unique_ptr<InputRecorder> mupInputRecorder;
+        std::unique_ptr<Profiler> mupProfiler;
+        std::unique_ptr<FrameCapturer> mupFrameCapturer;
+        bool mLayerCaching;
+        std::unique_ptr<DamageRegion> mupDamageRegion;
+        bool mPartialRedraw;
+        std::unique_ptr<DeletionQueue> mupDeletionQueue;
+        std::unique_ptr<RenderSnapshot> mupRecording; // filled by update or drawing
+        std::unique_ptr<RenderSnapshot> mupPending; // published by update, not yet drawn
+        std::unique_ptr<RenderSnapshot> mupFront; // executed by drawing
+        mutable std::mutex mSnapshotMutex; // guards pending snapshot
+        mutable bool mPendingNew;
+        bool mRenderSnapshots;
+        std::unique_ptr<WorkerPool> mupWorkerPool; // only available for parallel update
+        std::deque<std::shared_ptr<PendingLoading> > mPendingLoadings;
+        std::shared_ptr<PendingLocalization> mspPendingLocalization; // only latest switch is swapped in
+        uint mLocalizationGeneration; // increased by each swap of localization
+        bool mLocalizationRefreshing; // text blocks may still show content of previous localization
+        std::unique_ptr<LoadingThread> mupLoadingThread; // created by first asynchronous loading
     };
 }
 
@@ -0,0 +1,93 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "Guesser.h"
+
+#include "Defines.h"
+#include "src/Utilities/Tracer.h"
+
+namespace eyegui
+{
+    Guesser::Guesser(LoadingThread* pGuessingThread, std::shared_ptr<SharedDictionary> spDictionary)
+    {
+        // Fill members
+        mpGuessingThread = pGuessingThread;
+        mspState = std::make_shared<State>();
+        mspState->spDictionary = spDictionary;
+        mspState->changed = false;
+
+        // Suggest most frequent words until something is typed
+        std::shared_ptr<State> spState = mspState;
+        mpGuessingThread->enqueue([spState]() { guess(spState.get(), u"", true); });
+    }
+
+    Guesser::~Guesser()
+    {
+        // Nothing to do
+    }
+
+    void Guesser::type(std::u16string value)
+    {
+        std::shared_ptr<State> spState = mspState;
+        mpGuessingThread->enqueue([spState, value]() { guess(spState.get(), value, false); });
+    }
+
+    void Guesser::setWord(std::u16string word)
+    {
+        std::shared_ptr<State> spState = mspState;
+        mpGuessingThread->enqueue([spState, word]() { guess(spState.get(), word, true); });
+    }
+
+    bool Guesser::fetchSuggestions(std::vector<std::u16string>& rSuggestions)
+    {
+        std::lock_guard<std::mutex> lock(mspState->mutex);
+        if (!mspState->changed)
+        {
+            return false;
+        }
+        rSuggestions = mspState->suggestions;
+        mspState->changed = false;
+        return true;
+    }
+
+    void Guesser::guess(State* pState, const std::u16string& rValue, bool restart)
+    {
+        EYEGUI_TRACE_SCOPE("Guesser::guess", pState->spDictionary->filepath);
+
+        // Dictionary is loaded by earlier task, which failed if not available
+        Dictionary const * pDictionary = pState->spDictionary->upDictionary.get();
+        if (pDictionary == NULL)
+        {
+            return;
+        }
+
+        // Follow typed characters through trie
+        if (restart)
+        {
+            pState->position = pDictionary->getRoot();
+        }
+        for (char16_t character : rValue)
+        {
+            if (KEYBOARD_WORD_DELIMITERS.find(character) != std::u16string::npos)
+            {
+                pState->position = pDictionary->getRoot();
+            }
+            else
+            {
+                pDictionary->advance(pState->position, character);
+            }
+        }
+
+        // Complete word outside of lock
+        std::vector<std::u16string> suggestions;
+        pDictionary->complete(pState->position, KEYBOARD_SUGGESTION_COUNT, suggestions);
+
+        std::lock_guard<std::mutex> lock(pState->mutex);
+        pState->suggestions.swap(suggestions);
+        pState->changed = true;
+    }
+}
@@ -0,0 +1,77 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Guesser suggests words of a dictionary which complete the word being typed.
+// Typed values are handled in order by the guessing thread, which loads the
+// dictionary beforehand, so typing never waits for it. The position in the
+// trie is advanced per typed character instead of searching the word again.
+// Created by asset manager, which shares dictionaries between guessers.
+
+#ifndef GUESSER_H_
+#define GUESSER_H_
+
+#include "Dictionary.h"
+#include "src/Utilities/LoadingThread.h"
+#include "src/Utilities/OperationNotifier.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace eyegui
+{
+    // Dictionary shared by guessers, only accessed by guessing thread until loaded is set
+    struct SharedDictionary
+    {
+        std::string filepath;
+        std::unique_ptr<Dictionary> upDictionary;
+        std::vector<OperationNotifier::Notification> notifications; // emitted by update
+        std::atomic<bool> loaded;
+    };
+
+    class Guesser
+    {
+    public:
+
+        // Constructor
+        Guesser(LoadingThread* pGuessingThread, std::shared_ptr<SharedDictionary> spDictionary);
+
+        // Destructor, pending guesses are dropped with the state
+        virtual ~Guesser();
+
+        // Continue word with typed value, delimiters start new word
+        void type(std::u16string value);
+
+        // Replace word being typed, e.g. after the user has deleted characters
+        void setWord(std::u16string word);
+
+        // Fill suggestions if they changed since last call, returns whether filled
+        bool fetchSuggestions(std::vector<std::u16string>& rSuggestions);
+
+    private:
+
+        // State kept alive by enqueued guesses
+        struct State
+        {
+            std::shared_ptr<SharedDictionary> spDictionary;
+            Dictionary::Position position; // only used by guessing thread
+            std::mutex mutex; // guards following members
+            std::vector<std::u16string> suggestions;
+            bool changed;
+        };
+
+        // Advance position by value and complete it, executed by guessing thread
+        static void guess(State* pState, const std::u16string& rValue, bool restart);
+
+        // Members
+        LoadingThread* mpGuessingThread;
+        std::shared_ptr<State> mspState;
+    };
+}
+
+#endif // GUESSER_H_
@@ -18,13 +18,15 @@
 
 namespace eyegui
 {
-    Layout::Layout(GUI const * pGUI, AssetManager* pAssetManager, std::string stylesheetFilepath)
+    Layout::Layout(GUI const * pGUI, AssetManager* pAssetManager, std::string filepath, std::string stylesheetFilepath, CompiledDocument const * pStylesheet)
     {
         // Initialize members
         mpGUI = pGUI;
         mpAssetManager = pAssetManager;
+        mFilepath = filepath;
         mupIds = NULL;
         mAlpha.setValue(1);
+        mDrawn = false;
         mVisible = true;
         mResizeNecessary = true;
         mUseInput = true;
@@ -32,8 +34,9 @@ namespace eyegui
         mupMainFrame = std::unique_ptr<Frame>(new Frame(this, 0, 0, 1, 1));
         mupNotificationQueue = std::unique_ptr<NotificationQueue>(new NotificationQueue(this));
 
-        // Parse style file
-        mupStyles = stylesheet_parser::parse(stylesheetFilepath);
+        // Get styles, which are shared with other layouts using the same stylesheet
+        mspSharedStyles = mpAssetManager->fetchStyles(stylesheetFilepath, pStylesheet);
+        mupOwnStyles = NULL;
     }
 
     Layout::~Layout()
@@ -43,32 +46,18 @@ namespace eyegui
 
     void Layout::update(float tpf, Input* pInput)
     {
-        // *** DELETION OF REMOVED FLOATING FRAMES ***
-        for (int i : mDyingFloatingFramesIndices)
-        {
-            mFloatingFramesOrderingIndices.erase(
-                std::remove(
-                    mFloatingFramesOrderingIndices.begin(), mFloatingFramesOrderingIndices.end(), i), mFloatingFramesOrderingIndices.end());
-            mFloatingFrames[i].reset(NULL);
-        }
-        mDyingFloatingFramesIndices.clear();
-
-        // *** RESIZING ***
-        internalResizing();
-
-        // *** NOTIFICATIONS ***
-        mupNotificationQueue->process();
+        EYEGUI_TRACE_SCOPE("Layout::update", mFilepath);
 
         // *** OWN UPDATE ***
-
-        // Update alpha
-        mAlpha.update(tpf / getConfig()->animationDuration, !mVisible);
+        beginUpdate(tpf);
 
         // *** UPDATE FRAMES ***
 
         // Update root only if own alpha greater zero
         if (mAlpha.getValue() > 0)
         {
+            EYEGUI_PROFILE_SCOPE(getProfiler(), ProfilePhase::ELEMENT_UPDATE);
+
             // Do not use input if still fading
             if (!mUseInput || mAlpha.getValue() < 1)
             {
@@ -85,19 +74,9 @@ namespace eyegui
                 {
                     if (pFrame->isRemoved())
                     {
-                        // Do fading of removed frame
-                        float fadingAlpha = pFrame->getRemovedFadingAlpha() - (tpf / getConfig()->animationDuration);
-                        fadingAlpha = clamp(fadingAlpha, 0, 1);
-                        pFrame->setRemovedFadingAlpha(fadingAlpha);
-
                         // Update
+                        fadeRemovedFloatingFrame(tpf, frameIndex);
                         pFrame->update(tpf, mAlpha.getValue(), NULL);
-
-                        // Delete frame in next update
-                        if (fadingAlpha <= 0)
-                        {
-                            mDyingFloatingFramesIndices.push_back(frameIndex);
-                        }
                     }
                     else
                     {
@@ -112,6 +91,62 @@ namespace eyegui
         }
     }
 
+    void Layout::prepareParallelUpdate(float tpf, Input* pInput, std::vector<FrameUpdate>& rFrameUpdates)
+    {
+        EYEGUI_TRACE_SCOPE("Layout::prepareParallelUpdate", mFilepath);
+
+        // *** OWN UPDATE ***
+        beginUpdate(tpf);
+
+        // *** PREPARE FRAMES ***
+
+        // Same order and conditions as in serial update
+        if (mAlpha.getValue() > 0)
+        {
+            if (!mUseInput || mAlpha.getValue() < 1)
+            {
+                pInput = NULL;
+            }
+
+            // Collect frames front to back
+            std::vector<Frame*> frames;
+            for (int i = (int)(mFloatingFramesOrderingIndices.size()) - 1; i >= 0; i--)
+            {
+                int frameIndex = mFloatingFramesOrderingIndices[i];
+                Frame* pFrame = mFloatingFrames[frameIndex].get();
+                if (pFrame != NULL)
+                {
+                    if (pFrame->isRemoved())
+                    {
+                        fadeRemovedFloatingFrame(tpf, frameIndex);
+                    }
+                    frames.push_back(pFrame);
+                }
+            }
+            frames.push_back(mupMainFrame.get());
+
+            // Frame getting gaze is decided before any element is updated
+            for (Frame* pFrame : frames)
+            {
+                pFrame->beginUpdate(tpf, mAlpha.getValue());
+
+                FrameUpdate frameUpdate;
+                frameUpdate.pFrame = pFrame;
+                frameUpdate.useInput = pInput != NULL && !pFrame->isRemoved();
+                if (frameUpdate.useInput)
+                {
+                    // Copy is taken before gaze may be marked as used
+                    frameUpdate.input = *pInput;
+                    if (pFrame->consumesGaze(pInput))
+                    {
+                        pInput->gazeUsed = true;
+                    }
+                }
+                rFrameUpdates.push_back(frameUpdate);
+            }
+        }
+    }
+
     void Layout::draw() const
     {
         // Use alpha because while fading it should still draw
@@ -183,35 +218,73 @@ namespace eyegui
         return mpGUI->getAccPeriodicTime();
     }
 
-    Style const * Layout::getStyleFromStylesheet(std::string styleName) const
+    StyleTable const * Layout::getStyles() const
     {
-        // Search for style
-        auto it = mupStyles->find(styleName);
+        return mupOwnStyles != NULL ? mupOwnStyles.get() : mspSharedStyles.get();
+    }
 
-        if (it != mupStyles->end())
+    const std::u16string& Layout::getContentFromLocalization(const std::string& rKey) const
+    {
+        return mpGUI->getContentFromLocalization(rKey);
+    }
+
+    const std::vector<GazeSample>& Layout::getGazeSamples() const
+    {
+        return mpGUI->getGazeSamples();
+    }
+
+    InputRecorder* Layout::getInputRecorder() const
+    {
+        return mpGUI->getInputRecorder();
+    }
+
+    Profiler* Layout::getProfiler() const
+    {
+        return mpGUI->getProfiler();
+    }
+
+    bool Layout::isLayerCaching() const
+    {
+        return mpGUI->isLayerCaching();
+    }
+
+    uint Layout::getCountOfCachedElements() const
+    {
+        uint count = 0;
+        if (mAlpha.getValue() > 0)
         {
-            return &(it->second);
+            count += mupMainFrame->getCountOfCachedElements();
+            for (const std::unique_ptr<Frame>& rupFrame : mFloatingFrames)
+            {
+                if (rupFrame != NULL)
+                {
+                    count += rupFrame->getCountOfCachedElements();
+                }
+            }
         }
-        else
+        return count;
+    }
+
+    void Layout::refreshLocalization(uint generation, uint& rBudget)
+    {
+        mupMainFrame->refreshLocalization(generation, rBudget);
+        for (std::unique_ptr<Frame>& rupFrame : mFloatingFrames)
         {
-            return NULL;
+            if (rupFrame != NULL)
+            {
+                rupFrame->refreshLocalization(generation, rBudget);
+            }
         }
     }
 
-    std::u16string Layout::getContentFromLocalization(std::string key) const
+    DamageRegion* Layout::getDamageRegion() const
     {
-        return mpGUI->getContentFromLocalization(key);
+        return mpGUI->getDamageRegion();
     }
 
-    std::set<std::string> Layout::getNamesOfAvailableStyles() const
+    std::string Layout::getFilepath() const
     {
-        std::set<std::string> names;
-        for (const std::pair<std::string, Style>& pair : *(mupStyles.get()))
-        {
-            names.insert(pair.first);
-        }
-
-        return names;
+        return mFilepath;
     }
 
     void Layout::setVisibility(bool visible, bool fade)
@@ -534,6 +607,121 @@ namespace eyegui
         }
     }
 
+    void Layout::setContentOfTextEdit(std::string id, std::u16string content)
+    {
+        TextEdit* pTextEdit = toTextEdit(fetchElement(id));
+        if (pTextEdit != NULL)
+        {
+            pTextEdit->setContent(content);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find text edit with id: " + id);
+        }
+    }
+
+    void Layout::setContentOfTextEdit(std::string id, std::string content)
+    {
+        // Check for valid UTF-8
+        if (utf8::is_valid(content.begin(), content.end()))
+        {
+            // Convert to 16 bit string
+            std::u16string content16;
+            utf8::utf8to16(content.begin(), content.end(), back_inserter(content16));
+
+            // Pipe it to method for 16 bit strings
+            setContentOfTextEdit(id, content16);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Invalid characters found in content. Please check unicode encoding of your source code. Following string was received: " + content);
+        }
+    }
+
+    std::u16string Layout::getContentOfTextEdit(std::string id) const
+    {
+        TextEdit* pTextEdit = toTextEdit(fetchElement(id));
+        if (pTextEdit != NULL)
+        {
+            return pTextEdit->getContent();
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find text edit with id: " + id);
+            return u"";
+        }
+    }
+
+    void Layout::addContentAtCursorInTextEdit(std::string id, std::u16string content)
+    {
+        TextEdit* pTextEdit = toTextEdit(fetchElement(id));
+        if (pTextEdit != NULL)
+        {
+            pTextEdit->addContentAtCursor(content);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find text edit with id: " + id);
+        }
+    }
+
+    void Layout::addContentAtCursorInTextEdit(std::string id, std::string content)
+    {
+        // Check for valid UTF-8
+        if (utf8::is_valid(content.begin(), content.end()))
+        {
+            // Convert to 16 bit string
+            std::u16string content16;
+            utf8::utf8to16(content.begin(), content.end(), back_inserter(content16));
+
+            // Pipe it to method for 16 bit strings
+            addContentAtCursorInTextEdit(id, content16);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Invalid characters found in content. Please check unicode encoding of your source code. Following string was received: " + content);
+        }
+    }
+
+    void Layout::deleteContentAtCursorInTextEdit(std::string id, int letterCount)
+    {
+        TextEdit* pTextEdit = toTextEdit(fetchElement(id));
+        if (pTextEdit != NULL)
+        {
+            pTextEdit->deleteContentAtCursor(letterCount);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find text edit with id: " + id);
+        }
+    }
+
+    void Layout::moveCursorOverLettersInTextEdit(std::string id, int letterCount)
+    {
+        TextEdit* pTextEdit = toTextEdit(fetchElement(id));
+        if (pTextEdit != NULL)
+        {
+            pTextEdit->moveCursorOverLetters(letterCount);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find text edit with id: " + id);
+        }
+    }
+
+    void Layout::moveCursorOverLinesInTextEdit(std::string id, int lineCount)
+    {
+        TextEdit* pTextEdit = toTextEdit(fetchElement(id));
+        if (pTextEdit != NULL)
+        {
+            pTextEdit->moveCursorOverLines(lineCount);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find text edit with id: " + id);
+        }
+    }
+
     void Layout::setFastTypingOfKeyboard(std::string id, bool useFastTyping)
     {
         Keyboard* pKeyboard = toKeyboard(fetchElement(id));
@@ -588,6 +776,49 @@ namespace eyegui
         }
     }
 
+    void Layout::setDictionaryOfKeyboard(std::string id, std::string filepath)
+    {
+        Keyboard* pKeyboard = toKeyboard(fetchElement(id));
+        if (pKeyboard != NULL)
+        {
+            pKeyboard->setDictionary(filepath);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find keyboard with id: " + id);
+        }
+    }
+
+    void Layout::setWordOfKeyboard(std::string id, std::u16string word)
+    {
+        Keyboard* pKeyboard = toKeyboard(fetchElement(id));
+        if (pKeyboard != NULL)
+        {
+            pKeyboard->setWord(word);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Cannot find keyboard with id: " + id);
+        }
+    }
+
+    void Layout::setWordOfKeyboard(std::string id, std::string word)
+    {
+        // Check for valid UTF-8
+        if (utf8::is_valid(word.begin(), word.end()))
+        {
+            // Convert to 16 bit string
+            std::u16string word16;
+            utf8::utf8to16(word.begin(), word.end(), back_inserter(word16));
+
+            setWordOfKeyboard(id, word16);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Invalid characters found in word. Please check unicode encoding of your source code. Following string was received: " + word);
+        }
+    }
+
     void Layout::registerButtonListener(std::string id, std::weak_ptr<ButtonListener> wpListener)
     {
         Button* pButton = toButton(fetchElement(id));
@@ -801,11 +1032,35 @@ namespace eyegui
     void Layout::setValueOfStyleAttribute(std::string styleName, std::string attribute, glm::vec4 value)
     {
         // Check, whether style exists
-        auto it = mupStyles->find(styleName);
-
-        if (it != mupStyles->end())
+        uint styleId = 0;
+        if (getStyles()->findId(styleName, styleId))
         {
-            stylesheet_parser::fillValue(it->second, attribute, value);
+            // Copy shared styles before first change, elements must use the copy afterwards
+            if (mupOwnStyles == NULL)
+            {
+                mupOwnStyles = std::unique_ptr<StyleTable>(new StyleTable(*(mspSharedStyles.get())));
+                mspSharedStyles = NULL;
+                mupMainFrame->refetchStyles();
+                for (std::unique_ptr<Frame>& rupFrame : mFloatingFrames)
+                {
+                    if (rupFrame != NULL)
+                    {
+                        rupFrame->refetchStyles();
+                    }
+                }
+            }
+            stylesheet_parser::fillValue(*(mupOwnStyles->getStyle(styleId)), attribute, value);
+
+            // Drawing of all elements using the style may have changed
+            getDamageRegion()->addFull();
+            mupMainFrame->invalidateLayer();
+            for (std::unique_ptr<Frame>& rupFrame : mFloatingFrames)
+            {
+                if (rupFrame != NULL)
+                {
+                    rupFrame->invalidateLayer();
+                }
+            }
         }
         else
         {
@@ -826,7 +1081,7 @@ namespace eyegui
             // Create new block
             std::unique_ptr<Block> upBlock = std::unique_ptr<Block>(new Block(
                 pElement->getId(),
-                pElement->getStyleName(),
+                pElement->getStyleId(),
                 pElement->getParent(),
                 pElement->getLayout(),
                 pElement->getFrame(),
@@ -863,7 +1118,7 @@ namespace eyegui
             // Create new picture
             std::unique_ptr<Picture> upPicture = std::unique_ptr<Picture>(new Picture(
                 pElement->getId(),
-                pElement->getStyleName(),
+                pElement->getStyleId(),
                 pElement->getParent(),
                 pElement->getLayout(),
                 pElement->getFrame(),
@@ -898,7 +1153,7 @@ namespace eyegui
             // Create new blank
             std::unique_ptr<Blank> upBlank = std::unique_ptr<Blank>(new Blank(
                 pElement->getId(),
-                pElement->getStyleName(),
+                pElement->getStyleId(),
                 pElement->getParent(),
                 pElement->getLayout(),
                 pElement->getFrame(),
@@ -931,7 +1186,7 @@ namespace eyegui
             // Create new picture
             std::unique_ptr<CircleButton> upCircleButton = std::unique_ptr<CircleButton>(new CircleButton(
                 pElement->getId(),
-                pElement->getStyleName(),
+                pElement->getStyleId(),
                 pElement->getParent(),
                 pElement->getLayout(),
                 pElement->getFrame(),
@@ -966,7 +1221,7 @@ namespace eyegui
             // Create new picture
             std::unique_ptr<BoxButton> upBoxButton = std::unique_ptr<BoxButton>(new BoxButton(
                 pElement->getId(),
-                pElement->getStyleName(),
+                pElement->getStyleId(),
                 pElement->getParent(),
                 pElement->getLayout(),
                 pElement->getFrame(),
@@ -1001,7 +1256,7 @@ namespace eyegui
             // Create new picture
             std::unique_ptr<Sensor> upSensor = std::unique_ptr<Sensor>(new Sensor(
                 pElement->getId(),
-                pElement->getStyleName(),
+                pElement->getStyleId(),
                 pElement->getParent(),
                 pElement->getLayout(),
                 pElement->getFrame(),
@@ -1047,7 +1302,7 @@ namespace eyegui
             // Create new text block
             std::unique_ptr<TextBlock> upTextBlock = std::unique_ptr<TextBlock>(new TextBlock(
                 pElement->getId(),
-                pElement->getStyleName(),
+                pElement->getStyleId(),
                 pElement->getParent(),
                 pElement->getLayout(),
                 pElement->getFrame(),
@@ -1288,6 +1543,7 @@ namespace eyegui
             }
 
             moveFloatingFrame(index, (int)(mFloatingFramesOrderingIndices.size()) - 1);
+            pFrame->damageArea();
         }
     }
 
@@ -1313,6 +1569,7 @@ namespace eyegui
             }
 
             moveFloatingFrame(index, 0);
+            pFrame->damageArea();
         }
     }
 
@@ -1364,6 +1621,54 @@ namespace eyegui
         }
     }
 
+    void Layout::beginUpdate(float tpf)
+    {
+        // *** DELETION OF REMOVED FLOATING FRAMES ***
+        for (int i : mDyingFloatingFramesIndices)
+        {
+            mFloatingFramesOrderingIndices.erase(
+                std::remove(
+                    mFloatingFramesOrderingIndices.begin(), mFloatingFramesOrderingIndices.end(), i), mFloatingFramesOrderingIndices.end());
+            mFloatingFrames[i].reset(NULL);
+        }
+        mDyingFloatingFramesIndices.clear();
+
+        // *** RESIZING ***
+        internalResizing();
+
+        // *** NOTIFICATIONS ***
+        {
+            EYEGUI_PROFILE_SCOPE(getProfiler(), ProfilePhase::NOTIFICATIONS);
+            mupNotificationQueue->process();
+        }
+
+        // Update alpha
+        mAlpha.update(tpf / getConfig()->animationDuration, !mVisible);
+
+        // Layout covers whole GUI, so appearing or disappearing changes everything
+        bool drawn = mAlpha.getValue() > 0;
+        if (drawn != mDrawn)
+        {
+            getDamageRegion()->addFull();
+            mDrawn = drawn;
+        }
+    }
+
+    void Layout::fadeRemovedFloatingFrame(float tpf, int frameIndex)
+    {
+        // Do fading of removed frame
+        Frame* pFrame = mFloatingFrames[frameIndex].get();
+        float fadingAlpha = pFrame->getRemovedFadingAlpha() - (tpf / getConfig()->animationDuration);
+        fadingAlpha = clamp(fadingAlpha, 0, 1);
+        pFrame->setRemovedFadingAlpha(fadingAlpha);
+
+        // Delete frame in next update
+        if (fadingAlpha <= 0)
+        {
+            mDyingFloatingFramesIndices.push_back(frameIndex);
+        }
+    }
+
     Element* Layout::fetchElement(std::string id) const
     {
         auto it = mupIds->find(id);
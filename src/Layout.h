@@ -16,22 +16,37 @@
 #include "include/eyeGUI.h"
 #include "Frame.h"
 #include "Style.h"
+#include "StyleTable.h"
 #include "Config.h"
 #include "Parser/StylesheetParser.h"
 #include "Parser/BrickParser.h"
 #include "NotificationQueue.h"
+#include "Rendering/DamageRegion.h"
 #include "src/Utilities/LerpValue.h"
+#include "src/Utilities/GazeSampleBuffer.h"
+#include "src/Utilities/InputRecorder.h"
+#include "src/Utilities/Profiler.h"
+#include "src/Utilities/Tracer.h"
 
 #include <memory>
 #include <map>
 #include <set>
 #include <utility>
+#include <vector>
 
 namespace eyegui
 {
     // Forward declaration
     class GUI;
 
+    // Updating of elements in one frame, prepared for parallel execution
+    struct FrameUpdate
+    {
+        Frame* pFrame;
+        bool useInput;
+        Input input; // Own copy of input, gaze is already marked as used if taken by frame in front
+    };
+
     class Layout
     {
     public:
@@ -40,7 +55,7 @@ namespace eyegui
         friend class NotificationQueue;
 
         // Constructor
-        Layout(GUI const * pGUI, AssetManager* pAssetManager, std::string stylesheetFilepath);
+        Layout(GUI const * pGUI, AssetManager* pAssetManager, std::string filepath, std::string stylesheetFilepath, CompiledDocument const * pStylesheet = NULL);
 
         // Destructor
         virtual ~Layout();
@@ -48,6 +63,10 @@ namespace eyegui
         // Updating
         void update(float tpf, Input* pInput);
 
+        // Own updating and preparation of frames for parallel updating of their elements.
+        // Gaze is marked as used in input if some frame of this layout takes it
+        void prepareParallelUpdate(float tpf, Input* pInput, std::vector<FrameUpdate>& rFrameUpdates);
+
         // Drawing
         void draw() const;
 
@@ -78,14 +97,35 @@ namespace eyegui
         // Get time from GUI
         float getAccPeriodicTime() const;
 
-        // Get pointer to styles of this layout. Returns NULL if not found
-        Style const * getStyleFromStylesheet(std::string styleName) const;
+        // Get styles of this layout
+        StyleTable const * getStyles() const;
 
         // Get string content from localization
-        std::u16string getContentFromLocalization(std::string key) const;
+        const std::u16string& getContentFromLocalization(const std::string& rKey) const;
+
+        // Get filtered gaze samples of current update of GUI
+        const std::vector<GazeSample>& getGazeSamples() const;
+
+        // Get recorder of input and calls from GUI
+        InputRecorder* getInputRecorder() const;
 
-        // Returns set of names of the available styles for this layout
-        std::set<std::string> getNamesOfAvailableStyles() const;
+        // Get frame profiler from GUI
+        Profiler* getProfiler() const;
+
+        // Whether static elements are cached in layers
+        bool isLayerCaching() const;
+
+        // Get count of elements drawn from layers of visible frames
+        uint getCountOfCachedElements() const;
+
+        // Take content of switched localization in frames, budget is decreased by changed text blocks
+        void refreshLocalization(uint generation, uint& rBudget);
+
+        // Get areas of GUI changed since last drawing
+        DamageRegion* getDamageRegion() const;
+
+        // Get filepath of layout file
+        std::string getFilepath() const;
 
         // Set visibility
         void setVisibility(bool visible, bool fade);
@@ -156,6 +196,30 @@ namespace eyegui
         // Set key of text block
         void setKeyOfTextBlock(std::string id, std::string key);
 
+        // Set content of text edit with 16 bit string
+        void setContentOfTextEdit(std::string id, std::u16string content);
+
+        // Set content of text edit with 8 bit string
+        void setContentOfTextEdit(std::string id, std::string content);
+
+        // Get content of text edit
+        std::u16string getContentOfTextEdit(std::string id) const;
+
+        // Add content at cursor of text edit with 16 bit string
+        void addContentAtCursorInTextEdit(std::string id, std::u16string content);
+
+        // Add content at cursor of text edit with 8 bit string
+        void addContentAtCursorInTextEdit(std::string id, std::string content);
+
+        // Delete content at cursor of text edit
+        void deleteContentAtCursorInTextEdit(std::string id, int letterCount);
+
+        // Move cursor of text edit over letters
+        void moveCursorOverLettersInTextEdit(std::string id, int letterCount);
+
+        // Move cursor of text edit over lines
+        void moveCursorOverLinesInTextEdit(std::string id, int lineCount);
+
         // Set fast typing for keyboard
         void setFastTypingOfKeyboard(std::string id, bool useFastTyping);
 
@@ -168,6 +232,15 @@ namespace eyegui
         // Set keymap of keyboard by index
         void setKeymapOfKeyboard(std::string id, uint keymapIndex);
 
+        // Set dictionary of keyboard
+        void setDictionaryOfKeyboard(std::string id, std::string filepath);
+
+        // Set word completed by suggestions of keyboard
+        void setWordOfKeyboard(std::string id, std::u16string word);
+
+        // Set word completed by suggestions of keyboard
+        void setWordOfKeyboard(std::string id, std::string word);
+
         // Register button listener
         void registerButtonListener(std::string id, std::weak_ptr<ButtonListener> wpListener);
 
@@ -294,6 +367,12 @@ namespace eyegui
         // Resize function
         void internalResizing();
 
+        // Updating of layout itself and deletion of removed floating frames
+        void beginUpdate(float tpf);
+
+        // Fade removed floating frame and mark it as dying when invisible
+        void fadeRemovedFloatingFrame(float tpf, int frameIndex);
+
         // Fetch pointer to element by id
         Element* fetchElement(std::string id) const;
 
@@ -315,16 +394,19 @@ namespace eyegui
         // Members
         GUI const * mpGUI;
         AssetManager* mpAssetManager;
+        std::string mFilepath;
         std::unique_ptr<Frame> mupMainFrame;
         std::unique_ptr<std::map<std::string, Element*> > mupIds;
         std::vector<std::unique_ptr<Frame> > mFloatingFrames;
         std::vector<int> mFloatingFramesOrderingIndices;
         std::vector<int> mDyingFloatingFramesIndices;
         LerpValue mAlpha;
+        bool mDrawn;
         bool mVisible;
         bool mResizeNecessary;
         bool mUseInput;
-        std::unique_ptr<std::map<std::string, Style> > mupStyles;
+        std::shared_ptr<const StyleTable> mspSharedStyles; // shared with other layouts until changed
+        std::unique_ptr<StyleTable> mupOwnStyles; // copy of shared styles, created at first change
         InteractiveElement* mpSelectedInteractiveElement;
         std::unique_ptr<NotificationQueue> mupNotificationQueue;
     };
@@ -18,4 +18,14 @@ namespace eyegui
     {
         // Nothing to do
     }
+
+    void KeyboardListener::wordsSuggested(Layout* /*pLayout*/, std::string /*id*/, std::vector<std::u16string> /*suggestions*/)
+    {
+        // Nothing to do
+    }
+
+    void KeyboardListener::wordsSuggested(Layout* /*pLayout*/, std::string /*id*/, std::vector<std::string> /*suggestions*/)
+    {
+        // Nothing to do
+    }
 }
@@ -0,0 +1,21 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "include/eyeGUI.h"
+
+namespace eyegui
+{
+    LoadingListener::LoadingListener()
+    {
+        // Nothing to do
+    }
+
+    LoadingListener::~LoadingListener()
+    {
+        // Nothing to do
+    }
+}
@@ -0,0 +1,111 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "LocalizationStore.h"
+
+#include "externals/utfcpp/source/utf8.h"
+
+#include <cstring>
+#include <iterator>
+
+namespace eyegui
+{
+    namespace
+    {
+        // FNV-1a hash of key
+        uint32_t hashKey(char const * pKey, uint32_t keyLength)
+        {
+            uint32_t hash = 2166136261U;
+            for (uint32_t i = 0; i < keyLength; i++)
+            {
+                hash ^= (uint32_t)(unsigned char)pKey[i];
+                hash *= 16777619U;
+            }
+            return hash;
+        }
+    }
+
+    LocalizationStore::LocalizationStore(std::string content, const std::vector<Entry>& rEntries)
+    {
+        // Initialize members
+        mContent = std::move(content);
+        mEntries.reserve(rEntries.size());
+
+        // Index is kept at most half full
+        uint32_t slotCount = 16;
+        while (slotCount < 2 * rEntries.size())
+        {
+            slotCount *= 2;
+        }
+        mSlots.resize(slotCount, 0);
+
+        // Insert entries, same key replaces value
+        for (const Entry& rEntry : rEntries)
+        {
+            uint32_t slot = findSlot(mContent.data() + rEntry.keyOffset, rEntry.keyLength);
+            if (mSlots[slot] == 0)
+            {
+                mEntries.push_back(rEntry);
+                mSlots[slot] = (uint32_t)mEntries.size();
+            }
+            else
+            {
+                mEntries[mSlots[slot] - 1] = rEntry;
+            }
+        }
+        mDecoded.resize(mEntries.size());
+    }
+
+    LocalizationStore::~LocalizationStore()
+    {
+        // Nothing to do
+    }
+
+    std::u16string const * LocalizationStore::find(const std::string& rKey) const
+    {
+        uint32_t index = mSlots[findSlot(rKey.data(), (uint32_t)rKey.size())];
+        if (index == 0)
+        {
+            return NULL;
+        }
+        index--;
+
+        // Convert value at first lookup, it was validated at parsing
+        std::unique_ptr<std::u16string>& rupDecoded = mDecoded[index];
+        if (rupDecoded == NULL)
+        {
+            const Entry& rEntry = mEntries[index];
+            char const * pValue = mContent.data() + rEntry.valueOffset;
+            rupDecoded = std::unique_ptr<std::u16string>(new std::u16string);
+            rupDecoded->reserve(rEntry.valueLength);
+            utf8::unchecked::utf8to16(pValue, pValue + rEntry.valueLength, std::back_inserter(*(rupDecoded.get())));
+        }
+        return rupDecoded.get();
+    }
+
+    uint LocalizationStore::getCount() const
+    {
+        return (uint)mEntries.size();
+    }
+
+    uint32_t LocalizationStore::findSlot(char const * pKey, uint32_t keyLength) const
+    {
+        // Linear probing, index always has empty slots
+        uint32_t mask = (uint32_t)mSlots.size() - 1;
+        uint32_t slot = hashKey(pKey, keyLength) & mask;
+        while (mSlots[slot] != 0)
+        {
+            const Entry& rEntry = mEntries[mSlots[slot] - 1];
+            if (rEntry.keyLength == keyLength && std::memcmp(mContent.data() + rEntry.keyOffset, pKey, keyLength) == 0)
+            {
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+}
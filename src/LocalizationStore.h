@@ -0,0 +1,61 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Entries of a localization file. Keys and values stay in the content of the
+// file and are found through a hash index. Values are converted to UTF-16 at
+// their first lookup only. Lookup is not thread safe.
+
+#ifndef LOCALIZATION_STORE_H_
+#define LOCALIZATION_STORE_H_
+
+#include "Defines.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eyegui
+{
+    class LocalizationStore
+    {
+    public:
+
+        // Entry with key and UTF-8 value as ranges of content
+        struct Entry
+        {
+            uint32_t keyOffset;
+            uint32_t keyLength;
+            uint32_t valueOffset;
+            uint32_t valueLength;
+        };
+
+        // Constructor, later entries replace earlier ones with same key
+        LocalizationStore(std::string content, const std::vector<Entry>& rEntries);
+
+        // Destructor
+        virtual ~LocalizationStore();
+
+        // Find value of key, returns NULL if not found
+        std::u16string const * find(const std::string& rKey) const;
+
+        // Get count of keys
+        uint getCount() const;
+
+    private:
+
+        // Find slot of key in index
+        uint32_t findSlot(char const * pKey, uint32_t keyLength) const;
+
+        // Members
+        std::string mContent;
+        std::vector<Entry> mEntries;
+        std::vector<uint32_t> mSlots; // index of entry plus one, zero is empty. Count is power of two
+        mutable std::vector<std::unique_ptr<std::u16string> > mDecoded;
+    };
+}
+
+#endif // LOCALIZATION_STORE_H_
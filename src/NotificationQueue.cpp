@@ -30,12 +30,15 @@ namespace eyegui
         // Ignore elements without id
         if(notifierId != EMPTY_STRING_ATTRIBUTE)
         {
+          std::lock_guard<std::mutex> lock(mMutex);
           mupNotificatons->push_back(NotificationPair(notifierId, notification));
         }
     }
 
     void NotificationQueue::process()
     {
+        EYEGUI_TRACE_SCOPE("NotificationQueue::process", mpLayout->getFilepath());
+
         // Repeat working on the notifications
         int loopCount = 0;
         while (mupNotificatons->size() > 0)
@@ -53,8 +56,12 @@ namespace eyegui
             else
             {
                 // Move notifications to local unique pointer and replace with empty one, which can be filled again
-                std::unique_ptr<NotificationVector> upNotifications = std::move(mupNotificatons);
-                mupNotificatons = std::unique_ptr<NotificationVector>(new NotificationVector);
+                std::unique_ptr<NotificationVector> upNotifications;
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    upNotifications = std::move(mupNotificatons);
+                    mupNotificatons = std::unique_ptr<NotificationVector>(new NotificationVector);
+                }
 
                 // Work on notifications
                 for (uint i = 0; i < upNotifications->size(); i++)
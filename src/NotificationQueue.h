@@ -13,6 +13,7 @@
 #include "Elements/NotifierElement.h"
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace eyegui
@@ -34,7 +35,8 @@ namespace eyegui
         // Destructor
         virtual ~NotificationQueue();
 
-        // Enqueue notification which is processed before next updating of layout
+        // Enqueue notification which is processed before next updating of layout.
+        // May be called by elements of frames updated in parallel
         void enqueue(std::string notifierId, NotificationType notification);
 
         // Process notifications
@@ -45,6 +47,7 @@ namespace eyegui
         // Member
         Layout* mpLayout;
         std::unique_ptr<NotificationVector> mupNotificatons;
+        std::mutex mMutex;
     };
 }
 
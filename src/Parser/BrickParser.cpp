@@ -23,20 +23,19 @@ namespace eyegui
                 throwError(OperationNotifier::Operation::PARSING, "Extension of file not as expected", filepath);
             }
 
-            // Read file
-            tinyxml2::XMLDocument doc;
-            doc.LoadFile(buildPath(filepath).c_str());
-            if (doc.Error())
+            // Brick is loaded only once and kept by asset manager as template
+            CompiledDocument const * pDocument = pAssetManager->fetchBrick(filepath);
+            CompiledDocument emptyDocument(CompiledDocument::Kind::BRICK);
+            if (pDocument == NULL)
             {
-                throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + doc.ErrorName(), filepath);
+                throwError(OperationNotifier::Operation::PARSING, "Brick file not found", filepath);
+                emptyDocument.finish();
+                pDocument = &emptyDocument;
             }
 
-            // Get first xml element
-            tinyxml2::XMLElement* xmlElement = doc.FirstChildElement();
-
             // Collect values to return
             std::unique_ptr<elementsAndIds> upPair = std::unique_ptr<elementsAndIds>(new elementsAndIds);
-            upPair = std::move(element_parser::parse(pLayout, pFrame, pAssetManager, pNotificationQueue, xmlElement, pParent, filepath, idMapper));
+            upPair = std::move(element_parser::parse(pLayout, pFrame, pAssetManager, pNotificationQueue, *pDocument, pDocument->getNode(0), pParent, filepath, idMapper));
 
             // Return the pair
             return std::move(upPair);
@@ -0,0 +1,295 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "CompiledDocument.h"
+
+#include "src/Defines.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace eyegui
+{
+    namespace
+    {
+        // Identifies files containing compiled documents
+        const char COMPILED_DOCUMENT_MAGIC[4] = { 'E', 'Y', 'E', 'C' };
+    }
+
+    CompiledDocument::CompiledDocument(Kind kind)
+    {
+        // Initialize members
+        mKind = kind;
+        mSourceHash = 0;
+        mpNodes = NULL;
+        mpStyles = NULL;
+        mpStrings = NULL;
+        mNodeCount = 0;
+        mStyleCount = 0;
+        mStringSize = 0;
+
+        // Offset zero is empty string
+        mBuildingStrings.push_back('\0');
+        mStringOffsets[""] = 0;
+    }
+
+    CompiledDocument::~CompiledDocument()
+    {
+        // Nothing to do
+    }
+
+    uint32_t CompiledDocument::addString(const std::string& rString)
+    {
+        // Same strings are stored only once
+        auto it = mStringOffsets.find(rString);
+        if (it != mStringOffsets.end())
+        {
+            return it->second;
+        }
+        uint32_t offset = (uint32_t)mBuildingStrings.size();
+        mBuildingStrings.append(rString);
+        mBuildingStrings.push_back('\0');
+        mStringOffsets[rString] = offset;
+        return offset;
+    }
+
+    uint32_t CompiledDocument::addNodes(uint32_t count)
+    {
+        uint32_t first = (uint32_t)mBuildingNodes.size();
+        Node node;
+        std::memset(&node, 0, sizeof(Node));
+        node.relativeScale = 1;
+        mBuildingNodes.resize(mBuildingNodes.size() + count, node);
+        return first;
+    }
+
+    CompiledDocument::Node& CompiledDocument::getBuildingNode(uint32_t index)
+    {
+        return mBuildingNodes[index];
+    }
+
+    void CompiledDocument::addStyle(const std::string& rName, const Style& rStyle)
+    {
+        StyleRecord record;
+        record.name = addString(rName);
+        glm::vec4 const * colors[10] =
+        {
+            &rStyle.color, &rStyle.backgroundColor, &rStyle.highlightColor, &rStyle.separatorColor, &rStyle.selectionColor,
+            &rStyle.iconColor, &rStyle.fontColor, &rStyle.dimColor, &rStyle.markColor, &rStyle.pickColor
+        };
+        for (int i = 0; i < 10; i++)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                record.values[i * 4 + j] = (*colors[i])[j];
+            }
+        }
+        mBuildingStyles.push_back(record);
+    }
+
+    void CompiledDocument::setSourceHash(uint64_t hash)
+    {
+        mSourceHash = hash;
+    }
+
+    void CompiledDocument::finish()
+    {
+        // Write sections into one block
+        Header header;
+        std::memset(&header, 0, sizeof(Header));
+        std::memcpy(header.magic, COMPILED_DOCUMENT_MAGIC, sizeof(header.magic));
+        header.version = COMPILED_DOCUMENT_VERSION;
+        header.kind = mKind;
+        header.nodeCount = (uint32_t)mBuildingNodes.size();
+        header.sourceHash = mSourceHash;
+        header.styleCount = (uint32_t)mBuildingStyles.size();
+        header.stringSize = (uint32_t)mBuildingStrings.size();
+
+        mData.resize(
+            sizeof(Header)
+            + mBuildingNodes.size() * sizeof(Node)
+            + mBuildingStyles.size() * sizeof(StyleRecord)
+            + mBuildingStrings.size());
+        char* pData = mData.data();
+        std::memcpy(pData, &header, sizeof(Header));
+        pData += sizeof(Header);
+        if (!mBuildingNodes.empty())
+        {
+            std::memcpy(pData, mBuildingNodes.data(), mBuildingNodes.size() * sizeof(Node));
+            pData += mBuildingNodes.size() * sizeof(Node);
+        }
+        if (!mBuildingStyles.empty())
+        {
+            std::memcpy(pData, mBuildingStyles.data(), mBuildingStyles.size() * sizeof(StyleRecord));
+            pData += mBuildingStyles.size() * sizeof(StyleRecord);
+        }
+        std::memcpy(pData, mBuildingStrings.data(), mBuildingStrings.size());
+
+        // Not needed anymore
+        mBuildingNodes.clear();
+        mBuildingStyles.clear();
+        mBuildingStrings.clear();
+        mStringOffsets.clear();
+
+        mapSections();
+    }
+
+    bool CompiledDocument::load(std::string fullFilepath)
+    {
+        std::ifstream in(fullFilepath.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+        if (!in)
+        {
+            return false;
+        }
+
+        // Read whole file at once
+        std::streamoff size = in.tellg();
+        if (size < (std::streamoff)sizeof(Header))
+        {
+            return false;
+        }
+        mData.resize((size_t)size);
+        in.seekg(0, std::ios::beg);
+        if (!in.read(mData.data(), size))
+        {
+            mData.clear();
+            return false;
+        }
+
+        // Sections are used in place
+        if (!mapSections())
+        {
+            mData.clear();
+            return false;
+        }
+        return true;
+    }
+
+    bool CompiledDocument::save(std::string fullFilepath) const
+    {
+        if (mData.empty())
+        {
+            return false;
+        }
+        std::ofstream out(fullFilepath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            return false;
+        }
+        out.write(mData.data(), mData.size());
+        return (bool)out;
+    }
+
+    CompiledDocument::Kind CompiledDocument::getKind() const
+    {
+        return mKind;
+    }
+
+    uint64_t CompiledDocument::getSourceHash() const
+    {
+        return mSourceHash;
+    }
+
+    CompiledDocument::Node const * CompiledDocument::getNode(uint32_t index) const
+    {
+        return index < mNodeCount ? &(mpNodes[index]) : NULL;
+    }
+
+    uint32_t CompiledDocument::getNodeCount() const
+    {
+        return mNodeCount;
+    }
+
+    CompiledDocument::StyleRecord const * CompiledDocument::getStyle(uint32_t index) const
+    {
+        return index < mStyleCount ? &(mpStyles[index]) : NULL;
+    }
+
+    uint32_t CompiledDocument::getStyleCount() const
+    {
+        return mStyleCount;
+    }
+
+    char const * CompiledDocument::getString(uint32_t offset) const
+    {
+        return mpStrings + offset;
+    }
+
+    void CompiledDocument::fillStyle(StyleRecord const * pRecord, Style& rStyle) const
+    {
+        glm::vec4* colors[10] =
+        {
+            &rStyle.color, &rStyle.backgroundColor, &rStyle.highlightColor, &rStyle.separatorColor, &rStyle.selectionColor,
+            &rStyle.iconColor, &rStyle.fontColor, &rStyle.dimColor, &rStyle.markColor, &rStyle.pickColor
+        };
+        for (int i = 0; i < 10; i++)
+        {
+            *colors[i] = glm::vec4(pRecord->values[i * 4], pRecord->values[i * 4 + 1], pRecord->values[i * 4 + 2], pRecord->values[i * 4 + 3]);
+        }
+    }
+
+    bool CompiledDocument::mapSections()
+    {
+        // Check header
+        Header header;
+        std::memcpy(&header, mData.data(), sizeof(Header));
+        if (std::memcmp(header.magic, COMPILED_DOCUMENT_MAGIC, sizeof(header.magic)) != 0
+            || header.version != COMPILED_DOCUMENT_VERSION
+            || header.kind != mKind)
+        {
+            return false;
+        }
+
+        // Check size of sections
+        uint64_t expectedSize =
+            (uint64_t)sizeof(Header)
+            + (uint64_t)header.nodeCount * sizeof(Node)
+            + (uint64_t)header.styleCount * sizeof(StyleRecord)
+            + (uint64_t)header.stringSize;
+        if (expectedSize != (uint64_t)mData.size() || header.stringSize == 0)
+        {
+            return false;
+        }
+
+        // Set pointers
+        mSourceHash = header.sourceHash;
+        mNodeCount = header.nodeCount;
+        mStyleCount = header.styleCount;
+        mStringSize = header.stringSize;
+        mpNodes = (Node const *)(mData.data() + sizeof(Header));
+        mpStyles = (StyleRecord const *)((char const *)mpNodes + mNodeCount * sizeof(Node));
+        mpStrings = (char const *)mpStyles + mStyleCount * sizeof(StyleRecord);
+
+        // References must stay within document, so broken files cannot crash
+        if (mpStrings[mStringSize - 1] != '\0')
+        {
+            return false;
+        }
+        for (uint32_t i = 0; i < mNodeCount; i++)
+        {
+            const Node& rNode = mpNodes[i];
+            if ((uint64_t)rNode.firstChild + rNode.childCount > mNodeCount
+                || (rNode.childCount > 0 && rNode.firstChild <= i)
+                || rNode.id >= mStringSize
+                || rNode.style >= mStringSize
+                || rNode.backgroundFilepath >= mStringSize
+                || rNode.text >= mStringSize
+                || rNode.key >= mStringSize)
+            {
+                return false;
+            }
+        }
+        for (uint32_t i = 0; i < mStyleCount; i++)
+        {
+            if (mpStyles[i].name >= mStringSize)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
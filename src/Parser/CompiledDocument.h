@@ -0,0 +1,173 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Compact binary representation of a parsed layout, brick or stylesheet. All
+// attributes are already converted to typed values and element types to an
+// enumeration. Document is one block of memory with fixed size records and
+// a table of strings, which are referenced by offsets only. Therefore, a file
+// containing it is loaded as a whole and used in place, only pointers to the
+// sections have to be set. Multi-byte values are stored in native byte order.
+
+#ifndef COMPILED_DOCUMENT_H_
+#define COMPILED_DOCUMENT_H_
+
+#include "src/Style.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace eyegui
+{
+    class CompiledDocument
+    {
+    public:
+
+        // Kind of source file
+        enum class Kind : uint32_t { LAYOUT, BRICK, STYLESHEET };
+
+        // Type of node in element tree. Rows and columns of grids are nodes, too
+        enum class NodeType : uint16_t
+        {
+            LAYOUT, GRID, ROW, COLUMN, BLANK, BLOCK, PICTURE, STACK, TEXT_BLOCK,
+            CIRCLE_BUTTON, BOX_BUTTON, SENSOR, DROP_BUTTON, KEYBOARD, TEXT_EDIT
+        };
+
+        // Flags of node
+        static const uint16_t FLAG_DIMMING = 1;
+        static const uint16_t FLAG_ADAPTIVE_SCALING = 2;
+        static const uint16_t FLAG_CONSUME_INPUT = 4;
+        static const uint16_t FLAG_SHOW_BACKGROUND = 8;
+        static const uint16_t FLAG_SWITCH = 16;
+
+        // Node of element tree. Children of a node are stored next to each other.
+        // Meaning of type specific values:
+        // LAYOUT: text = stylesheet
+        // ROW, COLUMN: values[0] = size
+        // PICTURE: text = src, enums[0] = alignment
+        // STACK: values[0] = padding, values[1] = separator, enums[0] = relative scaling, enums[1] = alignment
+        // TEXT_BLOCK: text = content, key = key, values[0] = text scale, enums[0] = font size, enums[1] = alignment, enums[2] = vertical alignment
+        // TEXT_EDIT: text = content, values[0] = text scale, enums[0] = font size
+        // CIRCLE_BUTTON, BOX_BUTTON, SENSOR: text = icon
+        // DROP_BUTTON: text = icon, values[0] = space
+        struct Node
+        {
+            NodeType type;
+            uint16_t flags;
+            uint32_t firstChild;
+            uint32_t childCount;
+            uint32_t id; // Strings are offsets into string table, zero is empty string
+            uint32_t style;
+            uint32_t backgroundFilepath;
+            uint32_t text;
+            uint32_t key;
+            float relativeScale;
+            float border;
+            float innerBorder;
+            float values[2];
+            uint8_t backgroundAlignment;
+            uint8_t enums[3];
+        };
+
+        // Style of stylesheet
+        struct StyleRecord
+        {
+            uint32_t name;
+            float values[40]; // Colors in order of style struct
+        };
+
+        // Constructor of empty document
+        CompiledDocument(Kind kind);
+
+        // Destructor
+        virtual ~CompiledDocument();
+
+        // *** Building ***
+
+        // Add string to table, returns its offset
+        uint32_t addString(const std::string& rString);
+
+        // Add nodes which are stored next to each other, returns index of first one
+        uint32_t addNodes(uint32_t count);
+
+        // Get node while building
+        Node& getBuildingNode(uint32_t index);
+
+        // Add style
+        void addStyle(const std::string& rName, const Style& rStyle);
+
+        // Set hash of source file
+        void setSourceHash(uint64_t hash);
+
+        // Finish building, document may be used afterwards
+        void finish();
+
+        // *** Loading and saving ***
+
+        // Load from file, returns false if not existing, outdated or broken
+        bool load(std::string fullFilepath);
+
+        // Save to file, returns whether successful
+        bool save(std::string fullFilepath) const;
+
+        // *** Access ***
+
+        // Get kind of source
+        Kind getKind() const;
+
+        // Get hash of source file
+        uint64_t getSourceHash() const;
+
+        // Get node, root is first one
+        Node const * getNode(uint32_t index) const;
+        uint32_t getNodeCount() const;
+
+        // Get style
+        StyleRecord const * getStyle(uint32_t index) const;
+        uint32_t getStyleCount() const;
+
+        // Get string by offset
+        char const * getString(uint32_t offset) const;
+
+        // Fill style struct from record
+        void fillStyle(StyleRecord const * pRecord, Style& rStyle) const;
+
+    private:
+
+        // Header at beginning of data
+        struct Header
+        {
+            char magic[4];
+            uint32_t version;
+            Kind kind;
+            uint32_t nodeCount;
+            uint64_t sourceHash;
+            uint32_t styleCount;
+            uint32_t stringSize;
+        };
+
+        // Set pointers to sections of data, returns false if data is broken
+        bool mapSections();
+
+        // Members
+        Kind mKind;
+        uint64_t mSourceHash;
+        std::vector<char> mData; // Complete document after finishing or loading
+        Node const * mpNodes;
+        StyleRecord const * mpStyles;
+        char const * mpStrings;
+        uint32_t mNodeCount;
+        uint32_t mStyleCount;
+        uint32_t mStringSize;
+        std::vector<Node> mBuildingNodes;
+        std::vector<StyleRecord> mBuildingStyles;
+        std::string mBuildingStrings;
+        std::map<std::string, uint32_t> mStringOffsets;
+    };
+}
+
+#endif // COMPILED_DOCUMENT_H_
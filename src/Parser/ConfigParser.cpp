@@ -176,6 +176,53 @@ namespace eyegui
             {
                 rConfig.keyboardSpeedMultiplier = std::stof(value);
             }
+            else if (attribute == "gaze-filter")
+            {
+                if (value == "none")
+                {
+                    rConfig.gazeFilterType = GazeFilterType::NONE;
+                }
+                else if (value == "fixation")
+                {
+                    rConfig.gazeFilterType = GazeFilterType::FIXATION;
+                }
+                else if (value == "one-euro")
+                {
+                    rConfig.gazeFilterType = GazeFilterType::ONE_EURO;
+                }
+                else if (value == "kalman")
+                {
+                    rConfig.gazeFilterType = GazeFilterType::KALMAN;
+                }
+                else
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "Unknown gaze filter: " + value, filepath);
+                }
+            }
+            else if (attribute == "gaze-filter-fixation-radius")
+            {
+                rConfig.gazeFilterFixationRadius = std::stof(value);
+            }
+            else if (attribute == "gaze-filter-one-euro-min-cutoff")
+            {
+                rConfig.gazeFilterOneEuroMinCutoff = std::stof(value);
+            }
+            else if (attribute == "gaze-filter-one-euro-beta")
+            {
+                rConfig.gazeFilterOneEuroBeta = std::stof(value);
+            }
+            else if (attribute == "gaze-filter-one-euro-derivative-cutoff")
+            {
+                rConfig.gazeFilterOneEuroDerivativeCutoff = std::stof(value);
+            }
+            else if (attribute == "gaze-filter-kalman-process-noise")
+            {
+                rConfig.gazeFilterKalmanProcessNoise = std::stof(value);
+            }
+            else if (attribute == "gaze-filter-kalman-measurement-noise")
+            {
+                rConfig.gazeFilterKalmanMeasurementNoise = std::stof(value);
+            }
             else
             {
                 throwError(OperationNotifier::Operation::PARSING, "Unknown value on left side of '=': " + attribute, filepath);
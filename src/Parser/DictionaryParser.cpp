@@ -0,0 +1,128 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "DictionaryParser.h"
+
+#include "Defines.h"
+#include "src/Utilities/Helper.h"
+#include "src/Utilities/OperationNotifier.h"
+#include "src/Utilities/PathBuilder.h"
+#include "src/Utilities/Tracer.h"
+#include "externals/utfcpp/source/utf8.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+namespace eyegui
+{
+    namespace dictionary_parser
+    {
+        std::unique_ptr<Dictionary> parse(std::string filepath)
+        {
+            EYEGUI_TRACE_SCOPE("dictionary_parser::parse", filepath);
+
+            // Check file name
+            if (!checkFileNameExtension(filepath, DICTIONARY_EXTENSION))
+            {
+                throwError(OperationNotifier::Operation::PARSING, "Extension of file not as expected", filepath);
+            }
+
+            // Read whole file
+            std::string content;
+            std::ifstream in(buildPath(filepath).c_str(), std::ios::binary);
+
+            // Check whether file was found
+            if (!in)
+            {
+                throwError(OperationNotifier::Operation::PARSING, "Dictionary file not found", filepath);
+            }
+            else
+            {
+                content.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+            }
+
+            // Count lines for ranking of words without frequency
+            uint32_t lineCount = 0;
+            for (char c : content)
+            {
+                if (c == '\n')
+                {
+                    lineCount++;
+                }
+            }
+            lineCount++;
+
+            // Iterate through lines
+            std::vector<Dictionary::Word> words;
+            uint32_t line = 0;
+            size_t begin = 0;
+            while (begin < content.size())
+            {
+                size_t end = content.find('\n', begin);
+                if (end == std::string::npos)
+                {
+                    end = content.size();
+                }
+
+                // Ignore carriage return and trailing whitespace
+                size_t last = end;
+                while (last > begin && (content[last - 1] == '\r' || content[last - 1] == ' ' || content[last - 1] == '\t'))
+                {
+                    last--;
+                }
+
+                // Frequency follows last whitespace, if it is a number
+                Dictionary::Word word;
+                word.frequency = lineCount - line;
+                size_t wordEnd = last;
+                size_t separator = content.find_last_of(" \t", last == begin ? begin : last - 1);
+                if (separator != std::string::npos && separator >= begin && separator + 1 < last)
+                {
+                    bool number = true;
+                    uint64_t frequency = 0;
+                    for (size_t i = separator + 1; i < last && number; i++)
+                    {
+                        number = content[i] >= '0' && content[i] <= '9';
+                        frequency = std::min(frequency * 10 + (uint64_t)(content[i] - '0'), (uint64_t)std::numeric_limits<uint32_t>::max());
+                    }
+                    if (number)
+                    {
+                        word.frequency = (uint32_t)frequency;
+                        wordEnd = separator;
+                        while (wordEnd > begin && (content[wordEnd - 1] == ' ' || content[wordEnd - 1] == '\t'))
+                        {
+                            wordEnd--;
+                        }
+                    }
+                }
+
+                // Check for invalid utf-8
+                if (utf8::find_invalid(content.begin() + begin, content.begin() + wordEnd) != content.begin() + wordEnd)
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "Invalid UTF-8 encoding detected at line " + std::to_string(line + 1), filepath);
+                }
+                else if (wordEnd > begin)
+                {
+                    utf8::utf8to16(content.begin() + begin, content.begin() + wordEnd, back_inserter(word.value));
+                    words.push_back(std::move(word));
+                }
+
+                // Next line
+                begin = end + 1;
+                line++;
+            }
+
+            // Content is not needed by trie
+            content.clear();
+            content.shrink_to_fit();
+
+            return std::unique_ptr<Dictionary>(new Dictionary(std::move(words)));
+        }
+    }
+}
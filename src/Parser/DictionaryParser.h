@@ -0,0 +1,28 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Parser for dictionary files. Each line holds one word, optionally followed
+// by whitespace and its frequency. Words without frequency are ranked by
+// their line, earlier lines first.
+
+#ifndef DICTIONARY_PARSER_H_
+#define DICTIONARY_PARSER_H_
+
+#include "src/Dictionary.h"
+
+#include <memory>
+#include <string>
+
+namespace eyegui
+{
+    namespace dictionary_parser
+    {
+        // Parsing
+        std::unique_ptr<Dictionary> parse(std::string filepath);
+    }
+}
+
+#endif // DICTIONARY_PARSER_H_
@@ -0,0 +1,743 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "DocumentCompiler.h"
+
+#include "StylesheetParser.h"
+#include "Elements/Blocks/Container/Stack.h"
+#include "src/Utilities/OperationNotifier.h"
+#include "src/Utilities/Helper.h"
+#include "src/Utilities/PathBuilder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+
+namespace eyegui
+{
+    namespace document_compiler
+    {
+        namespace
+        {
+            // Whether compiled files are saved while loading
+            std::atomic<bool> caching(false);
+
+            // FNV-1a hash of content of source file
+            uint64_t hashContent(const std::string& rContent)
+            {
+                uint64_t hash = 14695981039346656037ULL;
+                for (char c : rContent)
+                {
+                    hash ^= (uint64_t)(unsigned char)c;
+                    hash *= 1099511628211ULL;
+                }
+                return hash;
+            }
+
+            // Read whole file, returns false if not found
+            bool readFile(std::string fullFilepath, std::string& rContent)
+            {
+                std::ifstream in(fullFilepath.c_str(), std::ios::in | std::ios::binary);
+                if (!in)
+                {
+                    return false;
+                }
+                std::stringstream strStream;
+                strStream << in.rdbuf();
+                rContent = strStream.str();
+                return true;
+            }
+
+            // Compile content of given kind
+            std::unique_ptr<CompiledDocument> compile(CompiledDocument::Kind kind, const std::string& rContent, std::string filepath)
+            {
+                switch (kind)
+                {
+                case CompiledDocument::Kind::LAYOUT:
+                    return compileLayout(rContent, filepath);
+                case CompiledDocument::Kind::BRICK:
+                    return compileBrick(rContent, filepath);
+                default:
+                    return compileStylesheet(rContent, filepath);
+                }
+            }
+        }
+
+        std::unique_ptr<CompiledDocument> load(std::string filepath, CompiledDocument::Kind kind)
+        {
+            std::string fullFilepath = buildPath(filepath);
+            std::string compiledFilepath = fullFilepath + COMPILED_FILE_SUFFIX;
+
+            // Read source file, it is not necessary when compiled file exists
+            std::string content;
+            bool sourceFound = readFile(fullFilepath, content);
+
+            // Try compiled file, which must belong to current content of source file
+            std::unique_ptr<CompiledDocument> upDocument = std::unique_ptr<CompiledDocument>(new CompiledDocument(kind));
+            if (upDocument->load(compiledFilepath) && (!sourceFound || upDocument->getSourceHash() == hashContent(content)))
+            {
+                return std::move(upDocument);
+            }
+
+            // Nothing to compile
+            if (!sourceFound)
+            {
+                return NULL;
+            }
+
+            // Compile source file
+            unsigned int errorCount = OperationNotifier::getErrorCount();
+            upDocument = std::move(compile(kind, content, filepath));
+
+            // Only save compiled files of sources without errors
+            if (caching && errorCount == OperationNotifier::getErrorCount())
+            {
+                if (!upDocument->save(compiledFilepath))
+                {
+                    throwWarning(OperationNotifier::Operation::PARSING, "Compiled file could not be saved", filepath + COMPILED_FILE_SUFFIX);
+                }
+            }
+
+            return std::move(upDocument);
+        }
+
+        bool compileFile(std::string filepath)
+        {
+            // Determine kind by extension
+            CompiledDocument::Kind kind;
+            if (checkFileNameExtension(filepath, LAYOUT_EXTENSION))
+            {
+                kind = CompiledDocument::Kind::LAYOUT;
+            }
+            else if (checkFileNameExtension(filepath, BRICK_EXTENSION))
+            {
+                kind = CompiledDocument::Kind::BRICK;
+            }
+            else if (checkFileNameExtension(filepath, STYLESHEET_EXTENSION))
+            {
+                kind = CompiledDocument::Kind::STYLESHEET;
+            }
+            else
+            {
+                throwError(OperationNotifier::Operation::PARSING, "Extension of file cannot be compiled", filepath);
+                return false;
+            }
+
+            // Read source file
+            std::string content;
+            if (!readFile(buildPath(filepath), content))
+            {
+                throwError(OperationNotifier::Operation::PARSING, "File not found", filepath);
+                return false;
+            }
+
+            // Compile and save it
+            unsigned int errorCount = OperationNotifier::getErrorCount();
+            std::unique_ptr<CompiledDocument> upDocument = std::move(compile(kind, content, filepath));
+            if (errorCount != OperationNotifier::getErrorCount())
+            {
+                return false;
+            }
+            if (!upDocument->save(buildPath(filepath) + COMPILED_FILE_SUFFIX))
+            {
+                throwError(OperationNotifier::Operation::PARSING, "Compiled file could not be saved", filepath + COMPILED_FILE_SUFFIX);
+                return false;
+            }
+            return true;
+        }
+
+        void setCaching(bool enabled)
+        {
+            caching = enabled;
+        }
+
+        std::unique_ptr<CompiledDocument> compileLayout(const std::string& rContent, std::string filepath)
+        {
+            std::unique_ptr<CompiledDocument> upDocument = std::unique_ptr<CompiledDocument>(new CompiledDocument(CompiledDocument::Kind::LAYOUT));
+            upDocument->setSourceHash(hashContent(rContent));
+
+            // Parse xml
+            tinyxml2::XMLDocument doc;
+            doc.Parse(rContent.c_str(), rContent.size());
+            if (doc.Error())
+            {
+                throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + doc.ErrorName(), filepath);
+            }
+
+            // First xml element should be a layout
+            tinyxml2::XMLElement const * xmlLayout = doc.FirstChildElement();
+            if (!validateElement(xmlLayout, "layout"))
+            {
+                throwError(OperationNotifier::Operation::PARSING, "No layout node as root in XML found", filepath);
+                upDocument->finish();
+                return std::move(upDocument);
+            }
+
+            // Layout node with path to stylesheet
+            uint32_t layoutIndex = upDocument->addNodes(1);
+            upDocument->getBuildingNode(layoutIndex).type = CompiledDocument::NodeType::LAYOUT;
+            upDocument->getBuildingNode(layoutIndex).text = upDocument->addString(parseStringAttribute("stylesheet", xmlLayout));
+
+            // Then there should be an element
+            tinyxml2::XMLElement const * xmlRoot = xmlLayout->FirstChildElement();
+            if (xmlRoot == NULL)
+            {
+                throwError(OperationNotifier::Operation::PARSING, "Layout has no element", filepath);
+            }
+            else
+            {
+                uint32_t rootIndex = upDocument->addNodes(1);
+                upDocument->getBuildingNode(layoutIndex).firstChild = rootIndex;
+                upDocument->getBuildingNode(layoutIndex).childCount = 1;
+                compileElement(*(upDocument.get()), rootIndex, xmlRoot, filepath);
+            }
+
+            upDocument->finish();
+            return std::move(upDocument);
+        }
+
+        std::unique_ptr<CompiledDocument> compileBrick(const std::string& rContent, std::string filepath)
+        {
+            std::unique_ptr<CompiledDocument> upDocument = std::unique_ptr<CompiledDocument>(new CompiledDocument(CompiledDocument::Kind::BRICK));
+            upDocument->setSourceHash(hashContent(rContent));
+
+            // Parse xml
+            tinyxml2::XMLDocument doc;
+            doc.Parse(rContent.c_str(), rContent.size());
+            if (doc.Error())
+            {
+                throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + doc.ErrorName(), filepath);
+            }
+
+            // First xml element is root, without one there are no nodes
+            tinyxml2::XMLElement const * xmlElement = doc.FirstChildElement();
+            if (xmlElement != NULL)
+            {
+                compileElement(*(upDocument.get()), upDocument->addNodes(1), xmlElement, filepath);
+            }
+
+            upDocument->finish();
+            return std::move(upDocument);
+        }
+
+        std::unique_ptr<CompiledDocument> compileStylesheet(const std::string& rContent, std::string filepath)
+        {
+            std::unique_ptr<CompiledDocument> upDocument = std::unique_ptr<CompiledDocument>(new CompiledDocument(CompiledDocument::Kind::STYLESHEET));
+            upDocument->setSourceHash(hashContent(rContent));
+
+            // Stylesheet parser does the actual work
+            std::unique_ptr<std::map<std::string, Style> > upStyles = std::move(stylesheet_parser::parseContent(rContent, filepath));
+            for (const auto& rPair : *(upStyles.get()))
+            {
+                upDocument->addStyle(rPair.first, rPair.second);
+            }
+
+            upDocument->finish();
+            return std::move(upDocument);
+        }
+
+        void compileElement(CompiledDocument& rDocument, uint32_t index, tinyxml2::XMLElement const * xmlElement, std::string filepath)
+        {
+            // Values common to all elements. Style is only checked when building the element, since stylesheet belongs to layout
+            CompiledDocument::Node& rNode = rDocument.getBuildingNode(index);
+            rNode.id = rDocument.addString(parseStringAttribute("id", xmlElement));
+            rNode.style = rDocument.addString(parseStringAttribute("style", xmlElement));
+            rNode.relativeScale = parseRelativeScale(xmlElement);
+            rNode.border = parsePercentAttribute("border", xmlElement);
+            if (parseBoolAttribute("dimming", xmlElement))
+            {
+                rNode.flags |= CompiledDocument::FLAG_DIMMING;
+            }
+            if (parseBoolAttribute("adaptivescaling", xmlElement))
+            {
+                rNode.flags |= CompiledDocument::FLAG_ADAPTIVE_SCALING;
+            }
+
+            std::string value = std::string(xmlElement->Value());
+            if (value == "grid")
+            {
+                rNode.type = CompiledDocument::NodeType::GRID;
+                blockHelper(rDocument, index, xmlElement);
+                if (parseBoolAttribute("showbackground", xmlElement))
+                {
+                    rNode.flags |= CompiledDocument::FLAG_SHOW_BACKGROUND;
+                }
+                compileGrid(rDocument, index, xmlElement, filepath);
+            }
+            else if (value == "blank")
+            {
+                rNode.type = CompiledDocument::NodeType::BLANK;
+            }
+            else if (value == "block")
+            {
+                rNode.type = CompiledDocument::NodeType::BLOCK;
+                blockHelper(rDocument, index, xmlElement);
+            }
+            else if (value == "picture")
+            {
+                rNode.type = CompiledDocument::NodeType::PICTURE;
+                rNode.text = rDocument.addString(parseStringAttribute("src", xmlElement));
+
+                // Get alignment
+                std::string alignmentValue = parseStringAttribute("alignment", xmlElement);
+                ImageAlignment alignment = ImageAlignment::ORIGINAL;
+                if (alignmentValue == EMPTY_STRING_ATTRIBUTE || alignmentValue == "original")
+                {
+                    alignment = ImageAlignment::ORIGINAL;
+                }
+                else if (alignmentValue == "stretched")
+                {
+                    alignment = ImageAlignment::STRETCHED;
+                }
+                else if (alignmentValue == "zoomed")
+                {
+                    alignment = ImageAlignment::ZOOMED;
+                }
+                else
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "Unknown alignment used for picture: " + alignmentValue, filepath);
+                }
+                rNode.enums[0] = (uint8_t)alignment;
+            }
+            else if (value == "stack")
+            {
+                rNode.type = CompiledDocument::NodeType::STACK;
+                blockHelper(rDocument, index, xmlElement);
+                if (parseBoolAttribute("showbackground", xmlElement))
+                {
+                    rNode.flags |= CompiledDocument::FLAG_SHOW_BACKGROUND;
+                }
+
+                // Get mode of relative scaling
+                std::string relativeScalingValue = parseStringAttribute("relativescaling", xmlElement);
+                Stack::RelativeScaling relativeScaling = Stack::RelativeScaling::MAIN_AXIS;
+                if (relativeScalingValue == EMPTY_STRING_ATTRIBUTE || relativeScalingValue == "mainaxis")
+                {
+                    relativeScaling = Stack::RelativeScaling::MAIN_AXIS;
+                }
+                else if (relativeScalingValue == "bothaxes")
+                {
+                    relativeScaling = Stack::RelativeScaling::BOTH_AXES;
+                }
+                else
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "Unknown relative scaling used in stack: " + relativeScalingValue, filepath);
+                }
+                rNode.enums[0] = (uint8_t)relativeScaling;
+
+                // Get alignment
+                std::string alignmentValue = parseStringAttribute("alignment", xmlElement);
+                Stack::Alignment alignment = Stack::Alignment::FILL;
+                if (alignmentValue == EMPTY_STRING_ATTRIBUTE || alignmentValue == "fill")
+                {
+                    alignment = Stack::Alignment::FILL;
+                }
+                else if (alignmentValue == "center")
+                {
+                    alignment = Stack::Alignment::CENTER;
+                }
+                else if (alignmentValue == "head")
+                {
+                    alignment = Stack::Alignment::HEAD;
+                }
+                else if (alignmentValue == "tail")
+                {
+                    alignment = Stack::Alignment::TAIL;
+                }
+                else
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "Unknown alignment used in stack: " + alignmentValue, filepath);
+                }
+                rNode.enums[1] = (uint8_t)alignment;
+
+                // Get padding
+                float padding = parsePercentAttribute("padding", xmlElement);
+                if (padding < 0 || padding > 1)
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "Padding value of stack not in range of 0% to 100%", filepath);
+                }
+                rNode.values[0] = padding;
+
+                // Get separator
+                float separator = parsePercentAttribute("separator", xmlElement);
+                if (separator < 0 || separator > 1)
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "Separator value of stack not in range of 0% to 100%", filepath);
+                }
+                rNode.values[1] = separator;
+
+                // Count elements
+                uint32_t count = 0;
+                for (tinyxml2::XMLElement const * xmlChild = xmlElement->FirstChildElement(); xmlChild != NULL; xmlChild = xmlChild->NextSiblingElement())
+                {
+                    count++;
+                }
+
+                // Compile elements, node reference is not valid after adding nodes
+                uint32_t firstChild = rDocument.addNodes(count);
+                rDocument.getBuildingNode(index).firstChild = firstChild;
+                rDocument.getBuildingNode(index).childCount = count;
+                uint32_t i = firstChild;
+                for (tinyxml2::XMLElement const * xmlChild = xmlElement->FirstChildElement(); xmlChild != NULL; xmlChild = xmlChild->NextSiblingElement())
+                {
+                    compileElement(rDocument, i++, xmlChild, filepath);
+                }
+            }
+            else if (value == "textblock")
+            {
+                rNode.type = CompiledDocument::NodeType::TEXT_BLOCK;
+                blockHelper(rDocument, index, xmlElement);
+
+                // Get font size
+                FontSize fontSize = parseFontSize(xmlElement, filepath);
+                rNode.enums[0] = (uint8_t)fontSize;
+
+                // Get alignment
+                std::string alignmentValue = parseStringAttribute("alignment", xmlElement);
+                TextFlowAlignment alignment = TextFlowAlignment::LEFT;
+                if (alignmentValue == EMPTY_STRING_ATTRIBUTE || alignmentValue == "left")
+                {
+                    alignment = TextFlowAlignment::LEFT;
+                }
+                else if (alignmentValue == "right")
+                {
+                    alignment = TextFlowAlignment::RIGHT;
+                }
+                else if (alignmentValue == "center")
+                {
+                    alignment = TextFlowAlignment::CENTER;
+                }
+                else if (alignmentValue == "justify")
+                {
+                    alignment = TextFlowAlignment::JUSTIFY;
+                }
+                else
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "Unknown alignment used in text block: " + alignmentValue, filepath);
+                }
+                rNode.enums[1] = (uint8_t)alignment;
+
+                // Get vertical alignment
+                std::string verticalAlignmentValue = parseStringAttribute("verticalalignment", xmlElement);
+                TextFlowVerticalAlignment verticalAlignment = TextFlowVerticalAlignment::TOP;
+                if (verticalAlignmentValue == EMPTY_STRING_ATTRIBUTE || verticalAlignmentValue == "top")
+                {
+                    verticalAlignment = TextFlowVerticalAlignment::TOP;
+                }
+                else if (verticalAlignmentValue == "center")
+                {
+                    verticalAlignment = TextFlowVerticalAlignment::CENTER;
+                }
+                else if (verticalAlignmentValue == "bottom")
+                {
+                    verticalAlignment = TextFlowVerticalAlignment::BOTTOM;
+                }
+                else
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "Unknown vertical alignment used in text block: " + verticalAlignmentValue, filepath);
+                }
+                rNode.enums[2] = (uint8_t)verticalAlignment;
+
+                // Get text scale
+                rNode.values[0] = parsePercentAttribute("textscale", xmlElement, 1.0f);
+
+                // Get content, xml parser replaces new lines with visible "\n"
+                std::string contentValue = parseStringAttribute("content", xmlElement);
+                replaceString(contentValue, "\\n", "\n");
+                rNode.text = rDocument.addString(contentValue);
+
+                // Get key for localization
+                rNode.key = rDocument.addString(parseStringAttribute("key", xmlElement));
+            }
+            else if (value == "textedit")
+            {
+                rNode.type = CompiledDocument::NodeType::TEXT_EDIT;
+                blockHelper(rDocument, index, xmlElement);
+                rNode.enums[0] = (uint8_t)parseFontSize(xmlElement, filepath);
+                rNode.values[0] = parsePercentAttribute("textscale", xmlElement, 1.0f);
+
+                // Get content, xml parser replaces new lines with visible "\n"
+                std::string contentValue = parseStringAttribute("content", xmlElement);
+                replaceString(contentValue, "\\n", "\n");
+                rNode.text = rDocument.addString(contentValue);
+            }
+            else if (value == "circlebutton" || value == "boxbutton")
+            {
+                rNode.type = value == "circlebutton" ? CompiledDocument::NodeType::CIRCLE_BUTTON : CompiledDocument::NodeType::BOX_BUTTON;
+                rNode.text = rDocument.addString(parseStringAttribute("icon", xmlElement));
+                if (parseBoolAttribute("switch", xmlElement))
+                {
+                    rNode.flags |= CompiledDocument::FLAG_SWITCH;
+                }
+            }
+            else if (value == "sensor")
+            {
+                rNode.type = CompiledDocument::NodeType::SENSOR;
+                rNode.text = rDocument.addString(parseStringAttribute("icon", xmlElement));
+            }
+            else if (value == "dropbutton")
+            {
+                rNode.type = CompiledDocument::NodeType::DROP_BUTTON;
+                rNode.text = rDocument.addString(parseStringAttribute("icon", xmlElement));
+
+                // Get usage of available space
+                float space = parsePercentAttribute("space", xmlElement);
+                if (space < 0 || space > 1)
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "Usage of available space in DropButton not in range of 0% to 100%", filepath);
+                }
+                rNode.values[0] = space;
+
+                // Compile inner element
+                tinyxml2::XMLElement const * xmlInnerElement = xmlElement->FirstChildElement();
+                if (xmlInnerElement == NULL)
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "DropButton has no inner element", filepath);
+                }
+                else
+                {
+                    if (xmlInnerElement->NextSiblingElement() != NULL)
+                    {
+                        throwError(OperationNotifier::Operation::PARSING, "DropButton has more than one inner element", filepath);
+                    }
+                    uint32_t innerIndex = rDocument.addNodes(1);
+                    rDocument.getBuildingNode(index).firstChild = innerIndex;
+                    rDocument.getBuildingNode(index).childCount = 1;
+                    compileElement(rDocument, innerIndex, xmlInnerElement, filepath);
+                }
+            }
+            else if (value == "keyboard")
+            {
+                rNode.type = CompiledDocument::NodeType::KEYBOARD;
+            }
+            else
+            {
+                throwError(OperationNotifier::Operation::PARSING, "Unknown element found: " + value, filepath);
+                rNode.type = CompiledDocument::NodeType::BLANK;
+            }
+        }
+
+        void compileGrid(CompiledDocument& rDocument, uint32_t index, tinyxml2::XMLElement const * xmlGrid, std::string filepath)
+        {
+            // Get first row
+            tinyxml2::XMLElement const * xmlRow = xmlGrid->FirstChildElement();
+            if (!validateElement(xmlRow, "row"))
+            {
+                throwError(OperationNotifier::Operation::PARSING, "Row node expected but not found", filepath);
+            }
+
+            // Count of rows
+            uint32_t rows = 0;
+            for (tinyxml2::XMLElement const * xmlRowCounter = xmlRow; xmlRowCounter != NULL; xmlRowCounter = xmlRowCounter->NextSiblingElement())
+            {
+                rows++;
+            }
+
+            // Rows are children of grid
+            uint32_t firstRow = rDocument.addNodes(rows);
+            rDocument.getBuildingNode(index).firstChild = firstRow;
+            rDocument.getBuildingNode(index).childCount = rows;
+
+            // Go over rows
+            for (uint32_t i = 0; i < rows; i++)
+            {
+                if (!validateElement(xmlRow, "row"))
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "Row node expected but not found", filepath);
+                }
+
+                // Get first column
+                tinyxml2::XMLElement const * xmlColumn = xmlRow->FirstChildElement();
+                if (!validateElement(xmlColumn, "column"))
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "Column node expected but not found", filepath);
+                }
+
+                // Get column count
+                uint32_t columns = 0;
+                for (tinyxml2::XMLElement const * xmlColumnCounter = xmlColumn; xmlColumnCounter != NULL; xmlColumnCounter = xmlColumnCounter->NextSiblingElement())
+                {
+                    columns++;
+                }
+
+                // Columns are children of row
+                uint32_t firstColumn = rDocument.addNodes(columns);
+                CompiledDocument::Node& rRow = rDocument.getBuildingNode(firstRow + i);
+                rRow.type = CompiledDocument::NodeType::ROW;
+                rRow.values[0] = parsePercentAttribute("size", xmlRow);
+                rRow.firstChild = firstColumn;
+                rRow.childCount = columns;
+
+                // Go over columns
+                for (uint32_t j = 0; j < columns; j++)
+                {
+                    if (!validateElement(xmlColumn, "column"))
+                    {
+                        throwError(OperationNotifier::Operation::PARSING, "Column node expected but not found", filepath);
+                    }
+
+                    CompiledDocument::Node& rColumn = rDocument.getBuildingNode(firstColumn + j);
+                    rColumn.type = CompiledDocument::NodeType::COLUMN;
+                    rColumn.values[0] = parsePercentAttribute("size", xmlColumn);
+
+                    // Element in cell, empty cell is filled with blank later
+                    tinyxml2::XMLElement const * xmlElement = xmlColumn->FirstChildElement();
+                    if (xmlElement != NULL)
+                    {
+                        uint32_t elementIndex = rDocument.addNodes(1);
+                        rDocument.getBuildingNode(firstColumn + j).firstChild = elementIndex;
+                        rDocument.getBuildingNode(firstColumn + j).childCount = 1;
+                        compileElement(rDocument, elementIndex, xmlElement, filepath);
+                    }
+
+                    xmlColumn = xmlColumn->NextSiblingElement();
+                }
+
+                xmlRow = xmlRow->NextSiblingElement();
+            }
+        }
+
+        void blockHelper(CompiledDocument& rDocument, uint32_t index, tinyxml2::XMLElement const * xmlBlock)
+        {
+            std::string backgroundFilepath = parseStringAttribute("backgroundsrc", xmlBlock);
+
+            // Background image alignment
+            ImageAlignment backgroundAlignment = STANDARD_IMAGE_ALIGNMENT;
+            if (backgroundFilepath != EMPTY_STRING_ATTRIBUTE)
+            {
+                std::string backgroundAlignmentValue = parseStringAttribute("backgroundalignment", xmlBlock);
+                if (backgroundAlignmentValue == "original")
+                {
+                    backgroundAlignment = ImageAlignment::ORIGINAL;
+                }
+                else if (backgroundAlignmentValue == "stretched")
+                {
+                    backgroundAlignment = ImageAlignment::STRETCHED;
+                }
+                else if (backgroundAlignmentValue == "zoomed")
+                {
+                    backgroundAlignment = ImageAlignment::ZOOMED;
+                }
+            }
+
+            CompiledDocument::Node& rNode = rDocument.getBuildingNode(index);
+            if (parseBoolAttribute("consumeinput", xmlBlock))
+            {
+                rNode.flags |= CompiledDocument::FLAG_CONSUME_INPUT;
+            }
+            rNode.backgroundFilepath = rDocument.addString(backgroundFilepath);
+            rNode.backgroundAlignment = (uint8_t)backgroundAlignment;
+            rNode.innerBorder = parsePercentAttribute("innerborder", xmlBlock);
+        }
+
+        bool validateElement(tinyxml2::XMLElement const * xmlElement, const std::string& rExpectedValue)
+        {
+            if (xmlElement == NULL || std::string(xmlElement->Value()).compare(rExpectedValue) != 0)
+            {
+                return false;
+            }
+            return true;
+        }
+
+        float parseRelativeScale(tinyxml2::XMLElement const * xmlElement)
+        {
+            float value = parsePercentAttribute("relativescale", xmlElement);
+            if (value <= 0)
+            {
+                return 1;
+            }
+            else
+            {
+                return value;
+            }
+        }
+
+        FontSize parseFontSize(tinyxml2::XMLElement const * xmlElement, std::string filepath)
+        {
+            std::string fontSizeValue = parseStringAttribute("fontsize", xmlElement);
+            FontSize fontSize = FontSize::MEDIUM;
+            if (fontSizeValue == EMPTY_STRING_ATTRIBUTE || fontSizeValue == "medium")
+            {
+                fontSize = FontSize::MEDIUM;
+            }
+            else if (fontSizeValue == "tall")
+            {
+                fontSize = FontSize::TALL;
+            }
+            else if (fontSizeValue == "small")
+            {
+                fontSize = FontSize::SMALL;
+            }
+            else
+            {
+                throwError(OperationNotifier::Operation::PARSING, "Unknown font size used in " + std::string(xmlElement->Value()) + ": " + fontSizeValue, filepath);
+            }
+            return fontSize;
+        }
+
+        std::string parseStringAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, std::string fallback)
+        {
+            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
+            if (xmlAttribute != NULL)
+            {
+                return xmlAttribute->Value();
+            }
+            else
+            {
+                return fallback;
+            }
+        }
+
+        bool parseBoolAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, bool fallback)
+        {
+            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
+            if (xmlAttribute != NULL)
+            {
+                std::string value = xmlAttribute->Value();
+
+                // File format case is not relevant
+                std::transform(value.begin(), value.end(), value.begin(), ::tolower);
+
+                return value == "true";
+            }
+            else
+            {
+                return fallback;
+            }
+        }
+
+        int parseIntAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, int fallback)
+        {
+            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
+            if (xmlAttribute != NULL)
+            {
+                return xmlAttribute->IntValue();
+            }
+            else
+            {
+                return fallback;
+            }
+        }
+
+        float parsePercentAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, float fallback)
+        {
+            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
+            if (xmlAttribute != NULL)
+            {
+                std::string value = xmlAttribute->Value();
+                std::string delimiter = "%";
+                std::string token = value.substr(0, value.find(delimiter));
+                return (std::stof(token) / 100.0f);
+            }
+            else
+            {
+                return fallback;
+            }
+        }
+    }
+}
@@ -0,0 +1,62 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Compiles layouts, bricks and stylesheets into compiled documents. Loading
+// prefers a compiled file next to the source file, if it was compiled from
+// the same content. Otherwise the source is compiled and, when caching is
+// enabled, the result is saved next to it for later loads.
+
+#ifndef DOCUMENT_COMPILER_H_
+#define DOCUMENT_COMPILER_H_
+
+#include "CompiledDocument.h"
+#include "src/Defines.h"
+#include "externals/TinyXML2/tinyxml2.h"
+
+#include <memory>
+#include <string>
+
+namespace eyegui
+{
+    namespace document_compiler
+    {
+        // Load compiled document of file, returns NULL if neither source nor compiled file exists
+        std::unique_ptr<CompiledDocument> load(std::string filepath, CompiledDocument::Kind kind);
+
+        // Compile file and save result next to it, returns whether successful
+        bool compileFile(std::string filepath);
+
+        // Enable or disable saving of compiled files while loading
+        void setCaching(bool enabled);
+
+        // Compiling of content
+        std::unique_ptr<CompiledDocument> compileLayout(const std::string& rContent, std::string filepath);
+        std::unique_ptr<CompiledDocument> compileBrick(const std::string& rContent, std::string filepath);
+        std::unique_ptr<CompiledDocument> compileStylesheet(const std::string& rContent, std::string filepath);
+
+        // Compile element and its children into node with given index
+        void compileElement(CompiledDocument& rDocument, uint32_t index, tinyxml2::XMLElement const * xmlElement, std::string filepath);
+        void compileGrid(CompiledDocument& rDocument, uint32_t index, tinyxml2::XMLElement const * xmlGrid, std::string filepath);
+
+        // Helper
+        void blockHelper(CompiledDocument& rDocument, uint32_t index, tinyxml2::XMLElement const * xmlBlock);
+
+        // Checking
+        bool validateElement(tinyxml2::XMLElement const * xmlElement, const std::string& rExpectedValue);
+
+        // Other parsing
+        float parseRelativeScale(tinyxml2::XMLElement const * xmlElement);
+        FontSize parseFontSize(tinyxml2::XMLElement const * xmlElement, std::string filepath);
+
+        // Attribute parsing
+        std::string parseStringAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, std::string fallback = EMPTY_STRING_ATTRIBUTE);
+        bool parseBoolAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, bool fallback = EMPTY_BOOL_ATTRIBUTE);
+        int parseIntAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, int fallback = EMPTY_INT_ATTRIBUTE);
+        float parsePercentAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, float fallback = EMPTY_PERCENTAGE_ATTRIBUTE);
+    }
+}
+
+#endif // DOCUMENT_COMPILER_H_
@@ -10,19 +10,23 @@
 #include "Defines.h"
 #include "Layout.h"
 #include "src/Utilities/OperationNotifier.h"
+#include "src/Utilities/ElementArena.h"
 #include "externals/utfcpp/source/utf8.h"
 
 namespace eyegui
 {
     namespace element_parser
     {
-        std::unique_ptr<elementsAndIds> parse(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, tinyxml2::XMLElement const * xmlElement, Element* pParent, std::string filepath, std::map<std::string, std::string> idMapper)
+        std::unique_ptr<elementsAndIds> parse(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, Element* pParent, std::string filepath, std::map<std::string, std::string> idMapper)
         {
+            // Elements of layout or brick and their small objects are placed close to each other
+            ElementArena::Scope arenaScope;
+
             // Create map for ids
             std::unique_ptr<idMap> upIdMap = std::unique_ptr<idMap>(new std::map<std::string, Element*>);
 
             // Parse elements
-            std::unique_ptr<Element> upElement = std::move(parseElement(pLayout, pFrame, pAssetManager, pNotificationQueue, xmlElement, pParent, filepath, idMapper, *(upIdMap.get())));
+            std::unique_ptr<Element> upElement = std::move(parseElement(pLayout, pFrame, pAssetManager, pNotificationQueue, rDocument, pNode, pParent, filepath, idMapper, *(upIdMap.get())));
 
             // Create and fill pair
             std::unique_ptr<elementsAndIds> upPair = std::unique_ptr<elementsAndIds>(new elementsAndIds);
@@ -33,22 +37,22 @@ namespace eyegui
             return std::move(upPair);
         }
 
-        std::unique_ptr<Element> parseElement(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, tinyxml2::XMLElement const * xmlElement, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
+        std::unique_ptr<Element> parseElement(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
         {
-            // Name of style of element (if xmlElement == NULL, get style of parent if available)
-            std::string styleName = parseStyleName(xmlElement, pParent, pLayout->getNamesOfAvailableStyles(), filepath);
+            // Id of style of element (if pNode == NULL, get style of parent if available)
+            uint styleId = parseStyleId(rDocument, pNode, pParent, *(pLayout->getStyles()), filepath);
 
-            if (xmlElement == NULL)
+            if (pNode == NULL)
             {
                 // Fallback
-                return(std::move(parseBlank(pLayout, pFrame, pAssetManager, pNotificationQueue, EMPTY_STRING_ATTRIBUTE, styleName, 1, 0, false, false, NULL, pParent, filepath)));
+                return(std::move(parseBlank(pLayout, pFrame, pAssetManager, pNotificationQueue, EMPTY_STRING_ATTRIBUTE, styleId, 1, 0, false, false, rDocument, NULL, pParent, filepath)));
             }
 
             // Unique pointer to element
             std::unique_ptr<Element> upElement;
 
             // Id of element
-            std::string id = parseStringAttribute("id", xmlElement);
+            std::string id = rDocument.getString(pNode->id);
 
             // Try to map id using id mapper
             auto it = rIdMapper.find(id);
@@ -58,65 +62,58 @@ namespace eyegui
             }
 
             // Relative scale of element
-            float relativeScale = parseRelativeScale(xmlElement);
+            float relativeScale = pNode->relativeScale;
 
             // Border of element
-            float border = parsePercentAttribute("border", xmlElement);
+            float border = pNode->border;
 
             // Dimming
-            bool dimming = parseBoolAttribute("dimming", xmlElement);
+            bool dimming = (pNode->flags & CompiledDocument::FLAG_DIMMING) != 0;
 
             // Adaptive scaling
-            bool adaptiveScaling = parseBoolAttribute("adaptivescaling", xmlElement);
-
-            std::string value = std::string(xmlElement->Value());
-            if (value == "grid")
-            {
-                upElement = std::move(parseGrid(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimming, adaptiveScaling, xmlElement, pParent, filepath, rIdMapper, rIdMap));
-            }
-            else if (value == "blank")
-            {
-                upElement = std::move(parseBlank(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimming, adaptiveScaling, xmlElement, pParent, filepath));
-            }
-            else if (value == "block")
-            {
-                upElement = std::move(parseBlock(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimming, adaptiveScaling, xmlElement, pParent, filepath));
-            }
-            else if (value == "picture")
-            {
-                upElement = std::move(parsePicture(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimming, adaptiveScaling, xmlElement, pParent, filepath));
-            }
-            else if (value == "stack")
-            {
-                upElement = std::move(parseStack(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimming, adaptiveScaling, xmlElement, pParent, filepath, rIdMapper, rIdMap));
-            }
-            else if (value == "textblock")
-            {
-                upElement = std::move(parseTextBlock(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimming, adaptiveScaling, xmlElement, pParent, filepath));
-            }
-            else if (value == "circlebutton")
-            {
-                upElement = std::move(parseCircleButton(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimming, adaptiveScaling, xmlElement, pParent, filepath));
-            }
-            else if (value == "boxbutton")
-            {
-                upElement = std::move(parseBoxButton(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimming, adaptiveScaling, xmlElement, pParent, filepath));
-            }
-            else if (value == "sensor")
-            {
-                upElement = std::move(parseSensor(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimming, adaptiveScaling, xmlElement, pParent, filepath));
-            }
-            else if (value == "dropbutton")
-            {
-                upElement = std::move(parseDropButton(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimming, adaptiveScaling, xmlElement, pParent, filepath, rIdMapper, rIdMap));
-            }
-            else if (value == "keyboard")
-            {
-                upElement = std::move(parseKeyboard(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleName, relativeScale, border, dimming, adaptiveScaling, xmlElement, pParent, filepath));
-            }
-            else
-            {
-                throwError(OperationNotifier::Operation::PARSING, "Unknown element found: " + std::string(xmlElement->Value()), filepath);
+            bool adaptiveScaling = (pNode->flags & CompiledDocument::FLAG_ADAPTIVE_SCALING) != 0;
+
+            switch (pNode->type)
+            {
+            case CompiledDocument::NodeType::GRID:
+                upElement = std::move(parseGrid(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleId, relativeScale, border, dimming, adaptiveScaling, rDocument, pNode, pParent, filepath, rIdMapper, rIdMap));
+                break;
+            case CompiledDocument::NodeType::BLANK:
+                upElement = std::move(parseBlank(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleId, relativeScale, border, dimming, adaptiveScaling, rDocument, pNode, pParent, filepath));
+                break;
+            case CompiledDocument::NodeType::BLOCK:
+                upElement = std::move(parseBlock(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleId, relativeScale, border, dimming, adaptiveScaling, rDocument, pNode, pParent, filepath));
+                break;
+            case CompiledDocument::NodeType::PICTURE:
+                upElement = std::move(parsePicture(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleId, relativeScale, border, dimming, adaptiveScaling, rDocument, pNode, pParent, filepath));
+                break;
+            case CompiledDocument::NodeType::STACK:
+                upElement = std::move(parseStack(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleId, relativeScale, border, dimming, adaptiveScaling, rDocument, pNode, pParent, filepath, rIdMapper, rIdMap));
+                break;
+            case CompiledDocument::NodeType::TEXT_BLOCK:
+                upElement = std::move(parseTextBlock(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleId, relativeScale, border, dimming, adaptiveScaling, rDocument, pNode, pParent, filepath));
+                break;
+            case CompiledDocument::NodeType::CIRCLE_BUTTON:
+                upElement = std::move(parseCircleButton(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleId, relativeScale, border, dimming, adaptiveScaling, rDocument, pNode, pParent, filepath));
+                break;
+            case CompiledDocument::NodeType::BOX_BUTTON:
+                upElement = std::move(parseBoxButton(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleId, relativeScale, border, dimming, adaptiveScaling, rDocument, pNode, pParent, filepath));
+                break;
+            case CompiledDocument::NodeType::SENSOR:
+                upElement = std::move(parseSensor(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleId, relativeScale, border, dimming, adaptiveScaling, rDocument, pNode, pParent, filepath));
+                break;
+            case CompiledDocument::NodeType::DROP_BUTTON:
+                upElement = std::move(parseDropButton(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleId, relativeScale, border, dimming, adaptiveScaling, rDocument, pNode, pParent, filepath, rIdMapper, rIdMap));
+                break;
+            case CompiledDocument::NodeType::KEYBOARD:
+                upElement = std::move(parseKeyboard(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleId, relativeScale, border, dimming, adaptiveScaling, rDocument, pNode, pParent, filepath));
+                break;
+            case CompiledDocument::NodeType::TEXT_EDIT:
+                upElement = std::move(parseTextEdit(pLayout, pFrame, pAssetManager, pNotificationQueue, id, styleId, relativeScale, border, dimming, adaptiveScaling, rDocument, pNode, pParent, filepath));
+                break;
+            default:
+                throwError(OperationNotifier::Operation::PARSING, "Unexpected node found in compiled document", filepath);
+                break;
             }
 
             // Return element, but save id before
@@ -131,41 +128,26 @@ namespace eyegui
             }
         }
 
-        std::unique_ptr<Grid> parseGrid(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlGrid, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
+        std::unique_ptr<Grid> parseGrid(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, uint styleId, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
         {
-            // Fetch values for block from xml
+            // Fetch values for block from node
             bool consumeInput;
             std::string backgroundFilepath;
             ImageAlignment backgroundAlignment;
             float innerBorder;
-            blockHelper(xmlGrid, consumeInput, backgroundFilepath, backgroundAlignment, innerBorder);
+            blockHelper(rDocument, pNode, consumeInput, backgroundFilepath, backgroundAlignment, innerBorder);
 
             // Show background?
-            bool showBackground = parseBoolAttribute("showbackground", xmlGrid);
+            bool showBackground = (pNode->flags & CompiledDocument::FLAG_SHOW_BACKGROUND) != 0;
 
-            // Get first row
-            tinyxml2::XMLElement const * xmlRow = xmlGrid->FirstChildElement();
-            if (!validateElement(xmlRow, "row"))
-            {
-                throwError(OperationNotifier::Operation::PARSING, "Row node expected but not found", filepath);
-            }
-
-            // Count of rows
-            int rows = 0;
-            tinyxml2::XMLElement const * xmlRowCounter = xmlRow;
-
-            while (xmlRowCounter != NULL)
-            {
-                // Checking whether it is really a row element is done later
-                rows++;
-                xmlRowCounter = xmlRowCounter->NextSiblingElement();
-            }
+            // Rows are children of grid
+            int rows = (int)pNode->childCount;
 
             // Create grid
             std::unique_ptr<Grid> upGrid = std::unique_ptr<Grid>(
                 new Grid(
                     id,
-                    styleName,
+                    styleId,
                     pParent,
                     pLayout,
                     pFrame,
@@ -185,73 +167,26 @@ namespace eyegui
             // Go over rows
             for (int i = 0; i < rows; i++)
             {
-                // Get first column
-                tinyxml2::XMLElement const * xmlColumn = xmlRow->FirstChildElement();
-                if (!validateElement(xmlColumn, "column"))
-                {
-                    throwError(OperationNotifier::Operation::PARSING, "Column node expected but not found", filepath);
-                }
-
-                // Get column count
-                int columns = 0;
-                tinyxml2::XMLElement const * xmlColumnCounter = xmlColumn;
-
-                while (xmlColumnCounter != NULL)
-                {
-                    // Checking whether it is really a column element is done later
-                    columns++;
-                    xmlColumnCounter = xmlColumnCounter->NextSiblingElement();
-                }
+                // Columns are children of row
+                CompiledDocument::Node const * pRow = rDocument.getNode(pNode->firstChild + i);
+                int columns = (int)pRow->childCount;
 
                 // Tell grid about column count
                 upGrid->prepareColumns(i, columns);
 
                 // Set height of row
-                upGrid->setRelativeHeightOfRow(i, parsePercentAttribute("size", xmlRow));
+                upGrid->setRelativeHeightOfRow(i, pRow->values[0]);
 
                 // Go over columns
                 for (int j = 0; j < columns; j++)
                 {
                     // Set width of column
-                    upGrid->setRelativeWidthOfCell(i, j, parsePercentAttribute("size", xmlColumn));
+                    CompiledDocument::Node const * pColumn = rDocument.getNode(pRow->firstChild + j);
+                    upGrid->setRelativeWidthOfCell(i, j, pColumn->values[0]);
 
                     // Determine element in cell
-                    tinyxml2::XMLElement const * xmlElement = xmlColumn->FirstChildElement();
-                    upGrid->attachElement(i, j, std::move(parseElement(pLayout, pFrame, pAssetManager, pNotificationQueue, xmlElement, upGrid.get(), filepath, rIdMapper, rIdMap)));
-
-                    // Get column sibling if necessary
-                    xmlColumn = xmlColumn->NextSiblingElement();
-                    if (j < columns - 1)
-                    {
-                        if (!validateElement(xmlColumn, "column"))
-                        {
-                            throwError(OperationNotifier::Operation::PARSING, "Column node expected but not found", filepath);
-                        }
-                    }
-                    else
-                    {
-                        if (xmlColumn != NULL)
-                        {
-                            throwError(OperationNotifier::Operation::PARSING, "Too many column nodes found", filepath);
-                        }
-                    }
-                }
-
-                // Get row sibling if necessary
-                xmlRow = xmlRow->NextSiblingElement();
-                if (i < rows - 1)
-                {
-                    if (!validateElement(xmlRow, "row"))
-                    {
-                        throwError(OperationNotifier::Operation::PARSING, "Row node expected but not found", filepath);
-                    }
-                }
-                else
-                {
-                    if (xmlRow != NULL)
-                    {
-                        throwError(OperationNotifier::Operation::PARSING, "Too many row nodes found", filepath);
-                    }
+                    CompiledDocument::Node const * pElement = pColumn->childCount > 0 ? rDocument.getNode(pColumn->firstChild) : NULL;
+                    upGrid->attachElement(i, j, std::move(parseElement(pLayout, pFrame, pAssetManager, pNotificationQueue, rDocument, pElement, upGrid.get(), filepath, rIdMapper, rIdMap)));
                 }
             }
 
@@ -265,28 +200,28 @@ namespace eyegui
             return std::move(upGrid);
         }
 
-        std::unique_ptr<Blank> parseBlank(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlBlank, Element* pParent, std::string filepath)
+        std::unique_ptr<Blank> parseBlank(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, uint styleId, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, Element* pParent, std::string filepath)
         {
             // Create and return blank
-            std::unique_ptr<Blank> upBlank = std::unique_ptr<Blank>(new Blank(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling));
+            std::unique_ptr<Blank> upBlank = std::unique_ptr<Blank>(new Blank(id, styleId, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling));
             return (std::move(upBlank));
         }
 
-        std::unique_ptr<Block> parseBlock(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlBlock, Element* pParent, std::string filepath)
+        std::unique_ptr<Block> parseBlock(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, uint styleId, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, Element* pParent, std::string filepath)
         {
-            // Fetch values for block from xml
+            // Fetch values for block from node
             bool consumeInput;
             std::string backgroundFilepath;
             ImageAlignment backgroundAlignment;
             float innerBorder;
-            blockHelper(xmlBlock, consumeInput, backgroundFilepath, backgroundAlignment, innerBorder);
+            blockHelper(rDocument, pNode, consumeInput, backgroundFilepath, backgroundAlignment, innerBorder);
 
             // Create block and return
             std::unique_ptr<Block> upBlock =
                 std::unique_ptr<Block>(
                     new Block(
                         id,
-                        styleName,
+                        styleId,
                         pParent,
                         pLayout,
                         pFrame,
@@ -302,107 +237,44 @@ namespace eyegui
             return (std::move(upBlock));
         }
 
-        std::unique_ptr<Picture> parsePicture(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlPicture, Element* pParent, std::string filepath)
+        std::unique_ptr<Picture> parsePicture(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, uint styleId, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, Element* pParent, std::string filepath)
         {
             // Get full path to image file
-            std::string imageFilepath = parseStringAttribute("src", xmlPicture);
+            std::string imageFilepath = rDocument.getString(pNode->text);
 
             // Get alignment
-            std::string alignmentValue = parseStringAttribute("alignment", xmlPicture);
-            ImageAlignment alignment;
-            if (alignmentValue == EMPTY_STRING_ATTRIBUTE || alignmentValue == "original")
-            {
-                alignment = ImageAlignment::ORIGINAL;
-            }
-            else if (alignmentValue == "stretched")
-            {
-                alignment = ImageAlignment::STRETCHED;
-            }
-            else if (alignmentValue == "zoomed")
-            {
-                alignment = ImageAlignment::ZOOMED;
-            }
-            else
-            {
-                throwError(OperationNotifier::Operation::PARSING, "Unknown alignment used for picture: " + alignmentValue, filepath);
-            }
+            ImageAlignment alignment = (ImageAlignment)pNode->enums[0];
 
             // Create and return
-            std::unique_ptr<Picture> upPicture = std::unique_ptr<Picture>(new Picture(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling, imageFilepath, alignment));
+            std::unique_ptr<Picture> upPicture = std::unique_ptr<Picture>(new Picture(id, styleId, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling, imageFilepath, alignment));
             return (std::move(upPicture));
         }
 
-        std::unique_ptr<Stack> parseStack(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlStack, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
+        std::unique_ptr<Stack> parseStack(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, uint styleId, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
         {
-            // Fetch values for block from xml
+            // Fetch values for block from node
             bool consumeInput;
             std::string backgroundFilepath;
             ImageAlignment backgroundAlignment;
             float innerBorder;
-            blockHelper(xmlStack, consumeInput, backgroundFilepath, backgroundAlignment, innerBorder);
+            blockHelper(rDocument, pNode, consumeInput, backgroundFilepath, backgroundAlignment, innerBorder);
 
             // Show background?
-            bool showBackground = parseBoolAttribute("showbackground", xmlStack);
-
-            // Get mode of relative scaling
-            std::string relativeScalingValue = parseStringAttribute("relativescaling", xmlStack);
-            Stack::RelativeScaling relativeScaling;
-            if (relativeScalingValue == EMPTY_STRING_ATTRIBUTE || relativeScalingValue == "mainaxis")
-            {
-                relativeScaling = Stack::RelativeScaling::MAIN_AXIS;
-            }
-            else if (relativeScalingValue == "bothaxes")
-            {
-                relativeScaling = Stack::RelativeScaling::BOTH_AXES;
-            }
-            else
-            {
-                throwError(OperationNotifier::Operation::PARSING, "Unknown relative scaling used in stack: " + relativeScalingValue, filepath);
-            }
-
-            // Get alignment
-            std::string alignmentValue = parseStringAttribute("alignment", xmlStack);
-            Stack::Alignment alignment;
-            if (alignmentValue == EMPTY_STRING_ATTRIBUTE || alignmentValue == "fill")
-            {
-                alignment = Stack::Alignment::FILL;
-            }
-            else if (alignmentValue == "center")
-            {
-                alignment = Stack::Alignment::CENTER;
-            }
-            else if (alignmentValue == "head")
-            {
-                alignment = Stack::Alignment::HEAD;
-            }
-            else if (alignmentValue == "tail")
-            {
-                alignment = Stack::Alignment::TAIL;
-            }
-            else
-            {
-                throwError(OperationNotifier::Operation::PARSING, "Unknown alignment used in stack: " + alignmentValue, filepath);
-            }
+            bool showBackground = (pNode->flags & CompiledDocument::FLAG_SHOW_BACKGROUND) != 0;
 
-            // Get padding
-            float padding = parsePercentAttribute("padding", xmlStack);
-            if (padding < 0 || padding > 1)
-            {
-                throwError(OperationNotifier::Operation::PARSING, "Padding value of stack not in range of 0% to 100%", filepath);
-            }
+            // Get mode of relative scaling and alignment
+            Stack::RelativeScaling relativeScaling = (Stack::RelativeScaling)pNode->enums[0];
+            Stack::Alignment alignment = (Stack::Alignment)pNode->enums[1];
 
-            // Get separator
-            float separator = parsePercentAttribute("separator", xmlStack);
-            if (separator < 0 || separator > 1)
-            {
-                throwError(OperationNotifier::Operation::PARSING, "Separator value of stack not in range of 0% to 100%", filepath);
-            }
+            // Get padding and separator
+            float padding = pNode->values[0];
+            float separator = pNode->values[1];
 
             // Create stack
             std::unique_ptr<Stack> upStack = std::unique_ptr<Stack>(
                 new Stack(
                     id,
-                    styleName,
+                    styleId,
                     pParent,
                     pLayout,
                     pFrame,
@@ -423,115 +295,47 @@ namespace eyegui
                     separator));
 
             // Insert elements
-            tinyxml2::XMLElement const * xmlElement = xmlStack->FirstChildElement();
-            while (xmlElement != NULL)
+            for (uint32_t i = 0; i < pNode->childCount; i++)
             {
                 // Fetch element
-                upStack->attachElement(std::move(parseElement(pLayout, pFrame, pAssetManager, pNotificationQueue, xmlElement, upStack.get(), filepath, rIdMapper, rIdMap)));
-
-                // Try to get next sibling element
-                xmlElement = xmlElement->NextSiblingElement();
+                upStack->attachElement(std::move(parseElement(pLayout, pFrame, pAssetManager, pNotificationQueue, rDocument, rDocument.getNode(pNode->firstChild + i), upStack.get(), filepath, rIdMapper, rIdMap)));
             }
 
             // Return stack
             return (std::move(upStack));
         }
 
-        std::unique_ptr<TextBlock> parseTextBlock(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlTextBlock, Element* pParent, std::string filepath)
+        std::unique_ptr<TextBlock> parseTextBlock(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, uint styleId, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, Element* pParent, std::string filepath)
         {
-            // Fetch values for block from xml
+            // Fetch values for block from node
             bool consumeInput;
             std::string backgroundFilepath;
             ImageAlignment backgroundAlignment;
             float innerBorder;
-            blockHelper(xmlTextBlock, consumeInput, backgroundFilepath, backgroundAlignment, innerBorder);
-
-            // Get font size
-            std::string fontSizeValue = parseStringAttribute("fontsize", xmlTextBlock);
-            FontSize fontSize;
-            if (fontSizeValue == EMPTY_STRING_ATTRIBUTE || fontSizeValue == "medium")
-            {
-                fontSize = FontSize::MEDIUM;
-            }
-            else if (fontSizeValue == "tall")
-            {
-                fontSize = FontSize::TALL;
-            }
-            else if (fontSizeValue == "small")
-            {
-                fontSize = FontSize::SMALL;
-            }
-            else
-            {
-                throwError(OperationNotifier::Operation::PARSING, "Unknown font size used in text block: " + fontSizeValue, filepath);
-            }
-
-            // Get alignment
-            std::string alignmentValue = parseStringAttribute("alignment", xmlTextBlock);
-            TextFlowAlignment alignment;
-            if (alignmentValue == EMPTY_STRING_ATTRIBUTE || alignmentValue == "left")
-            {
-                alignment = TextFlowAlignment::LEFT;
-            }
-            else if (alignmentValue == "right")
-            {
-                alignment = TextFlowAlignment::RIGHT;
-            }
-            else if (alignmentValue == "center")
-            {
-                alignment = TextFlowAlignment::CENTER;
-            }
-            else if (alignmentValue == "justify")
-            {
-                alignment = TextFlowAlignment::JUSTIFY;
-            }
-            else
-            {
-                throwError(OperationNotifier::Operation::PARSING, "Unknown alignment used in text block: " + alignmentValue, filepath);
-            }
+            blockHelper(rDocument, pNode, consumeInput, backgroundFilepath, backgroundAlignment, innerBorder);
 
-            // Get vertical alignment
-            std::string verticalAlignmentValue = parseStringAttribute("verticalalignment", xmlTextBlock);
-            TextFlowVerticalAlignment verticalAlignment;
-            if (verticalAlignmentValue == EMPTY_STRING_ATTRIBUTE || verticalAlignmentValue == "top")
-            {
-                verticalAlignment = TextFlowVerticalAlignment::TOP;
-            }
-            else if (verticalAlignmentValue == "center")
-            {
-                verticalAlignment = TextFlowVerticalAlignment::CENTER;
-            }
-            else if (verticalAlignmentValue == "bottom")
-            {
-                verticalAlignment = TextFlowVerticalAlignment::BOTTOM;
-            }
-            else
-            {
-                throwError(OperationNotifier::Operation::PARSING, "Unknown vertical alignment used in text block: " + verticalAlignmentValue, filepath);
-            }
+            // Get font size and alignments
+            FontSize fontSize = (FontSize)pNode->enums[0];
+            TextFlowAlignment alignment = (TextFlowAlignment)pNode->enums[1];
+            TextFlowVerticalAlignment verticalAlignment = (TextFlowVerticalAlignment)pNode->enums[2];
 
             // Get text scale
-            float textScale = parsePercentAttribute("textscale", xmlTextBlock, 1.0f);
+            float textScale = pNode->values[0];
 
-            // Get content
-            std::string contentValue = parseStringAttribute("content", xmlTextBlock);
-
-            // Xml parser replaces new lines with visible "\n"
-            replaceString(contentValue, "\\n", "\n");
-
-            // Convert to utf-16 string
+            // Get content and convert to utf-16 string
+            std::string contentValue = rDocument.getString(pNode->text);
             std::u16string content;
             utf8::utf8to16(contentValue.begin(), contentValue.end(), back_inserter(content));
 
             // Get key for localization
-            std::string key = parseStringAttribute("key", xmlTextBlock);
+            std::string key = rDocument.getString(pNode->key);
 
             // Create text block
             std::unique_ptr<TextBlock> upTextBlock =
                 std::unique_ptr<TextBlock>(
                     new TextBlock(
                         id,
-                        styleName,
+                        styleId,
                         pParent,
                         pLayout,
                         pFrame,
@@ -556,253 +360,158 @@ namespace eyegui
             return std::move(upTextBlock);
         }
 
-        std::unique_ptr<CircleButton> parseCircleButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlCircleButton, Element* pParent, std::string filepath)
+        std::unique_ptr<CircleButton> parseCircleButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, uint styleId, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, Element* pParent, std::string filepath)
         {
             // Extract filepath
-            std::string iconFilepath = parseStringAttribute("icon", xmlCircleButton);
+            std::string iconFilepath = rDocument.getString(pNode->text);
 
             // Is button a switch?
-            bool isSwitch = parseBoolAttribute("switch", xmlCircleButton);
+            bool isSwitch = (pNode->flags & CompiledDocument::FLAG_SWITCH) != 0;
 
             // Create circle button
-            std::unique_ptr<CircleButton> upCircleButton = std::unique_ptr<CircleButton>(new CircleButton(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling, iconFilepath, isSwitch));
+            std::unique_ptr<CircleButton> upCircleButton = std::unique_ptr<CircleButton>(new CircleButton(id, styleId, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling, iconFilepath, isSwitch));
 
             // Return circle button
             return (std::move(upCircleButton));
         }
 
-        std::unique_ptr<BoxButton> parseBoxButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlBoxButton, Element* pParent, std::string filepath)
+        std::unique_ptr<BoxButton> parseBoxButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, uint styleId, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, Element* pParent, std::string filepath)
         {
             // Extract filepath
-            std::string iconFilepath = parseStringAttribute("icon", xmlBoxButton);
+            std::string iconFilepath = rDocument.getString(pNode->text);
 
             // Is button a switch?
-            bool isSwitch = parseBoolAttribute("switch", xmlBoxButton);
+            bool isSwitch = (pNode->flags & CompiledDocument::FLAG_SWITCH) != 0;
 
             // Create box button
-            std::unique_ptr<BoxButton> upBoxButton = std::unique_ptr<BoxButton>(new BoxButton(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling, iconFilepath, isSwitch));
+            std::unique_ptr<BoxButton> upBoxButton = std::unique_ptr<BoxButton>(new BoxButton(id, styleId, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling, iconFilepath, isSwitch));
 
             // Return box button
             return (std::move(upBoxButton));
         }
 
-        std::unique_ptr<Sensor> parseSensor(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlSensor, Element* pParent, std::string filepath)
+        std::unique_ptr<Sensor> parseSensor(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, uint styleId, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, Element* pParent, std::string filepath)
         {
             // Extract filepath
-            std::string iconFilepath = parseStringAttribute("icon", xmlSensor);
+            std::string iconFilepath = rDocument.getString(pNode->text);
 
             // Create sensor
-            std::unique_ptr<Sensor> upSensor = std::unique_ptr<Sensor>(new Sensor(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling, iconFilepath));
+            std::unique_ptr<Sensor> upSensor = std::unique_ptr<Sensor>(new Sensor(id, styleId, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling, iconFilepath));
 
             // Return sensor
             return (std::move(upSensor));
         }
 
-        std::unique_ptr<DropButton> parseDropButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlDropButton, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
+        std::unique_ptr<DropButton> parseDropButton(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, uint styleId, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, Element* pParent, std::string filepath, std::map<std::string, std::string>& rIdMapper, idMap& rIdMap)
         {
             // Extract filepath
-            std::string iconFilepath = parseStringAttribute("icon", xmlDropButton);
+            std::string iconFilepath = rDocument.getString(pNode->text);
 
             // Get usage of available space
-            float space = parsePercentAttribute("space", xmlDropButton);
-            if (space < 0 || space > 1)
-            {
-                throwError(OperationNotifier::Operation::PARSING, "Usage of available space in DropButton not in range of 0% to 100%", filepath);
-            }
+            float space = pNode->values[0];
 
             // Create drop button
-            std::unique_ptr<DropButton> upDropButton = std::unique_ptr<DropButton>(new DropButton(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling, iconFilepath, space));
-
-            // Attach inner element
-            tinyxml2::XMLElement const * xmlElement = xmlDropButton->FirstChildElement();
-
-            if (xmlElement == NULL)
-            {
-                throwError(OperationNotifier::Operation::PARSING, "DropButton has no inner element", filepath);
-            }
-            else if (xmlElement->NextSiblingElement() != NULL)
-            {
-                throwError(OperationNotifier::Operation::PARSING, "DropButton has more than one inner element", filepath);
-            }
+            std::unique_ptr<DropButton> upDropButton = std::unique_ptr<DropButton>(new DropButton(id, styleId, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling, iconFilepath, space));
 
-            upDropButton->attachInnerElement(std::move(parseElement(pLayout, pFrame, pAssetManager, pNotificationQueue, xmlElement, upDropButton.get(), filepath, rIdMapper, rIdMap)));
+            // Attach inner element, fallback is used if there is none
+            CompiledDocument::Node const * pInnerNode = pNode->childCount > 0 ? rDocument.getNode(pNode->firstChild) : NULL;
+            upDropButton->attachInnerElement(std::move(parseElement(pLayout, pFrame, pAssetManager, pNotificationQueue, rDocument, pInnerNode, upDropButton.get(), filepath, rIdMapper, rIdMap)));
 
             // Return drop button
             return (std::move(upDropButton));
         }
 
-        std::unique_ptr<Keyboard> parseKeyboard(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, std::string styleName, float relativeScale, float border, bool dimming, bool adaptiveScaling, tinyxml2::XMLElement const * xmlKeyboard, Element* pParent, std::string filepath)
+        std::unique_ptr<Keyboard> parseKeyboard(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, uint styleId, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, Element* pParent, std::string filepath)
         {
             // Create and return keyboard
-            std::unique_ptr<Keyboard> upKeyboard = std::unique_ptr<Keyboard>(new Keyboard(id, styleName, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling));
+            std::unique_ptr<Keyboard> upKeyboard = std::unique_ptr<Keyboard>(new Keyboard(id, styleId, pParent, pLayout, pFrame, pAssetManager, pNotificationQueue, relativeScale, border, dimming, adaptiveScaling));
             return (std::move(upKeyboard));
         }
 
-        void blockHelper(tinyxml2::XMLElement const * xmlBlock, bool& rConsumeInput, std::string& rBackgroundFilepath, ImageAlignment& rBackgroundAlignment, float& rInnerBorder)
+        std::unique_ptr<TextEdit> parseTextEdit(Layout const * pLayout, Frame* pFrame, AssetManager* pAssetManager, NotificationQueue* pNotificationQueue, std::string id, uint styleId, float relativeScale, float border, bool dimming, bool adaptiveScaling, CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, Element* pParent, std::string filepath)
         {
-            rConsumeInput = parseBoolAttribute("consumeinput", xmlBlock);
-            rBackgroundFilepath = parseStringAttribute("backgroundsrc", xmlBlock);
+            // Fetch values for block from node
+            bool consumeInput;
+            std::string backgroundFilepath;
+            ImageAlignment backgroundAlignment;
+            float innerBorder;
+            blockHelper(rDocument, pNode, consumeInput, backgroundFilepath, backgroundAlignment, innerBorder);
 
-            // Background image alignment
-            if(rBackgroundFilepath == EMPTY_STRING_ATTRIBUTE)
-            {
-                // Not necessary, so just use something
-                rBackgroundAlignment = STANDARD_IMAGE_ALIGNMENT;
-            }
-            else
-            {
-                std::string backgroundAlignmentValue = parseStringAttribute("backgroundalignment", xmlBlock);
-                if(backgroundAlignmentValue == "original")
-                {
-                    rBackgroundAlignment = ImageAlignment::ORIGINAL;
-                }
-                else if(backgroundAlignmentValue == "stretched")
-                {
-                    rBackgroundAlignment = ImageAlignment::STRETCHED;
-                }
-                else if(backgroundAlignmentValue == "zoomed")
-                {
-                    rBackgroundAlignment = ImageAlignment::ZOOMED;
-                }
-                else
-                {
-                    // Just use the standard
-                    rBackgroundAlignment = STANDARD_IMAGE_ALIGNMENT;
-                }
-            }
+            // Get font size and text scale
+            FontSize fontSize = (FontSize)pNode->enums[0];
+            float textScale = pNode->values[0];
 
-            rInnerBorder = parsePercentAttribute("innerborder", xmlBlock);
-        }
+            // Get content and convert to utf-16 string
+            std::string contentValue = rDocument.getString(pNode->text);
+            std::u16string content;
+            utf8::utf8to16(contentValue.begin(), contentValue.end(), back_inserter(content));
 
-        bool validateElement(tinyxml2::XMLElement const * xmlElement, const std::string& rExpectedValue)
-        {
-            if (xmlElement == NULL || std::string(xmlElement->Value()).compare(rExpectedValue) != 0)
-            {
-                return false;
-            }
-            return true;
+            // Create and return text edit
+            std::unique_ptr<TextEdit> upTextEdit =
+                std::unique_ptr<TextEdit>(
+                    new TextEdit(
+                        id,
+                        styleId,
+                        pParent,
+                        pLayout,
+                        pFrame,
+                        pAssetManager,
+                        pNotificationQueue,
+                        relativeScale,
+                        border,
+                        dimming,
+                        adaptiveScaling,
+                        consumeInput,
+                        backgroundFilepath,
+                        backgroundAlignment,
+                        innerBorder,
+                        fontSize,
+                        textScale,
+                        content));
+            return (std::move(upTextEdit));
         }
 
-        float parseRelativeScale(tinyxml2::XMLElement const * xmlElement)
+        void blockHelper(CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, bool& rConsumeInput, std::string& rBackgroundFilepath, ImageAlignment& rBackgroundAlignment, float& rInnerBorder)
         {
-            if (xmlElement == NULL)
-            {
-                return 1;
-            }
-            else
-            {
-                float value = parsePercentAttribute("relativescale", xmlElement);
-                if (value <= 0)
-                {
-                    return 1;
-                }
-                else
-                {
-                    return value;
-                }
-            }
+            rConsumeInput = (pNode->flags & CompiledDocument::FLAG_CONSUME_INPUT) != 0;
+            rBackgroundFilepath = rDocument.getString(pNode->backgroundFilepath);
+            rBackgroundAlignment = (ImageAlignment)pNode->backgroundAlignment;
+            rInnerBorder = pNode->innerBorder;
         }
 
-        std::string parseStyleName(tinyxml2::XMLElement const * xmlElement, Element const * pParent, const std::set<std::string>& rNamesOfAvailableStyles, std::string filepath)
+        uint parseStyleId(CompiledDocument const & rDocument, CompiledDocument::Node const * pNode, Element const * pParent, StyleTable const & rStyles, std::string filepath)
         {
-            if (xmlElement == NULL)
+            if (pNode == NULL)
             {
-                return DEFAULT_STYLE_NAME;
+                return rStyles.getDefaultId();
             }
             else
             {
-                std::string styleName = parseStringAttribute("style", xmlElement);
-                if (styleName == EMPTY_STRING_ATTRIBUTE)
+                char const * pStyleName = rDocument.getString(pNode->style);
+                if (pStyleName[0] == '\0')
                 {
                     // No style found, try to get one from parent
                     if (pParent != NULL)
                     {
-                        styleName = pParent->getStyleName();
+                        return pParent->getStyleId();
                     }
                     else
                     {
                         // Otherwise, set default as style
-                        styleName = DEFAULT_STYLE_NAME;
+                        return rStyles.getDefaultId();
                     }
                 }
 
                 // Check, whether found name is ok
-                bool check = false;
-                for (const std::string& rName : rNamesOfAvailableStyles)
-                {
-                    if (rName == styleName)
-                    {
-                        check = true;
-                    }
-                }
-
-                if (!check)
+                uint styleId = 0;
+                if (!rStyles.findId(pStyleName, styleId))
                 {
                     // Trying to use style, which is not defined
-                    throwError(OperationNotifier::Operation::PARSING, "Following style is tried to be used but not defined in stylesheet: " + styleName, filepath);
+                    throwError(OperationNotifier::Operation::PARSING, "Following style is tried to be used but not defined in stylesheet: " + std::string(pStyleName), filepath);
+                    styleId = rStyles.getDefaultId();
                 }
 
-                return styleName;
-            }
-        }
-
-        std::string parseStringAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, std::string fallback)
-        {
-            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
-            if (xmlAttribute != NULL)
-            {
-                return xmlAttribute->Value();
-            }
-            else
-            {
-                return fallback;
-            }
-        }
-
-        bool parseBoolAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, bool fallback)
-        {
-            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
-            if (xmlAttribute != NULL)
-            {
-                std::string value = xmlAttribute->Value();
-
-                // File format case is not relevant
-                std::transform(value.begin(), value.end(), value.begin(), ::tolower);
-
-                return value == "true";
-            }
-            else
-            {
-                return fallback;
-            }
-        }
-
-        int parseIntAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, int fallback)
-        {
-            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
-            if (xmlAttribute != NULL)
-            {
-                return xmlAttribute->IntValue();
-            }
-            else
-            {
-                return fallback;
-            }
-        }
-
-        float parsePercentAttribute(std::string attributeName, tinyxml2::XMLElement const * xmlElement, float fallback)
-        {
-            tinyxml2::XMLAttribute const * xmlAttribute = xmlElement->FindAttribute(attributeName.c_str());
-            if (xmlAttribute != NULL)
-            {
-                std::string value = xmlAttribute->Value();
-                std::string delimiter = "%";
-                std::string token = value.substr(0, value.find(delimiter));
-                return (std::stof(token) / 100.0f);
-            }
-            else
-            {
-                return fallback;
+                return styleId;
             }
         }
 
@@ -8,6 +8,7 @@
 #include "LayoutParser.h"
 
 #include "StylesheetParser.h"
+#include "DocumentCompiler.h"
 #include "Layout.h"
 #include "src/Utilities/OperationNotifier.h"
 #include "src/Utilities/Helper.h"
@@ -17,7 +18,7 @@ namespace eyegui
 {
     namespace layout_parser
     {
-        std::unique_ptr<Layout> parse(GUI* pGUI, AssetManager* pAssetManager, std::string filepath)
+        std::unique_ptr<Layout> parse(GUI* pGUI, AssetManager* pAssetManager, std::string filepath, CompiledDocument const * pDocument, CompiledDocument const * pStylesheet)
         {
             // Check file name
             if (!checkFileNameExtension(filepath, LAYOUT_EXTENSION))
@@ -25,39 +26,37 @@ namespace eyegui
                 throwError(OperationNotifier::Operation::PARSING, "Extension of file not as expected", filepath);
             }
 
-            // Read file
-            tinyxml2::XMLDocument doc;
-            doc.LoadFile(buildPath(filepath).c_str());
-            if (doc.Error())
+            // Load compiled layout if not given
+            std::unique_ptr<CompiledDocument> upDocument;
+            if (pDocument == NULL)
             {
-                throwError(OperationNotifier::Operation::PARSING, std::string("XML could not be parsed: ") + doc.ErrorName(), filepath);
+                upDocument = std::move(document_compiler::load(filepath, CompiledDocument::Kind::LAYOUT));
+                if (upDocument == NULL)
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "Layout file not found", filepath);
+                    upDocument = std::unique_ptr<CompiledDocument>(new CompiledDocument(CompiledDocument::Kind::LAYOUT));
+                    upDocument->finish();
+                }
+                pDocument = upDocument.get();
             }
 
-            // First xml element should be a layout
-            tinyxml2::XMLElement* xmlLayout = doc.FirstChildElement();
-            if (!element_parser::validateElement(xmlLayout, "layout"))
-            {
-                throwError(OperationNotifier::Operation::PARSING, "No layout node as root in XML found", filepath);
-            }
-
-            // Get path to stylesheet
-            std::string stylesheetFilepath = element_parser::parseStringAttribute("stylesheet", xmlLayout);
+            // First node is layout, which has path to stylesheet
+            CompiledDocument::Node const * pLayoutNode = pDocument->getNode(0);
+            std::string stylesheetFilepath = pLayoutNode != NULL ? pDocument->getString(pLayoutNode->text) : EMPTY_STRING_ATTRIBUTE;
 
             // Create layout
-            std::unique_ptr<Layout> upLayout = std::unique_ptr<Layout>(new Layout(pGUI, pAssetManager, stylesheetFilepath));
-
-            // Then there should be an element
-            tinyxml2::XMLElement* xmlRoot = xmlLayout->FirstChildElement();
+            std::unique_ptr<Layout> upLayout = std::unique_ptr<Layout>(new Layout(pGUI, pAssetManager, filepath, stylesheetFilepath, pStylesheet));
 
-            // Check for existence
-            if (xmlRoot == NULL)
+            // Then there should be an element, otherwise fallback is used
+            CompiledDocument::Node const * pRoot = NULL;
+            if (pLayoutNode != NULL && pLayoutNode->childCount > 0)
             {
-                throwError(OperationNotifier::Operation::PARSING, "Layout has no element", filepath);
+                pRoot = pDocument->getNode(pLayoutNode->firstChild);
             }
 
             // Create, parse further internal an attach
             std::unique_ptr<elementsAndIds> upPair;
-            upPair = std::move(element_parser::parse(upLayout.get(), upLayout->getMainFrame(), pAssetManager, upLayout->getNotificationQueue(), xmlRoot, NULL, filepath));
+            upPair = std::move(element_parser::parse(upLayout.get(), upLayout->getMainFrame(), pAssetManager, upLayout->getNotificationQueue(), *pDocument, pRoot, NULL, filepath));
             upLayout->attachElementToMainFrameAsRoot(std::move(upPair->first), std::move(upPair->second));
 
             // Return ready to use layout
@@ -19,8 +19,8 @@ namespace eyegui
 
 	namespace layout_parser
 	{
-		// Parsing
-		std::unique_ptr<Layout> parse(GUI* pGUI, AssetManager* pAssetManager, std::string filepath);
+		// Parsing, uses given compiled layout and stylesheet instead of loading them if available
+		std::unique_ptr<Layout> parse(GUI* pGUI, AssetManager* pAssetManager, std::string filepath, CompiledDocument const * pDocument = NULL, CompiledDocument const * pStylesheet = NULL);
 	}
 }
 
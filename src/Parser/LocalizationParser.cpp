@@ -16,12 +16,13 @@
 #include <string>
 #include <fstream>
 #include <algorithm>
+#include <iterator>
 
 namespace eyegui
 {
     namespace localization_parser
     {
-        std::unique_ptr<LocalizationMap> parse(std::string filepath)
+        std::unique_ptr<LocalizationStore> parse(std::string filepath)
         {
             // Check file name
             if (!checkFileNameExtension(filepath, LOCALIZATION_EXTENSION))
@@ -29,75 +30,78 @@ namespace eyegui
                 throwError(OperationNotifier::Operation::PARSING, "Extension of file not as expected", filepath);
             }
 
-            // Create map
-            std::unique_ptr<LocalizationMap> upMap = std::unique_ptr<LocalizationMap>(new LocalizationMap);
-
-            // Read file
-            std::ifstream in(buildPath(filepath));
+            // Read whole file, entries are kept in its content
+            std::string content;
+            std::ifstream in(buildPath(filepath).c_str());
 
             // Check whether file was found
             if (!in)
             {
                 throwError(OperationNotifier::Operation::PARSING, "Localization file not found", filepath);
             }
+            else
+            {
+                content.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+            }
 
             // Some values for iteration
             unsigned int line_count = 1;
-            std::string line;
+            std::vector<LocalizationStore::Entry> entries;
 
             // TODO: Does not work for CR, use same approach as for other file parsers ;)
             // Iterate through lines
-            while (getline(in, line))
+            size_t begin = 0;
+            while (begin < content.size())
             {
-                // Check for invalid utf-8
-                std::string::iterator end_pos = utf8::find_invalid(line.begin(), line.end());
-                if (end_pos != line.end()) {
-                    throwError(OperationNotifier::Operation::PARSING, "Invalid UTF-8 encoding detected at line " + line_count, filepath);
+                size_t end = content.find('\n', begin);
+                if (end == std::string::npos)
+                {
+                    end = content.size();
                 }
 
-                // Extract key and value from line
-                parseLine(*(upMap.get()), line, filepath);
+                // Check for invalid utf-8
+                if (utf8::find_invalid(content.begin() + begin, content.begin() + end) != content.begin() + end)
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "Invalid UTF-8 encoding detected at line " + std::to_string(line_count), filepath);
+                }
+                else
+                {
+                    // Extract key and value from line
+                    parseLine(content, (uint32_t)begin, (uint32_t)end, entries, filepath);
+                }
 
                 // Next line
+                begin = end + 1;
                 line_count++;
             }
 
-            // Return map for localization
-            return std::move(upMap);
+            // Return store for localization
+            return std::unique_ptr<LocalizationStore>(new LocalizationStore(std::move(content), entries));
         }
 
-        void parseLine(LocalizationMap& rLocalizationMap, std::string line, std::string filepath)
+        void parseLine(std::string& rContent, uint32_t begin, uint32_t end, std::vector<LocalizationStore::Entry>& rEntries, std::string filepath)
         {
             // Split left and right side
-            std::string delimiter = "=";
-            size_t pos = 0;
-
-            if ((pos = line.find(delimiter)) == std::string::npos)
+            size_t pos = rContent.find('=', begin);
+            if (pos == std::string::npos || pos >= end)
             {
-                throwError(OperationNotifier::Operation::PARSING, "Following line could not be parsed: " + line, filepath);
+                throwError(OperationNotifier::Operation::PARSING, "Following line could not be parsed: " + rContent.substr(begin, end - begin), filepath);
                 return;
             }
 
-            std::string left = line.substr(0, pos);
-
-            // Get rid of whitespaces on left side
-            std::string::iterator end_pos = std::remove(left.begin(), left.end(), ' ');
-            left.erase(end_pos, left.end());
-
-            // Get rid of tabs on left side
-            end_pos = std::remove(left.begin(), left.end(), '\t');
-            left.erase(end_pos, left.end());
-
-            // Extract right side
-            line.erase(0, pos + delimiter.length());
-            std::string right = line;
-
-            // Convert right side to utf-16
-            std::u16string utf16right;
-            utf8::utf8to16(right.begin(), right.end(), back_inserter(utf16right));
-
-            // Fill in map
-            rLocalizationMap[left] = utf16right;
+            // Get rid of whitespaces and tabs on left side
+            std::string::iterator end_pos = std::remove_if(
+                rContent.begin() + begin,
+                rContent.begin() + pos,
+                [](char c) { return c == ' ' || c == '\t'; });
+
+            // Right side is value
+            LocalizationStore::Entry entry;
+            entry.keyOffset = begin;
+            entry.keyLength = (uint32_t)(end_pos - (rContent.begin() + begin));
+            entry.valueOffset = (uint32_t)pos + 1;
+            entry.valueLength = end - entry.valueOffset;
+            rEntries.push_back(entry);
         }
     }
 }
@@ -10,22 +10,20 @@
 #define LOCALIZATION_PARSER_H_
 
 #include "include/eyeGUI.h"
+#include "src/LocalizationStore.h"
 
 #include <memory>
-#include <map>
+#include <vector>
 
 namespace eyegui
 {
-    // Typedefs
-    typedef std::map<std::string, std::u16string> LocalizationMap;
-
     namespace localization_parser
     {
         // Parsing
-        std::unique_ptr<LocalizationMap> parse(std::string filepath);
+        std::unique_ptr<LocalizationStore> parse(std::string filepath);
 
-        // Parse a line
-        void parseLine(LocalizationMap& rLocalizationMap, std::string line, std::string filepath);
+        // Parse line between offsets of content. Whitespace is removed from key in place
+        void parseLine(std::string& rContent, uint32_t begin, uint32_t end, std::vector<LocalizationStore::Entry>& rEntries, std::string filepath);
     }
 }
 
@@ -7,6 +7,7 @@
 
 #include "StylesheetParser.h"
 
+#include "DocumentCompiler.h"
 #include "Defines.h"
 #include "src/Utilities/OperationNotifier.h"
 #include "src/Utilities/Helper.h"
@@ -14,21 +15,17 @@
 #include "src/Utilities/PathBuilder.h"
 
 #include <algorithm>
-#include <fstream>
 #include <set>
 
 namespace eyegui
 {
     namespace stylesheet_parser
     {
-        std::unique_ptr<std::map<std::string, Style> > parse(std::string filepath)
+        std::unique_ptr<std::map<std::string, Style> > parse(std::string filepath, CompiledDocument const * pDocument)
         {
             // Create map which should be filled
             std::unique_ptr<std::map<std::string, Style> > styles = std::unique_ptr<std::map<std::string, Style> >(new std::map<std::string, Style>);
 
-            // Check, whether default style exists in stylesheet
-            bool defaultExists = false;
-
             // Parse only if there should be a file, otherwise just add the default style
             if (filepath != EMPTY_STRING_ATTRIBUTE)
             {
@@ -38,172 +35,168 @@ namespace eyegui
                     throwError(OperationNotifier::Operation::PARSING, "Extension of file not as expected", filepath);
                 }
 
-                if (filepath != EMPTY_STRING_ATTRIBUTE)
+                // Load compiled stylesheet if not given
+                std::unique_ptr<CompiledDocument> upDocument;
+                if (pDocument == NULL)
                 {
-                    // Read file
-                    std::ifstream in(buildPath(filepath).c_str(), std::ios::in);
+                    upDocument = std::move(document_compiler::load(filepath, CompiledDocument::Kind::STYLESHEET));
+                    pDocument = upDocument.get();
+                }
 
-                    // Check whether file was found
-                    if (!in)
+                // Check whether file was found
+                if (pDocument == NULL)
+                {
+                    throwError(OperationNotifier::Operation::PARSING, "Stylesheet file not found", filepath);
+                }
+                else
+                {
+                    // Copy styles out of records
+                    for (uint32_t i = 0; i < pDocument->getStyleCount(); i++)
                     {
-                        throwError(OperationNotifier::Operation::PARSING, "Stylesheet file not found", filepath);
+                        CompiledDocument::StyleRecord const * pRecord = pDocument->getStyle(i);
+                        Style& rStyle = (*(styles.get()))[pDocument->getString(pRecord->name)];
+                        pDocument->fillStyle(pRecord, rStyle);
+                        rStyle.filepath = filepath;
                     }
+                }
+            }
+
+            // Create default if non existing
+            if (styles->find(DEFAULT_STYLE_NAME) == styles->end())
+            {
+                (*(styles.get()))[DEFAULT_STYLE_NAME] = Style();
+            }
+
+            // Return unique pointer to map
+            return std::move(styles);
+        }
 
-                    // Convert input file to string
-                    std::stringstream strStream;
-                    strStream << in.rdbuf();
-                    std::string content = strStream.str();
+        std::unique_ptr<std::map<std::string, Style> > parseContent(std::string content, std::string filepath)
+        {
+            // Create map which should be filled
+            std::unique_ptr<std::map<std::string, Style> > styles = std::unique_ptr<std::map<std::string, Style> >(new std::map<std::string, Style>);
 
-                    // Close file
-                    in.close();
+            // Streamline line endings
+            streamlineLineEnding(content);
 
-                    // Streamline line endings
-                    streamlineLineEnding(content);
+            // Get rid of whitespaces
+            std::string::iterator end_pos = std::remove(content.begin(), content.end(), ' ');
+            content.erase(end_pos, content.end());
 
-                    // Get rid of whitespaces
-                    std::string::iterator end_pos = std::remove(content.begin(), content.end(), ' ');
-                    content.erase(end_pos, content.end());
+            // Get rid of tabs
+            end_pos = std::remove(content.begin(), content.end(), '\t');
+            content.erase(end_pos, content.end());
 
-                    // Get rid of tabs
-                    end_pos = std::remove(content.begin(), content.end(), '\t');
-                    content.erase(end_pos, content.end());
+            // Add some new line at the end of content because while loop does not read last line
+            content += "\n";
 
-                    // Add some new line at the end of content because while loop does not read last line
-                    content += "\n";
+            // Make some state variables for parsing
+            enum class ParseState { OUTER, NAME_READ, INNER };
+            ParseState state = ParseState::OUTER;
+            std::string name;
+            Style style;
+            std::set<std::string> names;
 
-                    // Make some state variables for parsing
-                    enum class ParseState { OUTER, NAME_READ, INNER };
-                    ParseState state = ParseState::OUTER;
-                    std::string name;
-                    Style style;
-                    std::set<std::string> names;
+            // Go through the lines, content is not changed so splitting stays linear
+            std::string delimiter = "\n";
+            size_t start = 0;
+            size_t pos = 0;
+            std::string line;
+            while ((pos = content.find(delimiter, start)) != std::string::npos)
+            {
+                line = content.substr(start, pos - start);
+                start = pos + delimiter.length();
 
-                    // Go through the lines
-                    std::string delimiter = "\n";
-                    size_t pos = 0;
-                    std::string line;
-                    while ((pos = content.find(delimiter)) != std::string::npos)
+                switch (state)
+                {
+                case ParseState::OUTER:
+                    if (line == "")
                     {
-                        line = content.substr(0, pos);
-                        content.erase(0, pos + delimiter.length());
+                        continue;
+                    }
+                    else
+                    {
+                        // First guess, whole line is name
+                        name = line;
 
-                        switch (state)
-                        {
-                        case ParseState::OUTER:
-                            if (line == "")
-                            {
-                                continue;
-                            }
-                            else
-                            {
-                                // First guess, whole line is name
-                                name = line;
+                        // Create new style with fallback values
+                        style = Style();
+                        style.filepath = filepath;
 
-                                // Create new style with fallback values
-                                style = Style();
-                                style.filepath = filepath;
+                        // Try to get left and right side
+                        std::string delimiter = ":";
+                        size_t pos = 0;
+                        std::string copyline = line;
 
-                                // Try to get left and right side
-                                std::string delimiter = ":";
-                                size_t pos = 0;
-                                std::string copyline = line;
+                        if ((pos = copyline.find(delimiter)) != std::string::npos)
+                        {
+                            name = copyline.substr(0, pos);
+                            copyline.erase(0, pos + delimiter.length());
+                            std::string superstyle = copyline;
 
-                                if ((pos = copyline.find(delimiter)) != std::string::npos)
+                            // Only do something, if superstyle has a name
+                            if (superstyle != "")
+                            {
+                                // If name of superstyle is known, copy values
+                                if (names.find(superstyle) != names.end())
                                 {
-                                    name = copyline.substr(0, pos);
-                                    copyline.erase(0, pos + delimiter.length());
-                                    std::string superstyle = copyline;
-
-                                    // Only do something, if superstyle has a name
-                                    if (superstyle != "")
-                                    {
-                                        // Name of superstyle is known?
-                                        bool check = false;
-                                        for (const std::string& rName : names)
-                                        {
-                                            if (rName == superstyle)
-                                            {
-                                                check = true;
-                                                break;
-                                            }
-                                        }
-
-                                        // If name of superstyle is ok, copy values
-                                        if (check)
-                                        {
-                                            style = (*(styles.get()))[superstyle];
-                                        }
-                                        else
-                                        {
-                                            throwError(OperationNotifier::Operation::PARSING, "Unkown style used as superstyle: " + superstyle, filepath);
-                                        }
-                                    }
+                                    style = (*(styles.get()))[superstyle];
                                 }
-
-                                // Allow name only if unique
-                                for (const std::string& rName : names)
+                                else
                                 {
-                                    if (rName == name)
-                                    {
-                                        throwError(OperationNotifier::Operation::PARSING, "Following name of style is not unique: " + name, filepath);
-                                    }
+                                    throwError(OperationNotifier::Operation::PARSING, "Unkown style used as superstyle: " + superstyle, filepath);
                                 }
-
-                                // Change state
-                                state = ParseState::NAME_READ;
-                            }
-                            break;
-                        case ParseState::NAME_READ:
-                            if (line == "{")
-                            {
-                                state = ParseState::INNER;
-                            }
-                            else
-                            {
-                                throwError(OperationNotifier::Operation::PARSING, "'{' expected but not there", filepath);
-                            }
-                            break;
-                        case ParseState::INNER:
-                            if (line == "")
-                            {
-                                continue;
                             }
-                            else if (line == "}")
-                            {
-                                // Copy new entry to map
-                                (*(styles.get()))[name] = style;
-
-                                // Add name to names
-                                names.insert(name);
-
-                                if (name == DEFAULT_STYLE_NAME)
-                                {
-                                    defaultExists = true;
-                                }
+                        }
 
-                                state = ParseState::OUTER;
-                            }
-                            else
-                            {
-                                // There seems to be some value, parse it!
-                                parseLine(line, style);
-                            }
-                            break;
+                        // Allow name only if unique
+                        if (names.find(name) != names.end())
+                        {
+                            throwError(OperationNotifier::Operation::PARSING, "Following name of style is not unique: " + name, filepath);
                         }
+
+                        // Change state
+                        state = ParseState::NAME_READ;
+                    }
+                    break;
+                case ParseState::NAME_READ:
+                    if (line == "{")
+                    {
+                        state = ParseState::INNER;
+                    }
+                    else
+                    {
+                        throwError(OperationNotifier::Operation::PARSING, "'{' expected but not there", filepath);
                     }
+                    break;
+                case ParseState::INNER:
+                    if (line == "")
+                    {
+                        continue;
+                    }
+                    else if (line == "}")
+                    {
+                        // Copy new entry to map
+                        (*(styles.get()))[name] = style;
+
+                        // Add name to names
+                        names.insert(name);
 
-                    // State should be OUTER after parsing
-                    if (state != ParseState::OUTER)
+                        state = ParseState::OUTER;
+                    }
+                    else
                     {
-                        throwError(OperationNotifier::Operation::PARSING, "'}' seems to be missing", filepath);
+                        // There seems to be some value, parse it!
+                        parseLine(line, style);
                     }
+                    break;
                 }
             }
 
-            // Create default if non existing
-            if (!defaultExists)
+            // State should be OUTER after parsing
+            if (state != ParseState::OUTER)
             {
-                (*(styles.get()))[DEFAULT_STYLE_NAME] = Style();
+                throwError(OperationNotifier::Operation::PARSING, "'}' seems to be missing", filepath);
             }
 
             // Return unique pointer to map
@@ -11,6 +11,7 @@
 
 #include "include/eyeGUI.h"
 #include "Style.h"
+#include "CompiledDocument.h"
 
 #include <memory>
 #include <map>
@@ -19,8 +20,11 @@ namespace eyegui
 {
     namespace stylesheet_parser
     {
-        // Parsing
-        std::unique_ptr<std::map<std::string, Style> > parse(std::string filepath);
+        // Parsing, uses given compiled stylesheet instead of loading it if available
+        std::unique_ptr<std::map<std::string, Style> > parse(std::string filepath, CompiledDocument const * pDocument = NULL);
+
+        // Parsing of content, used by document compiler
+        std::unique_ptr<std::map<std::string, Style> > parseContent(std::string content, std::string filepath);
 
         // Parses whole line and fills value in style struct
         void parseLine(std::string line, Style& rStyle);
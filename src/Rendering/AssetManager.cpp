@@ -19,6 +19,9 @@
 #include "Font/AtlasFont.h"
 #include "Font/EmptyFont.h"
 #include "src/Utilities/PathBuilder.h"
+#include "src/Parser/DocumentCompiler.h"
+#include "src/Parser/StylesheetParser.h"
+#include "src/Parser/DictionaryParser.h"
 
 #include <algorithm>
 
@@ -40,6 +43,9 @@ namespace eyegui
 
     AssetManager::~AssetManager()
     {
+        // Stop guessing, pending guesses are dropped
+        mupGuessingThread.reset();
+
         // Get rid of fonts first because they have to delete FreeType faces
         mFonts.clear();
 
@@ -96,44 +102,34 @@ namespace eyegui
             // Check for empty string
             if (filepath == "")
             {
-                rupTexture = std::unique_ptr<Texture>(new VectorTexture(&graphics::notFoundGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mpGUI->getVectorGraphicsDPI()));
+                rupTexture = std::unique_ptr<Texture>(new VectorTexture(mpGUI->getRecording(), &graphics::notFoundGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mpGUI->getVectorGraphicsDPI()));
             }
             else
             {
                 // Determine image type
-                std::string delimiter = ".";
-                std::string input = filepath;
-                size_t pos = 0;
-                std::string token;
-                while ((pos = input.find(delimiter)) != std::string::npos)
-                {
-                    token = input.substr(0, pos);
-                    input.erase(0, pos + delimiter.length());
-                }
-
-                // File format case is not relevant
-                std::transform(input.begin(), input.end(), input.begin(), ::tolower);
-
-                // Check token
-                if (input.compare("svg") == 0)
+                int suspectedChannelCount = 0;
+                if (checkFileNameExtension(filepath, "svg"))
                 {
-                    rupTexture = std::unique_ptr<Texture>(new VectorTexture(filepath, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mpGUI->getVectorGraphicsDPI()));
+                    rupTexture = std::unique_ptr<Texture>(new VectorTexture(mpGUI->getRecording(), filepath, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mpGUI->getVectorGraphicsDPI()));
                 }
-                else if (input.compare("png") == 0 || input.compare("jpg") == 0 || input.compare("jpeg") == 0 || input.compare("tga") == 0 || input.compare("bmp") == 0)
+                else if (isPixelImage(filepath, suspectedChannelCount))
                 {
-                    // For PNG, suspect 4 channels (0 should do it for all cases, but stb_image always tells me about 3 channels and then moving to GPU fails)
-                    int suspectedChannelCount = 3;
-                    if(input.compare("png") == 0)
+                    // Use image decoded by asynchronous loading if available
+                    auto it = mDecodedImages.find(filepath);
+                    if (it != mDecodedImages.end())
                     {
-                        suspectedChannelCount = 4;
+                        rupTexture = std::unique_ptr<Texture>(new PixelTexture(mpGUI->getRecording(), filepath, *(it->second.get()), Texture::Filtering::LINEAR, Texture::Wrap::CLAMP));
+                        mDecodedImages.erase(it);
+                    }
+                    else
+                    {
+                        rupTexture = std::unique_ptr<Texture>(new PixelTexture(mpGUI->getRecording(), filepath, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, suspectedChannelCount));
                     }
-
-                    rupTexture = std::unique_ptr<Texture>(new PixelTexture(filepath, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, suspectedChannelCount));
                 }
                 else
                 {
                     throwWarning(OperationNotifier::Operation::IMAGE_LOADING, "Image file not found or wrong format. Replaced with placeholder", filepath);
-                    rupTexture = std::unique_ptr<Texture>(new VectorTexture(&graphics::notFoundGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mpGUI->getVectorGraphicsDPI()));
+                    rupTexture = std::unique_ptr<Texture>(new VectorTexture(mpGUI->getRecording(), &graphics::notFoundGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mpGUI->getVectorGraphicsDPI()));
                 }
             }
             pTexture = rupTexture.get();
@@ -154,10 +150,10 @@ namespace eyegui
             switch (graphic)
             {
             case graphics::Type::CIRCLE:
-                rupTexture = std::unique_ptr<Texture>(new VectorTexture(&graphics::circleGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mpGUI->getVectorGraphicsDPI()));
+                rupTexture = std::unique_ptr<Texture>(new VectorTexture(mpGUI->getRecording(), &graphics::circleGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mpGUI->getVectorGraphicsDPI()));
                 break;
             case graphics::Type::NOT_FOUND:
-                rupTexture = std::unique_ptr<Texture>(new VectorTexture(&graphics::notFoundGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mpGUI->getVectorGraphicsDPI()));
+                rupTexture = std::unique_ptr<Texture>(new VectorTexture(mpGUI->getRecording(), &graphics::notFoundGraphics, Texture::Filtering::LINEAR, Texture::Wrap::CLAMP, mpGUI->getVectorGraphicsDPI()));
                 break;
             }
             pTexture = rupTexture.get();
@@ -178,37 +174,46 @@ namespace eyegui
             switch (shader)
             {
             case shaders::Type::COLOR:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pColorFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(mpGUI->getRecording(), shaders::pStaticVertexShader, shaders::pColorFragmentShader));
                 break;
             case shaders::Type::CIRCLE:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCircleFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(mpGUI->getRecording(), shaders::pStaticVertexShader, shaders::pCircleFragmentShader));
                 break;
             case shaders::Type::SEPARATOR:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pSeparatorFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(mpGUI->getRecording(), shaders::pStaticVertexShader, shaders::pSeparatorFragmentShader));
                 break;
             case shaders::Type::BLOCK:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pBlockFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(mpGUI->getRecording(), shaders::pStaticVertexShader, shaders::pBlockFragmentShader));
                 break;
             case shaders::Type::IMAGE:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pImageFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(mpGUI->getRecording(), shaders::pStaticVertexShader, shaders::pImageFragmentShader));
                 break;
             case shaders::Type::CIRCLE_BUTTON:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCircleButtonFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(mpGUI->getRecording(), shaders::pStaticVertexShader, shaders::pCircleButtonFragmentShader));
                 break;
             case shaders::Type::BOX_BUTTON:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pBoxButtonFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(mpGUI->getRecording(), shaders::pStaticVertexShader, shaders::pBoxButtonFragmentShader));
                 break;
             case shaders::Type::SENSOR:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pSensorFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(mpGUI->getRecording(), shaders::pStaticVertexShader, shaders::pSensorFragmentShader));
                 break;
             case shaders::Type::TEXT_FLOW:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pTextFlowFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(mpGUI->getRecording(), shaders::pStaticVertexShader, shaders::pTextFlowFragmentShader));
                 break;
             case shaders::Type::KEY:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pKeyFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(mpGUI->getRecording(), shaders::pKeyVertexShader, shaders::pKeyFragmentShader));
                 break;
             case shaders::Type::CHARACTER_KEY:
-                rupShader = std::unique_ptr<Shader>(new Shader(shaders::pStaticVertexShader, shaders::pCharacterKeyFragmentShader));
+                rupShader = std::unique_ptr<Shader>(new Shader(mpGUI->getRecording(), shaders::pCharacterKeyVertexShader, shaders::pCharacterKeyFragmentShader));
+                break;
+            case shaders::Type::LAYER:
+                rupShader = std::unique_ptr<Shader>(new Shader(mpGUI->getRecording(), shaders::pStaticVertexShader, shaders::pLayerFragmentShader));
+                break;
+            case shaders::Type::GAZE_LINE:
+                rupShader = std::unique_ptr<Shader>(new Shader(mpGUI->getRecording(), shaders::pGazeLineVertexShader, shaders::pGazeLineFragmentShader));
+                break;
+            case shaders::Type::GAZE_CIRCLE:
+                rupShader = std::unique_ptr<Shader>(new Shader(mpGUI->getRecording(), shaders::pGazeCircleVertexShader, shaders::pGazeCircleFragmentShader));
                 break;
             }
             pShader = rupShader.get();
@@ -311,6 +316,109 @@ namespace eyegui
         return pFont;
     }
 
+    bool AssetManager::isPixelImage(std::string filepath, int& rSuspectedChannelCount)
+    {
+        // For PNG, suspect 4 channels (0 should do it for all cases, but stb_image always tells me about 3 channels and then moving to GPU fails)
+        if (checkFileNameExtension(filepath, "png"))
+        {
+            rSuspectedChannelCount = 4;
+            return true;
+        }
+        else if (checkFileNameExtension(filepath, "jpg") || checkFileNameExtension(filepath, "jpeg") || checkFileNameExtension(filepath, "tga") || checkFileNameExtension(filepath, "bmp"))
+        {
+            rSuspectedChannelCount = 3;
+            return true;
+        }
+        return false;
+    }
+
+    void AssetManager::provideDecodedImage(std::string filepath, std::unique_ptr<DecodedImage> upImage)
+    {
+        // Only necessary if texture does not exist yet
+        auto it = mTextures.find(filepath);
+        if (it == mTextures.end() || it->second == NULL)
+        {
+            mDecodedImages[filepath] = std::move(upImage);
+        }
+    }
+
+    void AssetManager::discardDecodedImages()
+    {
+        mDecodedImages.clear();
+    }
+
+    std::shared_ptr<const StyleTable> AssetManager::fetchStyles(std::string filepath, CompiledDocument const * pStylesheet)
+    {
+        // Search for styles
+        auto it = mStyles.find(filepath);
+        if (it != mStyles.end())
+        {
+            return it->second;
+        }
+
+        // Parse stylesheet. Styles with errors are not remembered, so errors are reported to each layout
+        unsigned int errorCount = OperationNotifier::getErrorCount();
+        std::shared_ptr<const StyleTable> spStyles = std::make_shared<StyleTable>(*(stylesheet_parser::parse(filepath, pStylesheet).get()));
+        if (errorCount == OperationNotifier::getErrorCount())
+        {
+            mStyles[filepath] = spStyles;
+        }
+        return spStyles;
+    }
+
+    CompiledDocument const * AssetManager::fetchBrick(std::string filepath)
+    {
+        // Search for brick
+        std::unique_ptr<CompiledDocument>& rupBrick = mBricks[filepath];
+
+        // Load brick if not existing. Missing file is not remembered, it might be created later
+        if (rupBrick == NULL)
+        {
+            rupBrick = std::move(document_compiler::load(filepath, CompiledDocument::Kind::BRICK));
+            if (rupBrick == NULL)
+            {
+                mBricks.erase(filepath);
+                return NULL;
+            }
+        }
+
+        return rupBrick.get();
+    }
+
+    bool AssetManager::hasBrick(std::string filepath) const
+    {
+        return mBricks.find(filepath) != mBricks.end();
+    }
+
+    void AssetManager::provideBrick(std::string filepath, std::unique_ptr<CompiledDocument> upBrick)
+    {
+        // Keep brick which is already loaded
+        if (upBrick != NULL && !hasBrick(filepath))
+        {
+            mBricks[filepath] = std::move(upBrick);
+        }
+    }
+
+    void AssetManager::invalidateBrick(std::string filepath)
+    {
+        mBricks.erase(filepath);
+    }
+
+    void AssetManager::invalidateAllBricks()
+    {
+        mBricks.clear();
+    }
+
+    void AssetManager::invalidateStylesheet(std::string filepath)
+    {
+        mStyles.erase(filepath);
+    }
+
+    void AssetManager::invalidateAllStylesheets()
+    {
+        mStyles.clear();
+    }
+
     void AssetManager::resizeFontAtlases()
     {
         for (auto& rPair : mFonts)
@@ -339,6 +447,22 @@ namespace eyegui
                     content)));
     }
 
+    std::unique_ptr<EditableTextFlow> AssetManager::createEditableTextFlow(
+        FontSize fontSize,
+        float scale,
+        std::u16string content)
+    {
+        return std::move(
+            std::unique_ptr<EditableTextFlow>(
+                new EditableTextFlow(
+                    mpGUI,
+                    this,
+                    mpGUI->getDefaultFont(),
+                    fontSize,
+                    scale,
+                    content)));
+    }
+
     std::unique_ptr<Key> AssetManager::createKey(Layout const * pLayout, char16_t character)
     {
         return std::move(
@@ -360,4 +484,96 @@ namespace eyegui
                     filepath,
                     alignment)));
     }
+
+    std::unique_ptr<DynamicMesh> AssetManager::createDynamicMesh(shaders::Type shader)
+    {
+        return std::move(
+            std::unique_ptr<DynamicMesh>(
+                new DynamicMesh(
+                    mpGUI->getRecording(),
+                    mpGUI->getDeletionQueue(),
+                    fetchShader(shader))));
+    }
+
+    std::unique_ptr<InstancedMesh> AssetManager::createInstancedMesh(shaders::Type shader, meshes::Type mesh, std::vector<InstanceAttribute> attributes)
+    {
+        return std::move(
+            std::unique_ptr<InstancedMesh>(
+                new InstancedMesh(
+                    mpGUI->getRecording(),
+                    mpGUI->getDeletionQueue(),
+                    fetchShader(shader),
+                    fetchMesh(mesh),
+                    attributes)));
+    }
+
+    std::unique_ptr<Guesser> AssetManager::createGuesser(std::string dictionaryFilepath)
+    {
+        if (mupGuessingThread == NULL)
+        {
+            mupGuessingThread = std::unique_ptr<LoadingThread>(new LoadingThread());
+        }
+
+        // Dictionary is shared by all guessers using same file
+        std::shared_ptr<SharedDictionary> spDictionary;
+        auto it = mDictionaries.find(dictionaryFilepath);
+        if (it != mDictionaries.end())
+        {
+            spDictionary = it->second;
+        }
+        else
+        {
+            spDictionary = std::make_shared<SharedDictionary>();
+            spDictionary->filepath = dictionaryFilepath;
+            spDictionary->loaded = false;
+            mDictionaries[dictionaryFilepath] = spDictionary;
+            mLoadingDictionaries.push_back(spDictionary);
+
+            // Guesses are enqueued after loading, so they find the dictionary
+            mupGuessingThread->enqueue([spDictionary]()
+            {
+                OperationNotifier::collectNotifications(&(spDictionary->notifications));
+                spDictionary->upDictionary = dictionary_parser::parse(spDictionary->filepath);
+                OperationNotifier::collectNotifications(NULL);
+                spDictionary->loaded = true;
+            });
+        }
+
+        return std::move(
+            std::unique_ptr<Guesser>(
+                new Guesser(
+                    mupGuessingThread.get(),
+                    spDictionary)));
+    }
+
+    void AssetManager::finishDictionaryLoading()
+    {
+        for (auto it = mLoadingDictionaries.begin(); it != mLoadingDictionaries.end();)
+        {
+            if ((*it)->loaded)
+            {
+                OperationNotifier::emitNotifications((*it)->notifications);
+                it = mLoadingDictionaries.erase(it);
+            }
+            else
+            {
+                it++;
+            }
+        }
+    }
+
+    Font const * AssetManager::getDefaultFont() const
+    {
+        return mpGUI->getDefaultFont();
+    }
+
+    RenderSnapshot* AssetManager::getRecording() const
+    {
+        return mpGUI->getRecording();
+    }
+
+    DeletionQueue* AssetManager::getDeletionQueue() const
+    {
+        return mpGUI->getDeletionQueue();
+    }
 }
@@ -14,12 +14,22 @@
 #include "Shader.h"
 #include "Mesh.h"
 #include "Textures/Texture.h"
+#include "Textures/PixelTexture.h"
 #include "RenderItem.h"
+#include "DynamicMesh.h"
+#include "InstancedMesh.h"
+#include "RenderSnapshot.h"
+#include "DeletionQueue.h"
 #include "Font/Font.h"
 #include "Assets/TextFlow.h"
+#include "Assets/EditableTextFlow.h"
 #include "Assets/Key.h"
 #include "Assets/CharacterKey.h"
 #include "Assets/Image.h"
+#include "src/Parser/CompiledDocument.h"
+#include "src/StyleTable.h"
+#include "src/Guesser.h"
+#include "src/Utilities/LoadingThread.h"
 
 #include "externals/FreeType2/include/ft2build.h"
 #include FT_FREETYPE_H
@@ -30,7 +40,7 @@
 namespace eyegui
 {
     // Available assets
-    namespace shaders { enum class Type { COLOR, CIRCLE, SEPARATOR, BLOCK, IMAGE, CIRCLE_BUTTON, BOX_BUTTON, SENSOR, TEXT_FLOW, KEY, CHARACTER_KEY}; }
+    namespace shaders { enum class Type { COLOR, CIRCLE, SEPARATOR, BLOCK, IMAGE, CIRCLE_BUTTON, BOX_BUTTON, SENSOR, TEXT_FLOW, KEY, CHARACTER_KEY, LAYER, GAZE_LINE, GAZE_CIRCLE}; }
     namespace meshes { enum class Type { QUAD, LINE }; }
     namespace graphics { enum class Type { CIRCLE, NOT_FOUND }; }
 
@@ -65,6 +75,39 @@ namespace eyegui
         // Fetch font
         Font const * fetchFont(std::string filepath);
 
+        // Whether file is image decoded by pixel texture, which tells count of channels to decode
+        static bool isPixelImage(std::string filepath, int& rSuspectedChannelCount);
+
+        // Provide image decoded on other thread, which is used when texture is fetched
+        void provideDecodedImage(std::string filepath, std::unique_ptr<DecodedImage> upImage);
+
+        // Discard provided images, which have not been fetched
+        void discardDecodedImages();
+
+        // Fetch styles of stylesheet, which are parsed only once and shared by layouts. Given compiled stylesheet is used if not parsed yet
+        std::shared_ptr<const StyleTable> fetchStyles(std::string filepath, CompiledDocument const * pStylesheet = NULL);
+
+        // Fetch brick as template from which elements are built, returns NULL if file not found
+        CompiledDocument const * fetchBrick(std::string filepath);
+
+        // Whether brick is already loaded
+        bool hasBrick(std::string filepath) const;
+
+        // Provide brick loaded on other thread
+        void provideBrick(std::string filepath, std::unique_ptr<CompiledDocument> upBrick);
+
+        // Forget brick so it is loaded again from file when fetched next time
+        void invalidateBrick(std::string filepath);
+
+        // Forget all bricks
+        void invalidateAllBricks();
+
+        // Forget styles of stylesheet so it is parsed again when fetched next time. Layouts keep their shared styles
+        void invalidateStylesheet(std::string filepath);
+
+        // Forget styles of all stylesheets
+        void invalidateAllStylesheets();
+
         // Resize font atlases (should be called by GUI only)
         void resizeFontAtlases();
 
@@ -76,12 +119,39 @@ namespace eyegui
             float scale,
             std::u16string content);
 
+        // Create text flow edited at cursor and return it as unique pointer
+        std::unique_ptr<EditableTextFlow> createEditableTextFlow(
+            FontSize fontSize,
+            float scale,
+            std::u16string content);
+
         // Create key for keyboard and return it as unique pointer
         std::unique_ptr<Key> createKey(Layout const * pLayout, char16_t character);
 
         // Create image and return it as unique pointer
         std::unique_ptr<Image> createImage(Layout const * pLayout, std::string filepath, ImageAlignment alignment);
 
+        // Create mesh changing over time and return it as unique pointer
+        std::unique_ptr<DynamicMesh> createDynamicMesh(shaders::Type shader);
+
+        // Create mesh drawn as instances with given attributes and return it as unique pointer
+        std::unique_ptr<InstancedMesh> createInstancedMesh(shaders::Type shader, meshes::Type mesh, std::vector<InstanceAttribute> attributes);
+
+        // Create guesser for keyboard and return it as unique pointer. Dictionary is loaded by guessing thread at first usage
+        std::unique_ptr<Guesser> createGuesser(std::string dictionaryFilepath);
+
+        // Report problems of dictionaries loaded by guessing thread
+        void finishDictionaryLoading();
+
+        // Get font used by default, for example by keys
+        Font const * getDefaultFont() const;
+
+        // Get snapshot into which drawing is recorded
+        RenderSnapshot* getRecording() const;
+
+        // Get queue of OpenGL objects to delete by drawing thread
+        DeletionQueue* getDeletionQueue() const;
+
     private:
 
         // Members
@@ -93,6 +163,12 @@ namespace eyegui
         std::map<std::string, std::unique_ptr<Texture> > mTextures;
         std::map<graphics::Type, std::unique_ptr<Texture> > mGraphics;
         std::map<std::string, std::unique_ptr<Font> > mFonts;
+        std::map<std::string, std::unique_ptr<CompiledDocument> > mBricks;
+        std::map<std::string, std::shared_ptr<const StyleTable> > mStyles;
+        std::map<std::string, std::unique_ptr<DecodedImage> > mDecodedImages;
+        std::map<std::string, std::shared_ptr<SharedDictionary> > mDictionaries;
+        std::vector<std::shared_ptr<SharedDictionary> > mLoadingDictionaries;
+        std::unique_ptr<LoadingThread> mupGuessingThread; // created by first guesser
     };
 }
 
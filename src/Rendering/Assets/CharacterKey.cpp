@@ -24,18 +24,12 @@ namespace eyegui
         mpFont = pFont;
         mCharacter = character;
 
-        // Fetch shader to render character
-        mpQuadShader = mpAssetManager->fetchShader(shaders::Type::CHARACTER_KEY);
-
         // Get glyph from font
         mpGlyph = mpFont->getGlyph(FontSize::KEYBOARD, mCharacter);
 
         // Calculate relative size of character
         float targetGlyphHeight = mpFont->getTargetGlyphHeight(FontSize::KEYBOARD);
         mCharacterSize = std::max(KEY_MIN_SCALE, mpGlyph->size.y / targetGlyphHeight);
-
-        // Prepare quad for displaying the character
-        prepareQuad();
     }
 
     CharacterKey::CharacterKey(const CharacterKey& rOtherKey) : Key(rOtherKey)
@@ -43,22 +37,26 @@ namespace eyegui
         // Copy members
         mpFont = rOtherKey.mpFont;
         mCharacter = rOtherKey.mCharacter;
-        mpQuadShader = rOtherKey.mpQuadShader;
         mpGlyph = rOtherKey.mpGlyph;
         mCharacterSize = rOtherKey.mCharacterSize;
+    }
+
+    CharacterKey& CharacterKey::operator=(const CharacterKey& rOtherKey)
+    {
+        // Super call
+        Key::operator=(rOtherKey);
 
-        // But create own quad!
-        prepareQuad();
+        // Copy members
+        mpFont = rOtherKey.mpFont;
+        mCharacter = rOtherKey.mCharacter;
+        mpGlyph = rOtherKey.mpGlyph;
+        mCharacterSize = rOtherKey.mCharacterSize;
+        return *this;
     }
 
     CharacterKey::~CharacterKey()
     {
-        // Delete vertex array object
-        glDeleteVertexArrays(1, &mQuadVertexArrayObject);
-
-        // Delete buffers
-        glDeleteBuffers(1, &mQuadVertexBuffer);
-        glDeleteBuffers(1, &mQuadTextureCoordinateBuffer);
+        // Nothing to do
     }
 
     void CharacterKey::transformAndSize()
@@ -91,143 +89,30 @@ namespace eyegui
             mY - (int)(quadSize.y / 2),
             (int)quadSize.x,
             (int)quadSize.y);
-
-        // Set texture coordinates of quad
-        GLint oldBuffer = -1;
-        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
-        glBindBuffer(GL_ARRAY_BUFFER, mQuadTextureCoordinateBuffer);
-        std::vector<glm::vec2> textureCoordinates;
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.x, mpGlyph->atlasPosition.y));
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.z, mpGlyph->atlasPosition.y));
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.z, mpGlyph->atlasPosition.w));
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.z, mpGlyph->atlasPosition.w));
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.x, mpGlyph->atlasPosition.w));
-        textureCoordinates.push_back(glm::vec2(mpGlyph->atlasPosition.x, mpGlyph->atlasPosition.y));
-        glBufferData(GL_ARRAY_BUFFER, textureCoordinates.size() * 2 * sizeof(float), textureCoordinates.data(), GL_DYNAMIC_DRAW);
-        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
     }
 
-    void CharacterKey::draw(
-            int stencilX,
-            int stencilY,
-            int stencilWidth,
-            int stencilHeight,
-            glm::vec4 color,
-            glm::vec4 pickColor,
-            glm::vec4 iconColor,
-            float activity,
-            glm::vec4 dimColor,
-            float dim,
-            glm::vec4 markColor,
-            float mark,
-            glm::vec4 highlightColor,
-            float highlight,
-            float alpha) const
+    void CharacterKey::addInstances(
+        std::vector<float>& rCircleInstances,
+        std::vector<float>& rCharacterInstances,
+        float alpha) const
     {
-        // Convert stencil values to OpenGL coordinate system
-        int oglStencilX = stencilX;
-        int oglStencilY = mpLayout->getLayoutHeight() - stencilY - stencilHeight;
-        int oglStencilWidth = stencilWidth;
-        int oglStencilHeight = stencilHeight;
-
-        // Draw circle of key
-        drawCircle(
-            oglStencilX,
-            oglStencilY,
-            oglStencilWidth,
-            oglStencilHeight,
-            color,
-            pickColor,
-            activity,
-            dimColor,
-            dim,
-            markColor,
-            mark,
-            highlightColor,
-            highlight,
-            alpha);
-
-        // Render character
-        mpQuadShader->bind();
-        glBindVertexArray(mQuadVertexArrayObject);
-
-        // Bind atlas texture
-        mpFont->bindAtlasTexture(FontSize::KEYBOARD, 0, true);
-
-        // Fill color
-        glm::vec4 characterColor = iconColor;
-        characterColor.a *= alpha;
-        mpQuadShader->fillValue("color", characterColor);
-
-        // Fill other uniforms
-        mpQuadShader->fillValue("time", mpLayout->getAccPeriodicTime());
-        mpQuadShader->fillValue("matrix", mQuadMatrix); // Matrix is updated in transform and size
-        mpQuadShader->fillValue("stencil", glm::vec4(oglStencilX, oglStencilY, oglStencilWidth, oglStencilHeight));
-        mpQuadShader->fillValue("activity", activity);
-        mpQuadShader->fillValue("dimColor", dimColor);
-        mpQuadShader->fillValue("dim", dim);
-        mpQuadShader->fillValue("markColor", markColor);
-        mpQuadShader->fillValue("mark", mark);
-        mpQuadShader->fillValue("highlightColor", highlightColor);
-        mpQuadShader->fillValue("highlight", highlight);
-
-        // Draw character quad (vertex count must be 6)
-        glDrawArrays(GL_TRIANGLES, 0, 6);
+        // Super call for circle of key
+        Key::addInstances(rCircleInstances, rCharacterInstances, alpha);
+
+        // Quad of character is shared by all keys and shrinked by border
+        addMatrix(rCharacterInstances, mQuadMatrix);
+        rCharacterInstances.push_back((1.0f - mCharacterSize) / 2.0f);
+
+        // Position of glyph in atlas
+        rCharacterInstances.push_back(mpGlyph->atlasPosition.x);
+        rCharacterInstances.push_back(mpGlyph->atlasPosition.y);
+        rCharacterInstances.push_back(mpGlyph->atlasPosition.z);
+        rCharacterInstances.push_back(mpGlyph->atlasPosition.w);
+        rCharacterInstances.push_back(alpha);
     }
 
     std::u16string CharacterKey::getValue() const
     {
         return std::u16string(&mCharacter, 1);
     }
-
-    void CharacterKey::prepareQuad()
-    {
-        // Save currently set buffer and vertex array object
-        GLint oldBuffer = -1;
-        GLint oldVAO = -1;
-        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
-        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVAO);
-
-        // Initialize mesh buffers and vertex array object
-        glGenBuffers(1, &mQuadVertexBuffer);
-        glGenBuffers(1, &mQuadTextureCoordinateBuffer);
-        glGenVertexArrays(1, &mQuadVertexArrayObject);
-
-        // Coordinates of quad
-        float border = (1.0f - mCharacterSize) / 2.0f;
-        float a = border;
-        float b = 1.0f - border;
-
-        // Fill vertex buffer (in OpenGL space)
-        glBindBuffer(GL_ARRAY_BUFFER, mQuadVertexBuffer);
-        std::vector<glm::vec3> vertices;
-        vertices.push_back(glm::vec3(a, a, 0));
-        vertices.push_back(glm::vec3(b, a, 0));
-        vertices.push_back(glm::vec3(b, b, 0));
-        vertices.push_back(glm::vec3(b, b, 0));
-        vertices.push_back(glm::vec3(a, b, 0));
-        vertices.push_back(glm::vec3(a, a, 0));
-        glBufferData(GL_ARRAY_BUFFER, vertices.size() * 3 * sizeof(float), vertices.data(), GL_STATIC_DRAW);
-
-        // Texture coordinates are dynamic and filled in transformAndSize method
-
-        // Bind stuff to vertex array object
-        glBindVertexArray(mQuadVertexArrayObject);
-
-        // Vertices
-        GLuint vertexAttrib = glGetAttribLocation(mpQuadShader->getShaderProgram(), "posAttribute");
-        glEnableVertexAttribArray(vertexAttrib);
-        glBindBuffer(GL_ARRAY_BUFFER, mQuadVertexBuffer);
-        glVertexAttribPointer(vertexAttrib, 3, GL_FLOAT, GL_FALSE, 0, NULL);
-
-        // Texture coordinates
-        GLuint uvAttrib = glGetAttribLocation(mpQuadShader->getShaderProgram(), "uvAttribute");
-        glEnableVertexAttribArray(uvAttrib);
-        glBindBuffer(GL_ARRAY_BUFFER, mQuadTextureCoordinateBuffer);
-        glVertexAttribPointer(uvAttrib, 2, GL_FLOAT, GL_FALSE, 0, NULL);
-
-        // Restore old settings
-        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
-        glBindVertexArray(oldVAO);
-    }
 }
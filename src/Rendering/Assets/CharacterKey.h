@@ -28,28 +28,19 @@ namespace eyegui
         // Copy constructor
         CharacterKey(const CharacterKey& rOtherKey);
 
+        // Assignment operator, copies same members like copy constructor
+        CharacterKey& operator=(const CharacterKey& rOtherKey);
+
         // Destructor
         virtual ~CharacterKey();
 
         // Simple transform and size to fit layout size
         virtual void transformAndSize();
 
-        // Draw (stencil values in eyeGUI coordinate system)
-        virtual void draw(
-            int stencilX,
-            int stencilY,
-            int stencilWidth,
-            int stencilHeight,
-            glm::vec4 color,
-            glm::vec4 pickColor,
-            glm::vec4 iconColor,
-            float activity,
-            glm::vec4 dimColor,
-            float dim,
-            glm::vec4 markColor,
-            float mark,
-            glm::vec4 highlightColor,
-            float highlight,
+        // Append values of instances drawn by keyboard, ordered like attributes of key shaders
+        virtual void addInstances(
+            std::vector<float>& rCircleInstances,
+            std::vector<float>& rCharacterInstances,
             float alpha) const;
 
         // Get value
@@ -57,18 +48,11 @@ namespace eyegui
 
     private:
 
-        // Prepare quad for displaying the character
-        void prepareQuad();
-
         // Members
         Font const * mpFont;
         char16_t mCharacter;
         Glyph const * mpGlyph;
         float mCharacterSize;
-        Shader const * mpQuadShader;
-        GLuint mQuadVertexBuffer;
-        GLuint mQuadTextureCoordinateBuffer;
-        GLuint mQuadVertexArrayObject;
         glm::mat4 mQuadMatrix;
     };
 
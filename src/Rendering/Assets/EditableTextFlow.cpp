@@ -0,0 +1,566 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "EditableTextFlow.h"
+
+#include "src/GUI.h"
+#include "src/Rendering/AssetManager.h"
+#include "src/Utilities/Helper.h"
+#include "externals/GLM/glm/gtc/matrix_transform.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace eyegui
+{
+    EditableTextFlow::EditableTextFlow(
+        GUI const * pGUI,
+        AssetManager* pAssetManager,
+        Font const * pFont,
+        FontSize fontSize,
+        float scale,
+        std::u16string content)
+    {
+        // Fill members
+        mpGUI = pGUI;
+        mpAssetManager = pAssetManager;
+        mpFont = pFont;
+        mFontSize = fontSize;
+        mScale = scale;
+        mText.setContent(content);
+        mCursor = mText.getLength();
+        mScrollLine = 0;
+
+        // Fetch shader and cursor
+        mpShader = mpAssetManager->fetchShader(shaders::Type::TEXT_FLOW);
+        mpCursor = mpAssetManager->fetchRenderItem(shaders::Type::COLOR, meshes::Type::QUAD);
+
+        // TransformAndSize has to be called before usage
+        mX = 0;
+        mY = 0;
+        mWidth = 0;
+        mHeight = 0;
+
+        // Mesh is filled by transformation
+        mupMesh = mpAssetManager->createDynamicMesh(shaders::Type::TEXT_FLOW);
+
+        // Paragraphs exist before first transformation, so editing is possible
+        layoutAll();
+    }
+
+    EditableTextFlow::~EditableTextFlow()
+    {
+        // Nothing to do
+    }
+
+    void EditableTextFlow::setContent(std::u16string content)
+    {
+        EYEGUI_PROFILE_SCOPE(mpGUI->getProfiler(), ProfilePhase::TEXT_MESHING);
+
+        mText.setContent(content);
+        mCursor = mText.getLength();
+        mScrollLine = 0;
+        layoutAll();
+        scrollToCursor();
+        fillMesh();
+    }
+
+    std::u16string EditableTextFlow::getContent() const
+    {
+        return mText.getContent();
+    }
+
+    void EditableTextFlow::insertAtCursor(const std::u16string& rText)
+    {
+        if (rText.empty())
+        {
+            return;
+        }
+
+        EYEGUI_PROFILE_SCOPE(mpGUI->getProfiler(), ProfilePhase::TEXT_MESHING);
+
+        // Paragraph of cursor is split by new lines of text
+        uint paragraph = mText.getLineOfPosition(mCursor);
+        uint letter = mCursor - mText.getLineStart(paragraph);
+        uint oldLength = getParagraphLength(paragraph);
+        uint newlines = (uint)std::count(rText.begin(), rText.end(), u'\n');
+        mText.insert(mCursor, rText);
+        mCursor += (uint)rText.size();
+
+        if (newlines == 0)
+        {
+            relayoutParagraph(paragraph, letter, 0, (uint)rText.size());
+        }
+        else
+        {
+            // Letters behind cursor move into new paragraphs, which are laid out completely
+            relayoutParagraph(paragraph, letter, oldLength - letter, (uint)rText.find(u'\n'));
+            mParagraphs.insert(mParagraphs.begin() + paragraph + 1, newlines, Paragraph());
+            for (uint i = paragraph + 1; i <= paragraph + newlines; i++)
+            {
+                layoutParagraph(i);
+            }
+        }
+        updateFirstLines(paragraph);
+
+        scrollToCursor();
+        fillMesh();
+    }
+
+    void EditableTextFlow::eraseAtCursor(int letterCount)
+    {
+        // Range of letters to erase
+        uint begin = mCursor;
+        uint end = mCursor;
+        if (letterCount < 0)
+        {
+            begin -= std::min((uint)(-(int64_t)letterCount), mCursor);
+        }
+        else
+        {
+            end += std::min((uint)letterCount, mText.getLength() - mCursor);
+        }
+        if (begin == end)
+        {
+            return;
+        }
+
+        EYEGUI_PROFILE_SCOPE(mpGUI->getProfiler(), ProfilePhase::TEXT_MESHING);
+
+        // Paragraphs of range are joined into first one
+        uint first = mText.getLineOfPosition(begin);
+        uint last = mText.getLineOfPosition(end);
+        uint letter = begin - mText.getLineStart(first);
+        uint oldLength = getParagraphLength(first);
+        uint endLength = mText.getLineStart(last) + getParagraphLength(last) - end;
+        mText.erase(begin, end - begin);
+        mCursor = begin;
+
+        // Letters of joined paragraphs behind range are appended to first one
+        mParagraphs.erase(mParagraphs.begin() + first + 1, mParagraphs.begin() + last + 1);
+        if (first == last)
+        {
+            relayoutParagraph(first, letter, end - begin, 0);
+        }
+        else
+        {
+            relayoutParagraph(first, letter, oldLength - letter, endLength);
+        }
+        updateFirstLines(first);
+
+        scrollToCursor();
+        fillMesh();
+    }
+
+    void EditableTextFlow::moveCursorOverLetters(int letterCount)
+    {
+        int64_t cursor = (int64_t)mCursor + letterCount;
+        mCursor = (uint)std::max((int64_t)0, std::min(cursor, (int64_t)mText.getLength()));
+
+        // Geometry only changes when scrolling
+        if (scrollToCursor())
+        {
+            fillMesh();
+        }
+    }
+
+    void EditableTextFlow::moveCursorOverLines(int lineCount)
+    {
+        uint paragraph, line;
+        float x;
+        locateCursor(paragraph, line, x);
+
+        // Find target line in all lines
+        int64_t target = (int64_t)mFirstLines[paragraph] + line + lineCount;
+        target = std::max((int64_t)0, std::min(target, (int64_t)mFirstLines.back() - 1));
+        paragraph = (uint)(std::upper_bound(mFirstLines.begin(), mFirstLines.end(), (uint)target) - mFirstLines.begin()) - 1;
+        const Paragraph& rParagraph = mParagraphs[paragraph];
+        line = (uint)target - mFirstLines[paragraph];
+
+        // Take letter of line nearest to horizontal position of cursor
+        const Line& rLine = rParagraph.lines[line];
+        uint nearest = 0;
+        for (uint i = 1; i < rLine.pens.size(); i++)
+        {
+            if (std::abs(rLine.pens[i] - x) < std::abs(rLine.pens[nearest] - x))
+            {
+                nearest = i;
+            }
+        }
+        mCursor = mText.getLineStart(paragraph) + rLine.start + nearest;
+
+        // Geometry only changes when scrolling
+        if (scrollToCursor())
+        {
+            fillMesh();
+        }
+    }
+
+    void EditableTextFlow::transformAndSize(
+        int x,
+        int y,
+        int width,
+        int height)
+    {
+        EYEGUI_PROFILE_SCOPE(mpGUI->getProfiler(), ProfilePhase::TEXT_MESHING);
+
+        mX = x;
+        mY = y;
+        mWidth = width;
+        mHeight = height;
+
+        // Width and font atlas may have changed
+        layoutAll();
+        scrollToCursor();
+        fillMesh();
+    }
+
+    void EditableTextFlow::draw(
+           glm::vec4 color,
+           float alpha,
+           float activity,
+           glm::vec4 dimColor,
+           float dim,
+           glm::vec4 markColor,
+           float mark) const
+    {
+        mupMesh->bind();
+
+        // Calculate transformation matrix
+        glm::mat4 matrix = glm::mat4(1.0f);
+        matrix = glm::translate(matrix, glm::vec3(mX, mpGUI->getWindowHeight() - mY, 0)); // Change coordinate system and translate to position
+        matrix = glm::ortho(0.0f, (float)(mpGUI->getWindowWidth() - 1), 0.0f, (float)(mpGUI->getWindowHeight() - 1)) * matrix; // Pixel to world space
+
+        // Bind atlas texture
+        mpFont->bindAtlasTexture(mFontSize, 0, mScale != 1.0f);
+
+        // Fill uniforms
+        mpShader->fillValue("matrix", matrix);
+        mpShader->fillValue("color", color);
+        mpShader->fillValue("alpha", alpha);
+        mpShader->fillValue("activity", activity);
+        mpShader->fillValue("dimColor", dimColor);
+        mpShader->fillValue("dim", dim);
+        mpShader->fillValue("markColor", markColor);
+        mpShader->fillValue("mark", mark);
+
+        // Draw flow
+        mupMesh->draw();
+
+        // Draw cursor if its line is visible
+        uint paragraph, line;
+        float x;
+        locateCursor(paragraph, line, x);
+        line += mFirstLines[paragraph];
+        if (line >= mScrollLine && line < mScrollLine + getVisibleLineCount())
+        {
+            float lineHeight = mScale * mpFont->getLineHeight(mFontSize);
+            int cursorWidth = std::max(1, (int)(TEXT_EDIT_CURSOR_WIDTH * lineHeight));
+            int cursorX = std::max(0, std::min((int)x, mWidth - cursorWidth));
+
+            mpCursor->bind();
+            mpCursor->getShader()->fillValue("matrix", calculateDrawMatrix(
+                mpGUI->getWindowWidth(),
+                mpGUI->getWindowHeight(),
+                mX + cursorX,
+                mY + (int)((line - mScrollLine) * lineHeight),
+                cursorWidth,
+                (int)lineHeight));
+            mpCursor->getShader()->fillValue("color", color);
+            mpCursor->getShader()->fillValue("alpha", alpha);
+            mpCursor->draw();
+        }
+    }
+
+    void EditableTextFlow::layoutParagraph(uint paragraph)
+    {
+        // Start from empty line
+        Paragraph& rParagraph = mParagraphs[paragraph];
+        rParagraph.lines.assign(1, Line());
+        rParagraph.lines[0].start = 0;
+        rParagraph.lines[0].pens.assign(1, 0);
+        relayoutParagraph(paragraph, 0, 0, getParagraphLength(paragraph));
+    }
+
+    void EditableTextFlow::relayoutParagraph(uint paragraph, uint letter, uint removedCount, uint insertedCount)
+    {
+        Paragraph& rParagraph = mParagraphs[paragraph];
+        std::vector<Line>& rLines = rParagraph.lines;
+        uint start = mText.getLineStart(paragraph);
+        uint length = getParagraphLength(paragraph);
+
+        // Edited word may move to previous line, so wrapping restarts at line in front of the one holding start of word
+        uint line = getLineOfLetter(rParagraph, letter);
+        while (line > 0 && mText.getText(start + rLines[line].start - 1, 1)[0] != u' ')
+        {
+            line--;
+        }
+        if (line > 0)
+        {
+            line--;
+        }
+        uint restartLetter = rLines[line].start;
+
+        // Letters are fetched in chunks while wrapping, so only laid out lines are read
+        std::u16string text;
+        auto getLetter = [&](uint i)
+        {
+            while (i - restartLetter >= text.size())
+            {
+                text += mText.getText(start + restartLetter + (uint)text.size(), TEXT_EDIT_LAYOUT_CHUNK);
+            }
+            return text[i - restartLetter];
+        };
+
+        // Letters not covered by character set take no space
+        auto getAdvance = [&](char16_t character)
+        {
+            Glyph const * pGlyph = mpFont->getGlyph(mFontSize, character);
+            return pGlyph == NULL ? 0.0f : mScale * pGlyph->advance.x;
+        };
+
+        // Old lines starting behind edit are kept, once a new line starts at their shifted first letter
+        uint oldLine = line + 1;
+        while (oldLine < rLines.size() && rLines[oldLine].start < letter + removedCount)
+        {
+            oldLine++;
+        }
+        bool synced = false;
+
+        std::vector<Line> lines(1);
+        lines.back().start = restartLetter;
+        float xPixelPen = 0;
+        auto breakLine = [&](uint i)
+        {
+            while (oldLine < rLines.size() && rLines[oldLine].start - removedCount + insertedCount < i)
+            {
+                oldLine++;
+            }
+            if (oldLine < rLines.size() && rLines[oldLine].start - removedCount + insertedCount == i)
+            {
+                return true;
+            }
+            lines.push_back(Line());
+            lines.back().start = i;
+            xPixelPen = 0;
+            return false;
+        };
+
+        uint i = restartLetter;
+        while (i < length && !synced)
+        {
+            // Spaces stay at end of line
+            if (getLetter(i) == u' ')
+            {
+                lines.back().pens.push_back(xPixelPen);
+                xPixelPen += getAdvance(u' ');
+                i++;
+                continue;
+            }
+
+            // Word is moved to next line if it does not fit
+            uint wordEnd = i;
+            float wordPixelWidth = 0;
+            while (wordEnd < length && getLetter(wordEnd) != u' ')
+            {
+                wordPixelWidth += getAdvance(getLetter(wordEnd));
+                wordEnd++;
+            }
+            if (xPixelPen > 0 && xPixelPen + wordPixelWidth > mWidth)
+            {
+                synced = breakLine(i);
+            }
+
+            for (; i < wordEnd && !synced; i++)
+            {
+                Glyph const * pGlyph = mpFont->getGlyph(mFontSize, getLetter(i));
+                float advance = pGlyph == NULL ? 0.0f : mScale * pGlyph->advance.x;
+
+                // Word wider than line is split
+                if (xPixelPen > 0 && xPixelPen + advance > mWidth)
+                {
+                    synced = breakLine(i);
+                    if (synced)
+                    {
+                        break;
+                    }
+                }
+                Line& rLine = lines.back();
+                rLine.pens.push_back(xPixelPen);
+
+                if (pGlyph != NULL)
+                {
+                    float yPixelPen = 0 - (mScale * (float)(pGlyph->size.y - pGlyph->bearing.y));
+                    float width = mScale * pGlyph->size.x;
+                    float height = mScale * pGlyph->size.y;
+
+                    // Vertices for this quad
+                    glm::vec3 vertexA = glm::vec3(xPixelPen, yPixelPen, 0);
+                    glm::vec3 vertexB = glm::vec3(xPixelPen + width, yPixelPen, 0);
+                    glm::vec3 vertexC = glm::vec3(xPixelPen + width, yPixelPen + height, 0);
+                    glm::vec3 vertexD = glm::vec3(xPixelPen, yPixelPen + height, 0);
+                    rLine.vertices.insert(rLine.vertices.end(), { vertexA, vertexB, vertexC, vertexC, vertexD, vertexA });
+
+                    // Texture coordinates for this quad
+                    glm::vec2 textureCoordinateA = glm::vec2(pGlyph->atlasPosition.x, pGlyph->atlasPosition.y);
+                    glm::vec2 textureCoordinateB = glm::vec2(pGlyph->atlasPosition.z, pGlyph->atlasPosition.y);
+                    glm::vec2 textureCoordinateC = glm::vec2(pGlyph->atlasPosition.z, pGlyph->atlasPosition.w);
+                    glm::vec2 textureCoordinateD = glm::vec2(pGlyph->atlasPosition.x, pGlyph->atlasPosition.w);
+                    rLine.textureCoordinates.insert(
+                        rLine.textureCoordinates.end(),
+                        { textureCoordinateA, textureCoordinateB, textureCoordinateC, textureCoordinateC, textureCoordinateD, textureCoordinateA });
+                }
+
+                xPixelPen += advance;
+            }
+        }
+
+        // Last line holds pen at end of paragraph
+        uint oldEndLine = synced ? oldLine : (uint)rLines.size();
+        if (!synced)
+        {
+            lines.back().pens.push_back(xPixelPen);
+        }
+
+        // Following lines are kept and only their first letter is moved
+        for (uint j = oldEndLine; j < rLines.size(); j++)
+        {
+            rLines[j].start = rLines[j].start - removedCount + insertedCount;
+        }
+
+        // Replace lines laid out again, count of lines rarely changes
+        uint oldCount = oldEndLine - line;
+        uint count = (uint)lines.size();
+        if (count > oldCount)
+        {
+            rLines.insert(rLines.begin() + oldEndLine, count - oldCount, Line());
+        }
+        else if (count < oldCount)
+        {
+            rLines.erase(rLines.begin() + line + count, rLines.begin() + oldEndLine);
+        }
+        std::move(lines.begin(), lines.end(), rLines.begin() + line);
+    }
+
+    uint EditableTextFlow::getParagraphLength(uint paragraph) const
+    {
+        uint end = paragraph + 1 < mText.getLineCount() ? mText.getLineStart(paragraph + 1) - 1 : mText.getLength();
+        return end - mText.getLineStart(paragraph);
+    }
+
+    uint EditableTextFlow::getLineOfLetter(const Paragraph& rParagraph, uint letter) const
+    {
+        auto it = std::upper_bound(
+            rParagraph.lines.begin(),
+            rParagraph.lines.end(),
+            letter,
+            [](uint value, const Line& rLine) { return value < rLine.start; });
+        return (uint)(it - rParagraph.lines.begin()) - 1;
+    }
+
+    void EditableTextFlow::layoutAll()
+    {
+        mParagraphs.assign(mText.getLineCount(), Paragraph());
+        for (uint i = 0; i < mParagraphs.size(); i++)
+        {
+            layoutParagraph(i);
+        }
+        updateFirstLines(0);
+    }
+
+    void EditableTextFlow::updateFirstLines(uint paragraph)
+    {
+        mFirstLines.resize(mParagraphs.size() + 1);
+        mFirstLines[0] = 0;
+        for (uint i = paragraph; i < mParagraphs.size(); i++)
+        {
+            mFirstLines[i + 1] = mFirstLines[i] + (uint)mParagraphs[i].lines.size();
+        }
+    }
+
+    void EditableTextFlow::locateCursor(uint& rParagraph, uint& rLine, float& rX) const
+    {
+        rParagraph = mText.getLineOfPosition(mCursor);
+        uint letter = mCursor - mText.getLineStart(rParagraph);
+        const Paragraph& rCursorParagraph = mParagraphs[rParagraph];
+        rLine = getLineOfLetter(rCursorParagraph, letter);
+        rX = rCursorParagraph.lines[rLine].pens[letter - rCursorParagraph.lines[rLine].start];
+    }
+
+    bool EditableTextFlow::scrollToCursor()
+    {
+        uint paragraph, line;
+        float x;
+        locateCursor(paragraph, line, x);
+        line += mFirstLines[paragraph];
+
+        // Do not scroll further than necessary to show last line
+        uint oldScrollLine = mScrollLine;
+        uint visibleLineCount = getVisibleLineCount();
+        uint lineCount = mFirstLines.back();
+        mScrollLine = std::min(mScrollLine, lineCount > visibleLineCount ? lineCount - visibleLineCount : 0);
+
+        if (line < mScrollLine)
+        {
+            mScrollLine = line;
+        }
+        else if (line >= mScrollLine + visibleLineCount)
+        {
+            mScrollLine = line - visibleLineCount + 1;
+        }
+        return mScrollLine != oldScrollLine;
+    }
+
+    void EditableTextFlow::fillMesh()
+    {
+        // Visible geometry changes little between edits
+        std::vector<glm::vec3> vertices;
+        std::vector<glm::vec2> textureCoordinates;
+        vertices.reserve(mupMesh->getVertexCount() + 64);
+        textureCoordinates.reserve(mupMesh->getVertexCount() + 64);
+
+        // Collect visible lines, pens are in local pixel coordinate system with origin in lower left corner of element
+        float lineHeight = mScale * mpFont->getLineHeight(mFontSize);
+        uint endLine = std::min(mFirstLines.back(), mScrollLine + getVisibleLineCount());
+        if (mScrollLine < endLine)
+        {
+            uint paragraph = (uint)(std::upper_bound(mFirstLines.begin(), mFirstLines.end(), mScrollLine) - mFirstLines.begin()) - 1;
+            for (uint line = mScrollLine; line < endLine; line++)
+            {
+                while (line >= mFirstLines[paragraph + 1])
+                {
+                    paragraph++;
+                }
+                const Line& rLine = mParagraphs[paragraph].lines[line - mFirstLines[paragraph]];
+
+                // Copy line and move it to its baseline
+                size_t offset = vertices.size();
+                vertices.insert(vertices.end(), rLine.vertices.begin(), rLine.vertices.end());
+                textureCoordinates.insert(textureCoordinates.end(), rLine.textureCoordinates.begin(), rLine.textureCoordinates.end());
+                float yPixelPen = -((float)(line - mScrollLine) + 1.0f) * lineHeight;
+                for (size_t i = offset; i < vertices.size(); i++)
+                {
+                    vertices[i].y += yPixelPen;
+                }
+            }
+        }
+
+        // Fill into mesh, which is uploaded before next drawing
+        mupMesh->setData(std::move(vertices), std::move(textureCoordinates));
+    }
+
+    uint EditableTextFlow::getVisibleLineCount() const
+    {
+        // At least line of cursor is shown
+        float lineHeight = mScale * mpFont->getLineHeight(mFontSize);
+        if (lineHeight <= 0)
+        {
+            return 1;
+        }
+        return std::max(1u, (uint)(mHeight / lineHeight));
+    }
+}
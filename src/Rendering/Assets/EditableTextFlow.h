@@ -0,0 +1,152 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Text flow which is edited at a cursor, like while typing with the eyes.
+// Content is kept in a piece table. Geometry is cached per paragraph relative
+// to the baseline of each line. An edit wraps its paragraph again from the
+// line in front of the edited word, until a line starts at the same letter as
+// before. Following lines and paragraphs are just moved. Mesh contains only
+// visible lines, which are scrolled to the cursor.
+// Values are in pixel space with origin at upper left, like in text flow.
+
+#ifndef EDITABLE_TEXT_FLOW_H_
+#define EDITABLE_TEXT_FLOW_H_
+
+#include "src/Rendering/Font/Font.h"
+#include "src/Rendering/Shader.h"
+#include "src/Rendering/DynamicMesh.h"
+#include "src/Rendering/RenderItem.h"
+#include "src/Utilities/PieceTable.h"
+#include "src/Utilities/ElementArena.h"
+
+#include <vector>
+
+namespace eyegui
+{
+    // Forward declaration
+    class GUI;
+    class AssetManager;
+
+    class EditableTextFlow : public ArenaAllocated
+    {
+    public:
+
+        // Constructor, cursor is placed at end of content
+        EditableTextFlow(
+            GUI const * pGUI,
+            AssetManager* pAssetManager,
+            Font const * pFont,
+            FontSize fontSize,
+            float scale,
+            std::u16string content);
+
+        // Destructor
+        virtual ~EditableTextFlow();
+
+        // Replace content, cursor is placed at end of it
+        void setContent(std::u16string content);
+
+        // Get content
+        std::u16string getContent() const;
+
+        // Insert text in front of cursor
+        void insertAtCursor(const std::u16string& rText);
+
+        // Erase letters behind cursor, or in front of it for negative count
+        void eraseAtCursor(int letterCount);
+
+        // Move cursor over letters, negative count moves to front
+        void moveCursorOverLetters(int letterCount);
+
+        // Move cursor over displayed lines, keeping horizontal position
+        void moveCursorOverLines(int lineCount);
+
+        // Transform and size (has to be called before first usage)
+        void transformAndSize(
+            int x,
+            int y,
+            int width,
+            int height);
+
+        // Record drawing of text and cursor
+        void draw(
+           glm::vec4 color,
+           float alpha,
+           float activity,
+           glm::vec4 dimColor,
+           float dim,
+           glm::vec4 markColor,
+           float mark) const;
+
+    private:
+
+        // Geometry of line, vertices are relative to its baseline
+        struct Line
+        {
+            uint start; // first letter of line in paragraph
+            std::vector<glm::vec3> vertices;
+            std::vector<glm::vec2> textureCoordinates;
+            std::vector<float> pens; // horizontal position of cursor in front of each letter, last line has one more at end
+        };
+
+        // Geometry of paragraph
+        struct Paragraph
+        {
+            std::vector<Line> lines;
+        };
+
+        // Lay out paragraph from content
+        void layoutParagraph(uint paragraph);
+
+        // Lay out paragraph again after letters at given letter were replaced
+        void relayoutParagraph(uint paragraph, uint letter, uint removedCount, uint insertedCount);
+
+        // Get count of letters in paragraph without new line
+        uint getParagraphLength(uint paragraph) const;
+
+        // Get line of paragraph holding letter
+        uint getLineOfLetter(const Paragraph& rParagraph, uint letter) const;
+
+        // Lay out all paragraphs
+        void layoutAll();
+
+        // Update first line of paragraphs starting at given one
+        void updateFirstLines(uint paragraph);
+
+        // Get paragraph, line in paragraph and horizontal position of cursor
+        void locateCursor(uint& rParagraph, uint& rLine, float& rX) const;
+
+        // Scroll so that cursor is visible, returns whether scrolling changed
+        bool scrollToCursor();
+
+        // Fill visible lines into mesh
+        void fillMesh();
+
+        // Get count of lines fitting into height
+        uint getVisibleLineCount() const;
+
+        // Members
+        GUI const * mpGUI;
+        AssetManager* mpAssetManager;
+        Font const * mpFont;
+        FontSize mFontSize;
+        float mScale;
+        int mX;
+        int mY;
+        int mWidth;
+        int mHeight;
+        PieceTable mText;
+        uint mCursor;
+        std::vector<Paragraph> mParagraphs;
+        std::vector<uint> mFirstLines; // first line of each paragraph and count of lines at end
+        uint mScrollLine; // first visible line
+        Shader const * mpShader;
+        std::unique_ptr<DynamicMesh> mupMesh;
+        RenderItem const * mpCursor;
+    };
+}
+
+#endif // EDITABLE_TEXT_FLOW_H_
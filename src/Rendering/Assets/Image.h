@@ -11,6 +11,7 @@
 #define IMAGE_H_
 
 #include "include/eyeGUI.h"
+#include "src/Utilities/ElementArena.h"
 #include "externals/GLM/glm/glm.hpp"
 
 #include <string>
@@ -23,7 +24,7 @@ namespace eyegui
     class RenderItem;
     class Texture;
 
-    class Image
+    class Image : public ArenaAllocated
     {
     public:
 
@@ -28,11 +28,6 @@ namespace eyegui
         mFocus.setValue(0);
         mPicked = false;
         mPick.setValue(0);
-
-        // Fetch render item for key circle
-        mpCircleRenderItem = mpAssetManager->fetchRenderItem(
-            shaders::Type::KEY,
-            meshes::Type::QUAD);
     }
 
     Key::Key(const Key& rOtherKey)
@@ -47,7 +42,21 @@ namespace eyegui
         mFocus.setValue(rOtherKey.mFocus.getValue());
         mPicked = rOtherKey.mPicked;
         mPick.setValue(rOtherKey.mPick.getValue());
-        mpCircleRenderItem = rOtherKey.mpCircleRenderItem;
+    }
+
+    Key& Key::operator=(const Key& rOtherKey)
+    {
+        // Copy members
+        mpLayout = rOtherKey.mpLayout;
+        mpAssetManager = rOtherKey.mpAssetManager;
+        mX = rOtherKey.mX;
+        mY = rOtherKey.mY;
+        mSize = rOtherKey.mSize;
+        mFocused = rOtherKey.mFocused;
+        mFocus.setValue(rOtherKey.mFocus.getValue());
+        mPicked = rOtherKey.mPicked;
+        mPick.setValue(rOtherKey.mPick.getValue());
+        return *this;
     }
 
     Key::~Key()
@@ -105,6 +114,11 @@ namespace eyegui
         return mFocus.getValue();
     }
 
+    float Key::getPickValue() const
+    {
+        return mPick.getValue();
+    }
+
     void Key::setPicked(bool picked)
     {
         mPicked = picked;
@@ -125,45 +139,26 @@ namespace eyegui
         return mSize;
     }
 
-    void Key::drawCircle(
-            int oglStencilX,
-            int oglSencilY,
-            int oglStencilWidth,
-            int oglStencilHeight,
-            glm::vec4 color,
-            glm::vec4 pickColor,
-            float activity,
-            glm::vec4 dimColor,
-            float dim,
-            glm::vec4 markColor,
-            float mark,
-            glm::vec4 highlightColor,
-            float highlight,
-            float alpha) const
-    {
-        // Bind and fill render item
-        mpCircleRenderItem->bind();
-
-        // Fill color
-        glm::vec4 circleColor = color;
-        circleColor.a *= alpha;
-        mpCircleRenderItem->getShader()->fillValue("color", circleColor);
-
-        // Fill other uniforms
-        mpCircleRenderItem->getShader()->fillValue("time", mpLayout->getAccPeriodicTime());
-        mpCircleRenderItem->getShader()->fillValue("matrix", mCircleMatrix); // Matrix is updated in transform and size
-        mpCircleRenderItem->getShader()->fillValue("pickColor", pickColor);
-        mpCircleRenderItem->getShader()->fillValue("pick", mPick.getValue());
-        mpCircleRenderItem->getShader()->fillValue("stencil", glm::vec4(oglStencilX, oglSencilY, oglStencilWidth, oglStencilHeight));
-        mpCircleRenderItem->getShader()->fillValue("activity", activity);
-        mpCircleRenderItem->getShader()->fillValue("dimColor", dimColor);
-        mpCircleRenderItem->getShader()->fillValue("dim", dim);
-        mpCircleRenderItem->getShader()->fillValue("markColor", markColor);
-        mpCircleRenderItem->getShader()->fillValue("mark", mark);
-        mpCircleRenderItem->getShader()->fillValue("highlightColor", highlightColor);
-        mpCircleRenderItem->getShader()->fillValue("highlight", highlight);
-
-        // Drawing
-        mpCircleRenderItem->draw();
+    void Key::addInstances(
+        std::vector<float>& rCircleInstances,
+        std::vector<float>& /*rCharacterInstances*/,
+        float alpha) const
+    {
+        // Matrix is updated in transform and size
+        addMatrix(rCircleInstances, mCircleMatrix);
+        rCircleInstances.push_back(mPick.getValue());
+        rCircleInstances.push_back(alpha);
+    }
+
+    void Key::addMatrix(std::vector<float>& rInstances, const glm::mat4& rMatrix)
+    {
+        // Column major like expected by OpenGL
+        for (int i = 0; i < 4; i++)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                rInstances.push_back(rMatrix[i][j]);
+            }
+        }
     }
 }
@@ -10,11 +10,12 @@
 #define KEY_H_
 
 #include "src/Rendering/Font/Font.h"
-#include "src/Rendering/Shader.h"
-#include "src/Rendering/RenderItem.h"
 #include "src/Utilities/LerpValue.h"
+#include "src/Utilities/ElementArena.h"
 #include "externals/OpenGLLoader/gl_core_3_3.h"
 
+#include <vector>
+
 namespace eyegui
 {
     // Forward declaration
@@ -22,7 +23,7 @@ namespace eyegui
     class AssetManager;
 
     // Abstract superclass of key
-    class Key
+    class Key : public ArenaAllocated
     {
     public:
 
@@ -32,6 +33,9 @@ namespace eyegui
         // Copy constructor
         Key(const Key& rOtherKey);
 
+        // Assignment operator, copies same members like copy constructor
+        Key& operator=(const Key& rOtherKey);
+
         // Destructor
         virtual ~Key() = 0;
 
@@ -44,23 +48,11 @@ namespace eyegui
         // Update
         virtual void update(float tpf);
 
-        // Draw (stencil values in eyeGUI coordinate system)
-        virtual void draw(
-            int stencilX,
-            int stencilY,
-            int stencilWidth,
-            int stencilHeight,
-            glm::vec4 color,
-            glm::vec4 pickColor,
-            glm::vec4 iconColor,
-            float activity,
-            glm::vec4 dimColor,
-            float dim,
-            glm::vec4 markColor,
-            float mark,
-            glm::vec4 highlightColor,
-            float highlight,
-            float alpha) const = 0;
+        // Append values of instances drawn by keyboard, ordered like attributes of key shaders
+        virtual void addInstances(
+            std::vector<float>& rCircleInstances,
+            std::vector<float>& rCharacterInstances,
+            float alpha) const;
 
         // Reset
         virtual void reset();
@@ -74,6 +66,9 @@ namespace eyegui
         // Get value of focus
         float getFocusValue() const;
 
+        // Get value of pick
+        float getPickValue() const;
+
         // Picked
         void setPicked(bool picked);
 
@@ -91,22 +86,8 @@ namespace eyegui
 
     protected:
 
-        // Draw circle (stencil values already in OpenGL coordinates)
-        void drawCircle(
-            int oglStencilX,
-            int oglSencilY,
-            int oglStencilWidth,
-            int oglStencilHeight,
-            glm::vec4 color,
-            glm::vec4 pickColor,
-            float activity,
-            glm::vec4 dimColor,
-            float dim,
-            glm::vec4 markColor,
-            float mark,
-            glm::vec4 highlightColor,
-            float highlight,
-            float alpha) const;
+        // Append matrix
+        static void addMatrix(std::vector<float>& rInstances, const glm::mat4& rMatrix);
 
         // Members
         int mX;
@@ -114,7 +95,6 @@ namespace eyegui
         int mSize;
         Layout const * mpLayout;
         AssetManager* mpAssetManager;
-        RenderItem const * mpCircleRenderItem;
         bool mFocused;
         LerpValue mFocus;
         bool mPicked;
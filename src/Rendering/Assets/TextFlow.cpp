@@ -45,47 +45,14 @@ namespace eyegui
         mY = 0;
         mWidth = 0;
         mHeight = 0;
-        mVertexCount = 0;
-
-        // Save currently set buffer and vertex array object
-        GLint oldBuffer = -1;
-        GLint oldVAO = -1;
-        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
-        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVAO);
-
-        // Initialize mesh buffers and vertex array object
-        glGenBuffers(1, &mVertexBuffer);
-        glGenBuffers(1, &mTextureCoordinateBuffer);
-        glGenVertexArrays(1, &mVertexArrayObject);
-
-        // Bind stuff to vertex array object
-        glBindVertexArray(mVertexArrayObject);
-
-        // Vertices
-        GLuint vertexAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "posAttribute");
-        glEnableVertexAttribArray(vertexAttrib);
-        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
-        glVertexAttribPointer(vertexAttrib, 3, GL_FLOAT, GL_FALSE, 0, NULL);
-
-        // Texture coordinates
-        GLuint uvAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "uvAttribute");
-        glEnableVertexAttribArray(uvAttrib);
-        glBindBuffer(GL_ARRAY_BUFFER, mTextureCoordinateBuffer);
-        glVertexAttribPointer(uvAttrib, 2, GL_FLOAT, GL_FALSE, 0, NULL);
-
-        // Restore old settings
-        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
-        glBindVertexArray(oldVAO);
+
+        // Mesh is filled by calculation
+        mupMesh = mpAssetManager->createDynamicMesh(shaders::Type::TEXT_FLOW);
     }
 
     TextFlow::~TextFlow()
     {
-        // Delete vertex array object
-        glDeleteVertexArrays(1, &mVertexArrayObject);
-
-        // Delete buffers
-        glDeleteBuffers(1, &mVertexBuffer);
-        glDeleteBuffers(1, &mTextureCoordinateBuffer);
+        // Nothing to do
     }
 
     // Set content
@@ -95,6 +62,11 @@ namespace eyegui
         calculateMesh();
     }
 
+    const std::u16string& TextFlow::getContent() const
+    {
+        return mContent;
+    }
+
     // Transform and size
     void TextFlow::transformAndSize(
         int x,
@@ -118,8 +90,7 @@ namespace eyegui
            glm::vec4 markColor,
            float mark) const
     {
-        mpShader->bind();
-        glBindVertexArray(mVertexArrayObject);
+        mupMesh->bind();
 
         // Calculate y offset because of vertical alignment
         int yOffset;
@@ -162,14 +133,13 @@ namespace eyegui
         mpShader->fillValue("mark", mark);
 
         // Draw flow
-        glDrawArrays(GL_TRIANGLES, 0, mVertexCount);
+        mupMesh->draw();
     }
 
     void TextFlow::calculateMesh()
     {
-        // Save currently set buffer
-        GLint oldBuffer = -1;
-        glGetIntegerv(GL_ARRAY_BUFFER, &oldBuffer);
+        EYEGUI_PROFILE_SCOPE(mpGUI->getProfiler(), ProfilePhase::TEXT_MESHING);
+        EYEGUI_TRACE_SCOPE("TextFlow::calculateMesh", "characters: " + std::to_string(mContent.size()));
 
         // Get size of space character
         float pixelOfSpace = 0;
@@ -340,18 +310,8 @@ namespace eyegui
         // Get height of all lines (yPixelPen is one line to low now)
         mFlowHeight = (int)std::max(std::ceil(abs(yPixelPen) - lineHeight), 0.0f);
 
-        // Vertex count
-        mVertexCount = (GLuint)vertices.size();
-
-        // Fill into buffer
-        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
-        glBufferData(GL_ARRAY_BUFFER, mVertexCount * 3 * sizeof(float), vertices.data(), GL_DYNAMIC_DRAW);
-
-        glBindBuffer(GL_ARRAY_BUFFER, mTextureCoordinateBuffer);
-        glBufferData(GL_ARRAY_BUFFER, mVertexCount * 2 * sizeof(float), textureCoordinates.data(), GL_DYNAMIC_DRAW);
-
-        // Restore old setting
-        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+        // Fill into mesh, which is uploaded before next drawing
+        mupMesh->setData(std::move(vertices), std::move(textureCoordinates));
     }
 
     TextFlow::Word TextFlow::calculateWord(std::u16string content, float scale) const
@@ -14,6 +14,8 @@
 
 #include "src/Rendering/Font/Font.h"
 #include "src/Rendering/Shader.h"
+#include "src/Rendering/DynamicMesh.h"
+#include "src/Utilities/ElementArena.h"
 #include "externals/OpenGLLoader/gl_core_3_3.h"
 
 #include <vector>
@@ -24,7 +26,7 @@ namespace eyegui
     class GUI;
     class AssetManager;
 
-    class TextFlow
+    class TextFlow : public ArenaAllocated
     {
     public:
 
@@ -45,6 +47,9 @@ namespace eyegui
         // Set content
         void setContent(std::u16string content);
 
+        // Get content
+        const std::u16string& getContent() const;
+
         // Transform and size (has to be called before first usage)
         void transformAndSize(
             int x,
@@ -52,7 +57,7 @@ namespace eyegui
             int width,
             int height);
 
-        // Draw (uses orthoprojection to scale to screen)
+        // Record drawing (uses orthoprojection to scale to screen)
         void draw(
            glm::vec4 color,
            float alpha,
@@ -101,10 +106,7 @@ namespace eyegui
         int mFlowHeight;
 
         Shader const * mpShader;
-        GLuint mVertexCount;
-        GLuint mVertexBuffer;
-        GLuint mTextureCoordinateBuffer;
-        GLuint mVertexArrayObject;
+        std::unique_ptr<DynamicMesh> mupMesh;
     };
 }
 
@@ -0,0 +1,206 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "DamageRegion.h"
+
+#include <algorithm>
+
+namespace eyegui
+{
+    DamageRegion::DamageRegion()
+    {
+        // Initialize members, first frame has to be drawn completely
+        mFull = true;
+        mClipping = false;
+    }
+
+    DamageRegion::~DamageRegion()
+    {
+        // Nothing to do
+    }
+
+    void DamageRegion::add(int x, int y, int width, int height)
+    {
+        if (mFull || width <= 0 || height <= 0)
+        {
+            return;
+        }
+
+        DamageRect rect;
+        rect.x = x;
+        rect.y = y;
+        rect.width = width;
+        rect.height = height;
+
+        // Area often is damaged already, for example by element in same place
+        for (const DamageRect& rOther : mRects)
+        {
+            if (rect.x >= rOther.x
+                && rect.y >= rOther.y
+                && rect.x + rect.width <= rOther.x + rOther.width
+                && rect.y + rect.height <= rOther.y + rOther.height)
+            {
+                return;
+            }
+        }
+
+        mRects.push_back(rect);
+        merge();
+    }
+
+    void DamageRegion::addFull()
+    {
+        mFull = true;
+        mRects.clear();
+    }
+
+    bool DamageRegion::isEmpty() const
+    {
+        return !mFull && mRects.empty();
+    }
+
+    bool DamageRegion::isFull() const
+    {
+        return mFull;
+    }
+
+    std::vector<DamageRect> DamageRegion::getRects(int width, int height) const
+    {
+        std::vector<DamageRect> rects;
+        if (mFull)
+        {
+            DamageRect rect;
+            rect.width = width;
+            rect.height = height;
+            rects.push_back(rect);
+        }
+        else
+        {
+            for (const DamageRect& rRect : mRects)
+            {
+                DamageRect clamped;
+                clamped.x = std::max(rRect.x, 0);
+                clamped.y = std::max(rRect.y, 0);
+                clamped.width = std::min(rRect.x + rRect.width, width) - clamped.x;
+                clamped.height = std::min(rRect.y + rRect.height, height) - clamped.y;
+                if (clamped.width > 0 && clamped.height > 0)
+                {
+                    rects.push_back(clamped);
+                }
+            }
+        }
+        return rects;
+    }
+
+    void DamageRegion::clear()
+    {
+        mFull = false;
+        mRects.clear();
+    }
+
+    void DamageRegion::beginClip(DamageRect area)
+    {
+        mClipping = true;
+        mClip = area;
+    }
+
+    void DamageRegion::endClip()
+    {
+        mClipping = false;
+    }
+
+    bool DamageRegion::isClipping() const
+    {
+        return mClipping;
+    }
+
+    DamageRect DamageRegion::getClip() const
+    {
+        return mClip;
+    }
+
+    bool DamageRegion::isClipped(int x, int y, int width, int height) const
+    {
+        return mClipping
+            && (x >= mClip.x + mClip.width
+                || y >= mClip.y + mClip.height
+                || x + width <= mClip.x
+                || y + height <= mClip.y);
+    }
+
+    bool DamageRegion::overlaps(const DamageRect& rA, const DamageRect& rB)
+    {
+        return rA.x < rB.x + rB.width
+            && rB.x < rA.x + rA.width
+            && rA.y < rB.y + rB.height
+            && rB.y < rA.y + rA.height;
+    }
+
+    DamageRect DamageRegion::unite(const DamageRect& rA, const DamageRect& rB)
+    {
+        DamageRect rect;
+        rect.x = std::min(rA.x, rB.x);
+        rect.y = std::min(rA.y, rB.y);
+        rect.width = std::max(rA.x + rA.width, rB.x + rB.width) - rect.x;
+        rect.height = std::max(rA.y + rA.height, rB.y + rB.height) - rect.y;
+        return rect;
+    }
+
+    long long DamageRegion::area(const DamageRect& rRect)
+    {
+        return (long long)rRect.width * (long long)rRect.height;
+    }
+
+    void DamageRegion::merge()
+    {
+        bool merged = true;
+        while (merged)
+        {
+            merged = false;
+
+            // Overlapping areas are drawn at once, as well as areas whose
+            // bounding area is not bigger than both of them together
+            for (uint i = 0; i < mRects.size() && !merged; i++)
+            {
+                for (uint j = i + 1; j < mRects.size() && !merged; j++)
+                {
+                    if (overlaps(mRects[i], mRects[j])
+                        || area(unite(mRects[i], mRects[j])) <= area(mRects[i]) + area(mRects[j]))
+                    {
+                        mRects[i] = unite(mRects[i], mRects[j]);
+                        mRects.erase(mRects.begin() + j);
+                        merged = true;
+                    }
+                }
+            }
+
+            // Too many areas, so merge pair with least additional area
+            if (!merged && mRects.size() > DAMAGE_RECT_MAX_COUNT)
+            {
+                uint bestI = 0;
+                uint bestJ = 1;
+                long long bestGrowth = -1;
+                for (uint i = 0; i < mRects.size(); i++)
+                {
+                    for (uint j = i + 1; j < mRects.size(); j++)
+                    {
+                        long long growth = area(unite(mRects[i], mRects[j])) - area(mRects[i]) - area(mRects[j]);
+                        if (bestGrowth < 0 || growth < bestGrowth)
+                        {
+                            bestGrowth = growth;
+                            bestI = i;
+                            bestJ = j;
+                        }
+                    }
+                }
+                mRects[bestI] = unite(mRects[bestI], mRects[bestJ]);
+                mRects.erase(mRects.begin() + bestJ);
+                merged = true;
+            }
+        }
+    }
+}
@@ -0,0 +1,89 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Collects areas of the GUI, which have changed since last drawing. Elements
+// add their old and new area when their drawing changes, events like resizing
+// damage everything. Areas are kept disjoint, since each one is drawn on its
+// own and blending twice would be wrong. Overlapping areas are merged and when
+// there are too many of them, the pair growing least is merged. While drawing
+// damaged areas, the current one is used to skip elements outside of it.
+
+#ifndef DAMAGE_REGION_H_
+#define DAMAGE_REGION_H_
+
+#include "include/eyeGUI.h"
+#include "src/Defines.h"
+
+#include <vector>
+
+namespace eyegui
+{
+    class DamageRegion
+    {
+    public:
+
+        // Constructor
+        DamageRegion();
+
+        // Destructor
+        virtual ~DamageRegion();
+
+        // Add area in pixels, empty areas are ignored
+        void add(int x, int y, int width, int height);
+
+        // Damage everything
+        void addFull();
+
+        // Whether nothing has changed
+        bool isEmpty() const;
+
+        // Whether everything has changed
+        bool isFull() const;
+
+        // Get damaged areas clamped to given size
+        std::vector<DamageRect> getRects(int width, int height) const;
+
+        // Forget all damage, done after drawing
+        void clear();
+
+        // Restrict drawing to area until clip is ended
+        void beginClip(DamageRect area);
+
+        // Drawing is not restricted anymore
+        void endClip();
+
+        // Whether drawing is restricted
+        bool isClipping() const;
+
+        // Get area drawing is restricted to
+        DamageRect getClip() const;
+
+        // Whether area is outside of current clip and may be skipped while drawing
+        bool isClipped(int x, int y, int width, int height) const;
+
+    private:
+
+        // Whether areas share pixels
+        static bool overlaps(const DamageRect& rA, const DamageRect& rB);
+
+        // Bounding area of both
+        static DamageRect unite(const DamageRect& rA, const DamageRect& rB);
+
+        // Area in pixels
+        static long long area(const DamageRect& rRect);
+
+        // Merge areas until none touches another and count is small enough
+        void merge();
+
+        // Members
+        std::vector<DamageRect> mRects;
+        bool mFull;
+        bool mClipping;
+        DamageRect mClip;
+    };
+}
+
+#endif // DAMAGE_REGION_H_
@@ -0,0 +1,90 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "DeletionQueue.h"
+
+namespace eyegui
+{
+    DeletionQueue::DeletionQueue()
+    {
+        // Nothing to do
+    }
+
+    DeletionQueue::~DeletionQueue()
+    {
+        flush();
+    }
+
+    void DeletionQueue::deleteVertexArray(GLuint vertexArray)
+    {
+        if (vertexArray != 0)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mVertexArrays.push_back(vertexArray);
+        }
+    }
+
+    void DeletionQueue::deleteBuffer(GLuint buffer)
+    {
+        if (buffer != 0)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mBuffers.push_back(buffer);
+        }
+    }
+
+    void DeletionQueue::deleteTexture(GLuint texture)
+    {
+        if (texture != 0)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mTextures.push_back(texture);
+        }
+    }
+
+    void DeletionQueue::deleteFramebuffer(GLuint framebuffer)
+    {
+        if (framebuffer != 0)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mFramebuffers.push_back(framebuffer);
+        }
+    }
+
+    void DeletionQueue::flush()
+    {
+        // Take objects, so lock is not held while talking to OpenGL
+        std::vector<GLuint> vertexArrays;
+        std::vector<GLuint> buffers;
+        std::vector<GLuint> textures;
+        std::vector<GLuint> framebuffers;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            vertexArrays.swap(mVertexArrays);
+            buffers.swap(mBuffers);
+            textures.swap(mTextures);
+            framebuffers.swap(mFramebuffers);
+        }
+
+        if (!vertexArrays.empty())
+        {
+            glDeleteVertexArrays((GLsizei)vertexArrays.size(), vertexArrays.data());
+        }
+        if (!buffers.empty())
+        {
+            glDeleteBuffers((GLsizei)buffers.size(), buffers.data());
+        }
+        if (!framebuffers.empty())
+        {
+            glDeleteFramebuffers((GLsizei)framebuffers.size(), framebuffers.data());
+        }
+        if (!textures.empty())
+        {
+            glDeleteTextures((GLsizei)textures.size(), textures.data());
+        }
+    }
+}
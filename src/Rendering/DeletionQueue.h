@@ -0,0 +1,53 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Collects names of OpenGL objects, which were used by recorded drawing and
+// are not needed anymore. Objects may be given up by any thread, for example
+// when elements are destroyed while updating, but are deleted by the thread
+// drawing. Vertex arrays and framebuffers are not shared between contexts,
+// so they must be deleted by the context which created them.
+
+#ifndef DELETION_QUEUE_H_
+#define DELETION_QUEUE_H_
+
+#include "externals/OpenGLLoader/gl_core_3_3.h"
+
+#include <mutex>
+#include <vector>
+
+namespace eyegui
+{
+    class DeletionQueue
+    {
+    public:
+
+        // Constructor
+        DeletionQueue();
+
+        // Destructor, deletes remaining objects
+        virtual ~DeletionQueue();
+
+        // Give up objects, zero names are ignored
+        void deleteVertexArray(GLuint vertexArray);
+        void deleteBuffer(GLuint buffer);
+        void deleteTexture(GLuint texture);
+        void deleteFramebuffer(GLuint framebuffer);
+
+        // Delete all given up objects, called by drawing thread
+        void flush();
+
+    private:
+
+        // Members
+        std::mutex mMutex;
+        std::vector<GLuint> mVertexArrays;
+        std::vector<GLuint> mBuffers;
+        std::vector<GLuint> mTextures;
+        std::vector<GLuint> mFramebuffers;
+    };
+}
+
+#endif // DELETION_QUEUE_H_
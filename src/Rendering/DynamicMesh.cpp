@@ -0,0 +1,124 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "DynamicMesh.h"
+
+namespace eyegui
+{
+    DynamicMeshTarget::DynamicMeshTarget(GLuint shaderProgram, DeletionQueue* pDeletionQueue)
+    {
+        // Objects are created at first binding
+        this->shaderProgram = shaderProgram;
+        this->pDeletionQueue = pDeletionQueue;
+        vertexBuffer = 0;
+        textureCoordinateBuffer = 0;
+        vertexArrayObject = 0;
+        uploaded = false;
+        uploadedVersion = 0;
+    }
+
+    DynamicMeshTarget::~DynamicMeshTarget()
+    {
+        // Last snapshot using the mesh may be released by any thread
+        pDeletionQueue->deleteVertexArray(vertexArrayObject);
+        pDeletionQueue->deleteBuffer(vertexBuffer);
+        pDeletionQueue->deleteBuffer(textureCoordinateBuffer);
+    }
+
+    void DynamicMeshTarget::bind(const DynamicMeshData& rData)
+    {
+        if (vertexArrayObject == 0)
+        {
+            // Initialize mesh buffers and vertex array object
+            glGenBuffers(1, &vertexBuffer);
+            glGenBuffers(1, &textureCoordinateBuffer);
+            glGenVertexArrays(1, &vertexArrayObject);
+
+            // Bind stuff to vertex array object
+            glBindVertexArray(vertexArrayObject);
+
+            // Vertices
+            GLuint vertexAttrib = glGetAttribLocation(shaderProgram, "posAttribute");
+            glEnableVertexAttribArray(vertexAttrib);
+            glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+            glVertexAttribPointer(vertexAttrib, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+
+            // Texture coordinates
+            GLuint uvAttrib = glGetAttribLocation(shaderProgram, "uvAttribute");
+            glEnableVertexAttribArray(uvAttrib);
+            glBindBuffer(GL_ARRAY_BUFFER, textureCoordinateBuffer);
+            glVertexAttribPointer(uvAttrib, 2, GL_FLOAT, GL_FALSE, 0, NULL);
+        }
+        else
+        {
+            glBindVertexArray(vertexArrayObject);
+        }
+
+        // Snapshots are executed in order, so other version is always newer
+        if (!uploaded || uploadedVersion != rData.version)
+        {
+            // Binding of array buffer is not part of vertex array object
+            GLint oldBuffer = -1;
+            glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
+
+            glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+            glBufferData(GL_ARRAY_BUFFER, rData.vertices.size() * 3 * sizeof(float), rData.vertices.data(), GL_DYNAMIC_DRAW);
+
+            glBindBuffer(GL_ARRAY_BUFFER, textureCoordinateBuffer);
+            glBufferData(GL_ARRAY_BUFFER, rData.textureCoordinates.size() * 2 * sizeof(float), rData.textureCoordinates.data(), GL_DYNAMIC_DRAW);
+
+            glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+            uploaded = true;
+            uploadedVersion = rData.version;
+        }
+    }
+
+    DynamicMesh::DynamicMesh(RenderSnapshot* pRecording, DeletionQueue* pDeletionQueue, Shader const * pShader)
+    {
+        // Fill members
+        mpRecording = pRecording;
+        mpShader = pShader;
+        mspTarget = std::shared_ptr<DynamicMeshTarget>(new DynamicMeshTarget(mpShader->getShaderProgram(), pDeletionQueue));
+        mspData = std::shared_ptr<const DynamicMeshData>(new DynamicMeshData());
+    }
+
+    DynamicMesh::~DynamicMesh()
+    {
+        // Target is released by last snapshot using it
+    }
+
+    void DynamicMesh::setData(std::vector<glm::vec3> vertices, std::vector<glm::vec2> textureCoordinates)
+    {
+        // Snapshots keep data they were recorded with
+        std::shared_ptr<DynamicMeshData> spData = std::shared_ptr<DynamicMeshData>(new DynamicMeshData());
+        spData->vertices = std::move(vertices);
+        spData->textureCoordinates = std::move(textureCoordinates);
+        spData->version = mspData->version + 1;
+        mspData = spData;
+    }
+
+    void DynamicMesh::setTextureCoordinates(std::vector<glm::vec2> textureCoordinates)
+    {
+        setData(mspData->vertices, std::move(textureCoordinates));
+    }
+
+    void DynamicMesh::bind() const
+    {
+        mpShader->bind();
+        mpRecording->bindDynamicMesh(mspTarget, mspData);
+    }
+
+    void DynamicMesh::draw() const
+    {
+        mpRecording->drawArrays(GL_TRIANGLES, (GLsizei)mspData->vertices.size());
+    }
+
+    uint DynamicMesh::getVertexCount() const
+    {
+        return (uint)mspData->vertices.size();
+    }
+}
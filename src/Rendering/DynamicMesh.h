@@ -0,0 +1,92 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Mesh whose vertices and texture coordinates change over time, like the one
+// of text. Data is set while updating and kept immutable afterwards, so render
+// snapshots can reference the data they were recorded with. Buffers and
+// vertex array object are created and filled by the thread executing the
+// snapshot, right before the mesh is used.
+
+#ifndef DYNAMIC_MESH_H_
+#define DYNAMIC_MESH_H_
+
+#include "Shader.h"
+#include "RenderSnapshot.h"
+#include "DeletionQueue.h"
+#include "src/Utilities/ElementArena.h"
+#include "externals/OpenGLLoader/gl_core_3_3.h"
+
+#include <memory>
+#include <vector>
+
+namespace eyegui
+{
+    // Data of mesh at some point of time
+    struct DynamicMeshData
+    {
+        std::vector<glm::vec3> vertices;
+        std::vector<glm::vec2> textureCoordinates;
+        uint version = 0;
+    };
+
+    // OpenGL objects of mesh, only used by thread executing snapshots
+    struct DynamicMeshTarget
+    {
+        // Constructor
+        DynamicMeshTarget(GLuint shaderProgram, DeletionQueue* pDeletionQueue);
+
+        // Destructor, gives objects to deletion queue
+        ~DynamicMeshTarget();
+
+        // Bind vertex array object, uploads data if not done yet
+        void bind(const DynamicMeshData& rData);
+
+        // Members
+        GLuint shaderProgram;
+        DeletionQueue* pDeletionQueue;
+        GLuint vertexBuffer;
+        GLuint textureCoordinateBuffer;
+        GLuint vertexArrayObject;
+        bool uploaded;
+        uint uploadedVersion;
+    };
+
+    class DynamicMesh : public ArenaAllocated
+    {
+    public:
+
+        // Constructor
+        DynamicMesh(RenderSnapshot* pRecording, DeletionQueue* pDeletionQueue, Shader const * pShader);
+
+        // Destructor
+        virtual ~DynamicMesh();
+
+        // Set vertices and texture coordinates, which must have same count
+        void setData(std::vector<glm::vec3> vertices, std::vector<glm::vec2> textureCoordinates);
+
+        // Set texture coordinates and keep vertices
+        void setTextureCoordinates(std::vector<glm::vec2> textureCoordinates);
+
+        // Record binding of shader and mesh
+        void bind() const;
+
+        // Record drawing of whole mesh
+        void draw() const;
+
+        // Get count of vertices
+        uint getVertexCount() const;
+
+    private:
+
+        // Members
+        RenderSnapshot* mpRecording;
+        Shader const * mpShader;
+        std::shared_ptr<DynamicMeshTarget> mspTarget;
+        std::shared_ptr<const DynamicMeshData> mspData;
+    };
+}
+
+#endif // DYNAMIC_MESH_H_
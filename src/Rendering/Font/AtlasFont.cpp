@@ -9,6 +9,7 @@
 
 #include "GUI.h"
 #include "src/Utilities/OperationNotifier.h"
+#include "src/Utilities/Tracer.h"
 #include "Defines.h"
 #include <algorithm>
 
@@ -161,37 +162,28 @@ namespace eyegui
 
     void AtlasFont::bindAtlasTexture(FontSize fontSize, uint slot, bool linearFiltering) const
     {
-        // Choose slot
-        glActiveTexture(GL_TEXTURE0 + slot);
-
-        // Bind atlas texture
+        // Choose atlas texture
+        GLuint texture = 0;
         switch (fontSize)
         {
         case FontSize::TALL:
-            glBindTexture(GL_TEXTURE_2D, mTallTexture);
+            texture = mTallTexture;
             break;
         case FontSize::MEDIUM:
-            glBindTexture(GL_TEXTURE_2D, mMediumTexture);
+            texture = mMediumTexture;
             break;
         case FontSize::SMALL:
-            glBindTexture(GL_TEXTURE_2D, mSmallTexture);
+            texture = mSmallTexture;
             break;
         case FontSize::KEYBOARD:
-            glBindTexture(GL_TEXTURE_2D, mKeyboardTexture);
+            texture = mKeyboardTexture;
             break;
         }
 
-        // Set sampling
-        if (linearFiltering)
-        {
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        }
-        else
-        {
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        }
+        // Record binding and sampling
+        RenderSnapshot* pRecording = mpGUI->getRecording();
+        pRecording->bindTexture(slot, texture);
+        pRecording->setTextureFiltering(linearFiltering);
     }
 
     Glyph const * AtlasFont::getGlyph(const std::map<char16_t, Glyph>& rGlyphMap, char16_t character) const
@@ -226,6 +218,8 @@ namespace eyegui
 
     void AtlasFont::fillAtlases()
     {
+        EYEGUI_PROFILE_SCOPE(mpGUI->getProfiler(), ProfilePhase::FONT_ATLAS);
+
         fillAtlas(
             mTallPixelHeight,
             mTallGlyphs,
@@ -259,6 +253,8 @@ namespace eyegui
         GLuint textureHandle,
         int padding)
     {
+        EYEGUI_TRACE_SCOPE("AtlasFont::fillAtlas", mFilepath + ", pixel height: " + std::to_string(pixelHeight));
+
         // Some typedef, keeps track of combination of each glyph and its bitmap
         typedef std::pair<Glyph*, std::vector<unsigned char> > glyphBitmapPair;
 
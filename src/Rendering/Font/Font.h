@@ -46,7 +46,7 @@ namespace eyegui
         // Get target glyph height
         virtual float getTargetGlyphHeight(FontSize fontSize) const = 0;
 
-        // Bind atlas texture of font
+        // Record binding of atlas texture of font
         virtual void bindAtlasTexture(FontSize fontSize, uint slot = 0, bool linearFiltering = false) const = 0;
     };
 }
@@ -0,0 +1,237 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "FrameCapturer.h"
+
+#include "src/Utilities/OperationNotifier.h"
+
+#include <cstring>
+
+namespace eyegui
+{
+    FrameCapturer::FrameCapturer()
+    {
+        // Initialize members
+        mFramebuffer = 0;
+        mColorRenderbuffer = 0;
+        mWidth = 0;
+        mHeight = 0;
+        mPreviousDrawFramebuffer = 0;
+        mPreviousReadFramebuffer = 0;
+        for (Readback& rReadback : mReadbacks)
+        {
+            rReadback.pixelBuffer = 0;
+            rReadback.fence = 0;
+            rReadback.width = 0;
+            rReadback.height = 0;
+            rReadback.sequence = 0;
+        }
+        mNextReadback = 0;
+        mSequence = 0;
+    }
+
+    FrameCapturer::~FrameCapturer()
+    {
+        for (Readback& rReadback : mReadbacks)
+        {
+            discard(rReadback);
+            if (rReadback.pixelBuffer != 0)
+            {
+                glDeleteBuffers(1, &rReadback.pixelBuffer);
+            }
+        }
+        deleteFramebuffer();
+    }
+
+    void FrameCapturer::begin(int width, int height)
+    {
+        // Remember framebuffer of application
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &mPreviousDrawFramebuffer);
+        glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &mPreviousReadFramebuffer);
+
+        // Framebuffer follows size of GUI
+        if (mFramebuffer == 0 || width != mWidth || height != mHeight)
+        {
+            deleteFramebuffer();
+            createFramebuffer(width, height);
+        }
+
+        // Clear to opaque black like a fresh window
+        GLfloat clearColor[4];
+        glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        glClearColor(0, 0, 0, 1);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+    }
+
+    void FrameCapturer::end()
+    {
+        // Oldest readback is overwritten if nobody retrieved it
+        Readback& rReadback = mReadbacks[mNextReadback];
+        mNextReadback = (mNextReadback + 1) % FRAME_CAPTURE_BUFFER_COUNT;
+        discard(rReadback);
+
+        // Remember state of application
+        GLint previousPixelBuffer = 0;
+        GLint previousPackAlignment = 0;
+        glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &previousPixelBuffer);
+        glGetIntegerv(GL_PACK_ALIGNMENT, &previousPackAlignment);
+
+        // Pixel buffer is only reallocated when size changes
+        if (rReadback.pixelBuffer == 0)
+        {
+            glGenBuffers(1, &rReadback.pixelBuffer);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, rReadback.pixelBuffer);
+        if (rReadback.width != mWidth || rReadback.height != mHeight)
+        {
+            glBufferData(GL_PIXEL_PACK_BUFFER, mWidth * mHeight * 4, NULL, GL_STREAM_READ);
+            rReadback.width = mWidth;
+            rReadback.height = mHeight;
+        }
+
+        // Readback into pixel buffer returns immediately
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadBuffer(GL_COLOR_ATTACHMENT0);
+        glReadPixels(0, 0, mWidth, mHeight, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+        rReadback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        rReadback.sequence = ++mSequence;
+
+        // Restore state of application
+        glPixelStorei(GL_PACK_ALIGNMENT, previousPackAlignment);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, previousPixelBuffer);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, mPreviousDrawFramebuffer);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, mPreviousReadFramebuffer);
+    }
+
+    bool FrameCapturer::retrieve(FrameCapture& rCapture, bool wait)
+    {
+        // Go from newest to oldest readback
+        Readback* pReadback = NULL;
+        for (unsigned int i = 0; i < FRAME_CAPTURE_BUFFER_COUNT; i++)
+        {
+            Readback& rReadback = mReadbacks[(mNextReadback + FRAME_CAPTURE_BUFFER_COUNT - 1 - i) % FRAME_CAPTURE_BUFFER_COUNT];
+            if (rReadback.fence == 0)
+            {
+                continue;
+            }
+
+            // Only newest readback is waited for
+            GLenum result = GL_TIMEOUT_EXPIRED;
+            if (wait)
+            {
+                do
+                {
+                    result = glClientWaitSync(rReadback.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+                } while (result == GL_TIMEOUT_EXPIRED);
+            }
+            else
+            {
+                result = glClientWaitSync(rReadback.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+            }
+
+            if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+            {
+                pReadback = &rReadback;
+                break;
+            }
+            else if (wait)
+            {
+                throwWarning(OperationNotifier::Operation::RUNTIME, "Waiting for readback of captured frame failed");
+                return false;
+            }
+        }
+
+        // Nothing completed yet
+        if (pReadback == NULL)
+        {
+            return false;
+        }
+
+        // Map pixel buffer and flip rows, since OpenGL starts at bottom
+        GLint previousPixelBuffer = 0;
+        glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &previousPixelBuffer);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pReadback->pixelBuffer);
+        int rowSize = pReadback->width * 4;
+        unsigned char const * pPixels =
+            (unsigned char const *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, rowSize * pReadback->height, GL_MAP_READ_BIT);
+        bool success = pPixels != NULL;
+        if (success)
+        {
+            rCapture.width = pReadback->width;
+            rCapture.height = pReadback->height;
+            rCapture.pixels.resize(rowSize * pReadback->height);
+            for (int y = 0; y < pReadback->height; y++)
+            {
+                std::memcpy(
+                    rCapture.pixels.data() + y * rowSize,
+                    pPixels + (pReadback->height - 1 - y) * rowSize,
+                    rowSize);
+            }
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        else
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Pixel buffer of captured frame could not be mapped");
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, previousPixelBuffer);
+
+        // Retrieved readback and older ones are not needed anymore
+        unsigned int sequence = pReadback->sequence;
+        for (Readback& rReadback : mReadbacks)
+        {
+            if (rReadback.fence != 0 && rReadback.sequence <= sequence)
+            {
+                discard(rReadback);
+            }
+        }
+
+        return success;
+    }
+
+    void FrameCapturer::createFramebuffer(int width, int height)
+    {
+        // Alpha of a window is not visible and would only depend on blending, so it is not stored
+        glGenRenderbuffers(1, &mColorRenderbuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, mColorRenderbuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGB8, width, height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+        // Stays bound, begin binds it anyway
+        glGenFramebuffers(1, &mFramebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, mColorRenderbuffer);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            throwError(OperationNotifier::Operation::RUNTIME, "Framebuffer for frame capture not complete");
+        }
+
+        mWidth = width;
+        mHeight = height;
+    }
+
+    void FrameCapturer::deleteFramebuffer()
+    {
+        if (mFramebuffer != 0)
+        {
+            glDeleteFramebuffers(1, &mFramebuffer);
+            glDeleteRenderbuffers(1, &mColorRenderbuffer);
+            mFramebuffer = 0;
+            mColorRenderbuffer = 0;
+        }
+    }
+
+    void FrameCapturer::discard(Readback& rReadback)
+    {
+        if (rReadback.fence != 0)
+        {
+            glDeleteSync(rReadback.fence);
+            rReadback.fence = 0;
+        }
+    }
+}
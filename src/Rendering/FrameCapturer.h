@@ -0,0 +1,74 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Captures drawn GUI. Drawing is redirected into an own framebuffer, whose
+// pixels are read into one of some pixel buffers. Fences tell when a readback
+// is complete, so pixels can be mapped later without stalling the pipeline.
+
+#ifndef FRAME_CAPTURER_H_
+#define FRAME_CAPTURER_H_
+
+#include "include/eyeGUI.h"
+#include "src/Defines.h"
+#include "externals/OpenGLLoader/gl_core_3_3.h"
+
+namespace eyegui
+{
+    class FrameCapturer
+    {
+    public:
+
+        // Constructor
+        FrameCapturer();
+
+        // Destructor
+        virtual ~FrameCapturer();
+
+        // Bind and clear framebuffer of given size, previous binding is remembered
+        void begin(int width, int height);
+
+        // Start readback of framebuffer and restore previous binding
+        void end();
+
+        // Copy pixels of newest completed readback into capture. Waits for
+        // newest readback if requested. Returns whether capture was filled
+        bool retrieve(FrameCapture& rCapture, bool wait);
+
+    private:
+
+        // Readback into pixel buffer
+        struct Readback
+        {
+            GLuint pixelBuffer;
+            GLsync fence;
+            int width;
+            int height;
+            unsigned int sequence;
+        };
+
+        // Create framebuffer with given size
+        void createFramebuffer(int width, int height);
+
+        // Delete framebuffer
+        void deleteFramebuffer();
+
+        // Forget readback without reading it
+        void discard(Readback& rReadback);
+
+        // Members
+        GLuint mFramebuffer;
+        GLuint mColorRenderbuffer;
+        int mWidth;
+        int mHeight;
+        GLint mPreviousDrawFramebuffer;
+        GLint mPreviousReadFramebuffer;
+        Readback mReadbacks[FRAME_CAPTURE_BUFFER_COUNT];
+        unsigned int mNextReadback;
+        unsigned int mSequence;
+    };
+}
+
+#endif // FRAME_CAPTURER_H_
@@ -8,7 +8,9 @@
 #include "GazeDrawer.h"
 
 #include "GUI.h"
-#include "externals/GLM/glm/gtc/matrix_transform.hpp"
+#include "src/Defines.h"
+
+#include <algorithm>
 
 namespace eyegui
 {
@@ -17,8 +19,24 @@ namespace eyegui
         // Members
         mpGUI = pGUI;
         mpAssetManager = pAssetManager;
-        mpCircle = mpAssetManager->fetchRenderItem(shaders::Type::CIRCLE, meshes::Type::QUAD);
-        mpLine = mpAssetManager->fetchRenderItem(shaders::Type::COLOR, meshes::Type::LINE);
+        mPoints.resize(GAZE_VISUALIZATION_MAX_POINTS);
+        mFirstPoint = 0;
+        mPointCount = 0;
+        mTime = 0;
+        mInstancesDirty = false;
+        mMinGazePointSize = 0;
+        mMaxGazePointSize = 0;
+
+        // Circles are quads with center and focus, lines are from start to end
+        std::vector<InstanceAttribute> circleAttributes;
+        circleAttributes.push_back({ "pointAttribute", 3 });
+        circleAttributes.push_back({ "ageAttribute", 1 });
+        mupCircles = mpAssetManager->createInstancedMesh(shaders::Type::GAZE_CIRCLE, meshes::Type::QUAD, circleAttributes);
+
+        std::vector<InstanceAttribute> lineAttributes;
+        lineAttributes.push_back({ "lineAttribute", 4 });
+        lineAttributes.push_back({ "ageAttribute", 1 });
+        mupLines = mpAssetManager->createInstancedMesh(shaders::Type::GAZE_LINE, meshes::Type::LINE, lineAttributes);
     }
 
     GazeDrawer::~GazeDrawer()
@@ -47,148 +65,171 @@ namespace eyegui
             mMaxGazePointSize = (int) (maxGazePointRelativeSize * GUIWidth);
         }
 
+        // Advance time, all points but last one fade since they were replaced as last
+        mTime += tpf;
+        mInstancesDirty = true;
+
         // Current point
         GazePoint gazePoint(gazeX, gazeY);
 
         // Decide how to react
-        if (mPoints.empty())
+        if (mPointCount == 0)
         {
             // No points to far, so just add it
-            mPoints.push_back(gazePoint);
+            pushPoint(gazePoint);
         }
-        else if(glm::distance(gazePoint.point, mPoints.back().originalPoint) > calculateDiameterOfGazePoint(mPoints.back()) / 2.0f)
+        else
         {
-            // Add new gaze point to points when distance is bigger than old point's radius
-            if(mPoints.back().focus.getValue() < mpGUI->getConfig()->gazeVisualizationRejectThreshold)
+            GazePoint& rLastPoint = getPoint(mPointCount - 1);
+            if (glm::distance(gazePoint.point, rLastPoint.originalPoint) > calculateDiameterOfGazePoint(rLastPoint) / 2.0f)
             {
-                // Last gaze point was not really a focus, forget it
-                mPoints.back() = gazePoint;
+                // Add new gaze point to points when distance is bigger than old point's radius
+                if (rLastPoint.focus.getValue() < mpGUI->getConfig()->gazeVisualizationRejectThreshold)
+                {
+                    // Last gaze point was not really a focus, forget it
+                    rLastPoint = gazePoint;
+                }
+                else
+                {
+                    // Add as new gaze point, old one has faded already for this frame
+                    rLastPoint.fadeStart = mTime - tpf;
+                    pushPoint(gazePoint);
+                }
             }
             else
             {
-                // Add as new gaze point
-                mPoints.push_back(gazePoint);
+                // Increase focus of last point
+                rLastPoint.focus.update(tpf / mpGUI->getConfig()->gazeVisualizationFocusDuration);
+
+                // Move towards new position along distance vector
+                rLastPoint.point += tpf * (gazePoint.point - rLastPoint.point);
             }
         }
-        else
-        {
-            // Increase focus of last point
-            mPoints.back().focus.update(tpf / mpGUI->getConfig()->gazeVisualizationFocusDuration);
 
-            // Move towards new position along distance vector
-            mPoints.back().point +=  tpf * (gazePoint.point - mPoints.back().point);
+        // Remove faded points, which are the oldest ones
+        float fadeDuration = mpGUI->getConfig()->gazeVisualizationFadeDuration;
+        while (mPointCount > 1 && mTime - getPoint(0).fadeStart >= fadeDuration)
+        {
+            mFirstPoint = (mFirstPoint + 1) % GAZE_VISUALIZATION_MAX_POINTS;
+            mPointCount--;
         }
+    }
 
-        // Decrease alpha of all gaze points but last one
-        int pointsToRemoveIndex = -1;
-        for (uint i = 0; i < mPoints.size() - 1; i++)
+    void GazeDrawer::updateInstances()
+    {
+        if (!mInstancesDirty)
         {
-            mPoints[i].alpha.update(-tpf / mpGUI->getConfig()->gazeVisualizationFadeDuration);
-
-            // Remember which points to remove
-            if (mPoints[i].alpha.getValue() <= 0)
-            {
-                // Override index with higher one
-                pointsToRemoveIndex = i;
-            }
+            return;
         }
-
-        // Remove unnecessary points from vector
-        if (pointsToRemoveIndex >= 0)
+        mInstancesDirty = false;
+
+        // Age of last point stays zero, it does not fade
+        std::vector<float> circleInstances;
+        circleInstances.reserve(mPointCount * 4);
+        std::vector<float> lineInstances;
+        lineInstances.reserve(mPointCount * 5);
+        for (uint i = 0; i < mPointCount; i++)
         {
-            mPoints.erase(mPoints.begin(), mPoints.begin() + pointsToRemoveIndex + 1);
+            const GazePoint& rGazePoint = getPoint(i);
+            float age = (i + 1 < mPointCount) ? (float)(mTime - rGazePoint.fadeStart) : 0.0f;
+            circleInstances.push_back(rGazePoint.point.x);
+            circleInstances.push_back(rGazePoint.point.y);
+            circleInstances.push_back(rGazePoint.focus.getValue());
+            circleInstances.push_back(age);
+
+            // Line to next point fades like its start
+            if (i + 1 < mPointCount)
+            {
+                const GazePoint& rNextPoint = getPoint(i + 1);
+                lineInstances.push_back(rGazePoint.point.x);
+                lineInstances.push_back(rGazePoint.point.y);
+                lineInstances.push_back(rNextPoint.point.x);
+                lineInstances.push_back(rNextPoint.point.y);
+                lineInstances.push_back(age);
+            }
         }
+        mupCircles->setInstances(std::move(circleInstances));
+        mupLines->setInstances(std::move(lineInstances));
     }
 
     void GazeDrawer::draw() const
     {
         // Get values from GUI
-        float GUIWidth = (float)(mpGUI->getWindowWidth());
-        float GUIHeight = (float)(mpGUI->getWindowHeight());
+        glm::vec2 resolution((float)(mpGUI->getWindowWidth()), (float)(mpGUI->getWindowHeight()));
+        glm::vec2 sizes((float)mMinGazePointSize, (float)mMaxGazePointSize);
+        float fadeDuration = mpGUI->getConfig()->gazeVisualizationFadeDuration;
 
         // Draw lines
-        mpLine->bind();
-
-        // Go over connections of gaze points
-        for(uint i = 0; i < mPoints.size() - 1; i++)
-        {
-            // Calculate transformation values
-            glm::vec2 currentPoint = mPoints[i].point;
-            glm::vec2 nextPoint = mPoints[i+1].point;
-            float distance = glm::distance(currentPoint, nextPoint);
-
-            // Matrix
-            glm::mat4 matrix = glm::mat4(1.0f);
-
-            // Translation
-            matrix = glm::translate(
-                matrix,
-                glm::vec3(currentPoint.x / GUIWidth, 1.0f - (currentPoint.y / GUIHeight), 0));
-
-            // Scaling
-            matrix = glm::scale(matrix, glm::vec3(distance / GUIWidth, distance / GUIHeight, 1));
+        mupLines->bind();
+        mupLines->getShader()->fillValue("resolution", resolution);
+        mupLines->getShader()->fillValue("fadeDuration", fadeDuration);
+        mupLines->getShader()->fillValue("color", mpGUI->getConfig()->gazeVisualizationColor);
+        mupLines->draw(GL_LINES);
 
-            // Rotation
-            glm::vec2 vector = nextPoint-currentPoint;
-            float angle = glm::acos(glm::dot(glm::vec2(1,0), vector) / glm::length(vector));
-
-            // Decide direction of rotation
-            if(nextPoint.y > currentPoint.y)
-            {
-                angle = -angle;
-            }
-
-            matrix = glm::rotate(matrix, angle, glm::vec3(0,0,1));
+        // Draw focus cycles
+        mupCircles->bind();
+        mupCircles->getShader()->fillValue("resolution", resolution);
+        mupCircles->getShader()->fillValue("sizes", sizes);
+        mupCircles->getShader()->fillValue("fadeDuration", fadeDuration);
+        mupCircles->getShader()->fillValue("color", mpGUI->getConfig()->gazeVisualizationColor);
+        mupCircles->draw();
+    }
 
-            // Projection
-            matrix = glm::ortho(0.0f, 1.0f, 0.0f, 1.0f) * matrix;
+    void GazeDrawer::reset()
+    {
+        mFirstPoint = 0;
+        mPointCount = 0;
+        mInstancesDirty = true;
+    }
 
-            mpLine->getShader()->fillValue("matrix", matrix);
-            mpLine->getShader()->fillValue("color", mpGUI->getConfig()->gazeVisualizationColor);
-            mpLine->getShader()->fillValue("alpha", mPoints[i].alpha.getValue());
-            mpLine->draw(GL_LINES);
+    DamageRect GazeDrawer::getBounds() const
+    {
+        DamageRect bounds;
+        if (mPointCount == 0)
+        {
+            return bounds;
         }
 
-        // Draw focus cycles
-        mpCircle->bind();
-
-        // Draw all circles
-        for (const GazePoint& rGazePoint : mPoints)
+        // Lines connect points, so circles cover everything
+        int minX = 0, minY = 0, maxX = 0, maxY = 0;
+        for (uint i = 0; i < mPointCount; i++)
         {
-            // Width and height
-            int diameter = calculateDiameterOfGazePoint(rGazePoint);
-            float glWidth = diameter / GUIWidth;
-            float glHeight = diameter / GUIHeight;
-
-            // New matrix
-            glm::mat4 matrix = glm::mat4(1.0f);
-
-            // Translation
-            matrix = glm::translate(
-                matrix,
-                glm::vec3((rGazePoint.point.x - diameter / 2) / GUIWidth,
-                    (1.0f - ((rGazePoint.point.y - diameter / 2) / GUIHeight)) - glHeight,
-                    0));
-
-            // Scaling
-            matrix = glm::scale(matrix, glm::vec3(glWidth, glHeight, 1));
-
-            // Projection
-            matrix = glm::ortho(0.0f, 1.0f, 0.0f, 1.0f) * matrix;
-
-            // Set values
-            mpCircle->getShader()->fillValue("matrix", matrix);
-            mpCircle->getShader()->fillValue("color", mpGUI->getConfig()->gazeVisualizationColor);
-            mpCircle->getShader()->fillValue("alpha", rGazePoint.alpha.getValue());
-
-            // Draw
-            mpCircle->draw();
+            const GazePoint& rGazePoint = getPoint(i);
+            int radius = calculateDiameterOfGazePoint(rGazePoint) / 2 + 1;
+            int x = (int)rGazePoint.point.x;
+            int y = (int)rGazePoint.point.y;
+            minX = (i == 0) ? x - radius : std::min(minX, x - radius);
+            minY = (i == 0) ? y - radius : std::min(minY, y - radius);
+            maxX = (i == 0) ? x + radius : std::max(maxX, x + radius);
+            maxY = (i == 0) ? y + radius : std::max(maxY, y + radius);
         }
+        bounds.x = minX;
+        bounds.y = minY;
+        bounds.width = maxX - minX + 1;
+        bounds.height = maxY - minY + 1;
+        return bounds;
     }
 
-    void GazeDrawer::reset()
+    GazeDrawer::GazePoint& GazeDrawer::getPoint(uint index)
+    {
+        return mPoints[(mFirstPoint + index) % GAZE_VISUALIZATION_MAX_POINTS];
+    }
+
+    const GazeDrawer::GazePoint& GazeDrawer::getPoint(uint index) const
     {
-        mPoints.clear();
+        return mPoints[(mFirstPoint + index) % GAZE_VISUALIZATION_MAX_POINTS];
+    }
+
+    void GazeDrawer::pushPoint(const GazePoint& rGazePoint)
+    {
+        // Drop oldest point when buffer is full
+        if (mPointCount == GAZE_VISUALIZATION_MAX_POINTS)
+        {
+            mFirstPoint = (mFirstPoint + 1) % GAZE_VISUALIZATION_MAX_POINTS;
+            mPointCount--;
+        }
+        mPoints[(mFirstPoint + mPointCount) % GAZE_VISUALIZATION_MAX_POINTS] = rGazePoint;
+        mPointCount++;
     }
 
     int GazeDrawer::calculateDiameterOfGazePoint(const GazePoint& rGazePoint) const
@@ -4,7 +4,9 @@
 //============================================================================
 
 // Author: Raphael Menges (https://github.com/raphaelmenges)
-// Visualizes gaze.
+// Visualizes gaze. Points of trail are kept in ring buffer of fixed capacity.
+// Trail is drawn by one instanced draw for lines and one for circles, alpha
+// and size of each point are computed in the vertex shaders.
 
 #ifndef GAZE_DRAWER_H_
 #define GAZE_DRAWER_H_
@@ -13,6 +15,7 @@
 #include "src/Utilities/LerpValue.h"
 #include "externals/GLM/glm/glm.hpp"
 
+#include <memory>
 #include <vector>
 
 namespace eyegui
@@ -33,12 +36,18 @@ namespace eyegui
         // Update
         void update(int gazeX, int gazeY, float tpf);
 
+        // Fill instances of lines and circles, if points changed since last call
+        void updateInstances();
+
         // Draw
         void draw() const;
 
         // Reset
         void reset();
 
+        // Get area covered by drawn points and lines, empty if nothing is drawn
+        DamageRect getBounds() const;
+
     private:
 
         // Structure for gaze points
@@ -46,30 +55,44 @@ namespace eyegui
         {
             glm::vec2 point; // Easier to handle than ivec2
             glm::vec2 originalPoint;
-            LerpValue alpha;
+            double fadeStart; // Time when point stopped being last one
             LerpValue focus;
 
+            // Default constructor for ring buffer
+            GazePoint() : GazePoint(0, 0) {}
+
             // Constructor
             GazePoint(int gazeX, int gazeY)
             {
                 point.x = (float)gazeX;
                 point.y = (float)gazeY;
                 originalPoint = point; // Save original position
-                alpha.setValue(1);
+                fadeStart = 0;
                 focus.setValue(0);
 
             }
         };
 
+        // Get point by index, starting at oldest one
+        GazePoint& getPoint(uint index);
+        const GazePoint& getPoint(uint index) const;
+
+        // Add point at end, oldest point is dropped when buffer is full
+        void pushPoint(const GazePoint& rGazePoint);
+
         // Calculate pixel diameter of gaze point
         int calculateDiameterOfGazePoint(const GazePoint& rGazePoint) const;
 
         // Members
         GUI const * mpGUI;
         AssetManager* mpAssetManager;
-        std::vector<GazePoint> mPoints;
-        RenderItem const * mpCircle;
-        RenderItem const * mpLine;
+        std::vector<GazePoint> mPoints; // ring buffer
+        uint mFirstPoint;
+        uint mPointCount;
+        double mTime;
+        bool mInstancesDirty;
+        std::unique_ptr<InstancedMesh> mupCircles;
+        std::unique_ptr<InstancedMesh> mupLines;
         int mMinGazePointSize;
         int mMaxGazePointSize;
     };
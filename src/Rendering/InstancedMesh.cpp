@@ -0,0 +1,163 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "InstancedMesh.h"
+
+#include <algorithm>
+
+namespace eyegui
+{
+    InstancedMeshTarget::InstancedMeshTarget(GLuint shaderProgram, Mesh const * pMesh, std::vector<InstanceAttribute> attributes, DeletionQueue* pDeletionQueue)
+    {
+        // Objects are created at first binding
+        this->shaderProgram = shaderProgram;
+        this->pMesh = pMesh;
+        this->attributes = attributes;
+        this->pDeletionQueue = pDeletionQueue;
+        instanceBuffer = 0;
+        vertexArrayObject = 0;
+        instanceBufferSize = 0;
+        uploaded = false;
+        uploadedVersion = 0;
+    }
+
+    InstancedMeshTarget::~InstancedMeshTarget()
+    {
+        // Last snapshot using the mesh may be released by any thread
+        pDeletionQueue->deleteVertexArray(vertexArrayObject);
+        pDeletionQueue->deleteBuffer(instanceBuffer);
+    }
+
+    void InstancedMeshTarget::bind(const InstanceData& rData)
+    {
+        // Binding of array buffer is not part of vertex array object
+        GLint oldBuffer = -1;
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
+
+        if (vertexArrayObject == 0)
+        {
+            glGenBuffers(1, &instanceBuffer);
+            glGenVertexArrays(1, &vertexArrayObject);
+            glBindVertexArray(vertexArrayObject);
+
+            // Vertices of mesh
+            GLuint vertexAttrib = glGetAttribLocation(shaderProgram, "posAttribute");
+            glEnableVertexAttribArray(vertexAttrib);
+            glBindBuffer(GL_ARRAY_BUFFER, pMesh->getVertexBuffer());
+            glVertexAttribPointer(vertexAttrib, 3, GL_FLOAT, GL_FALSE, 0, NULL);
+
+            // Texture coordinates of mesh
+            GLuint uvAttrib = glGetAttribLocation(shaderProgram, "uvAttribute");
+            glEnableVertexAttribArray(uvAttrib);
+            glBindBuffer(GL_ARRAY_BUFFER, pMesh->getTextureCoordinateBuffer());
+            glVertexAttribPointer(uvAttrib, 2, GL_FLOAT, GL_FALSE, 0, NULL);
+
+            // Attributes of instances are interleaved in one buffer
+            GLsizei stride = 0;
+            for (const InstanceAttribute& rAttribute : attributes)
+            {
+                stride += rAttribute.componentCount * sizeof(float);
+            }
+            glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+            size_t offset = 0;
+            for (const InstanceAttribute& rAttribute : attributes)
+            {
+                // Matrix occupies one location per column
+                GLuint location = glGetAttribLocation(shaderProgram, rAttribute.name.c_str());
+                int locationCount = (rAttribute.componentCount + 3) / 4;
+                for (int i = 0; i < locationCount; i++)
+                {
+                    int componentCount = std::min(4, rAttribute.componentCount - (i * 4));
+                    glEnableVertexAttribArray(location + i);
+                    glVertexAttribPointer(location + i, componentCount, GL_FLOAT, GL_FALSE, stride, (void const *)offset);
+                    glVertexAttribDivisor(location + i, 1);
+                    offset += componentCount * sizeof(float);
+                }
+            }
+        }
+        else
+        {
+            glBindVertexArray(vertexArrayObject);
+        }
+
+        // Snapshots are executed in order, so other version is always newer
+        if (!uploaded || uploadedVersion != rData.version)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+            size_t size = rData.values.size() * sizeof(float);
+            if (size > instanceBufferSize)
+            {
+                glBufferData(GL_ARRAY_BUFFER, size, rData.values.data(), GL_STREAM_DRAW);
+                instanceBufferSize = size;
+            }
+            else if (size > 0)
+            {
+                glBufferSubData(GL_ARRAY_BUFFER, 0, size, rData.values.data());
+            }
+            uploaded = true;
+            uploadedVersion = rData.version;
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
+    }
+
+    InstancedMesh::InstancedMesh(RenderSnapshot* pRecording, DeletionQueue* pDeletionQueue, Shader const * pShader, Mesh const * pMesh, std::vector<InstanceAttribute> attributes)
+    {
+        // Fill members
+        mpRecording = pRecording;
+        mpShader = pShader;
+        mpMesh = pMesh;
+        mValuesPerInstance = 0;
+        for (const InstanceAttribute& rAttribute : attributes)
+        {
+            mValuesPerInstance += rAttribute.componentCount;
+        }
+        mspTarget = std::shared_ptr<InstancedMeshTarget>(new InstancedMeshTarget(mpShader->getShaderProgram(), mpMesh, attributes, pDeletionQueue));
+        mspData = std::shared_ptr<const InstanceData>(new InstanceData());
+    }
+
+    InstancedMesh::~InstancedMesh()
+    {
+        // Target is released by last snapshot using it
+    }
+
+    void InstancedMesh::setInstances(std::vector<float> values)
+    {
+        // Snapshots keep values they were recorded with
+        std::shared_ptr<InstanceData> spData = std::shared_ptr<InstanceData>(new InstanceData());
+        spData->count = mValuesPerInstance > 0 ? (uint)values.size() / mValuesPerInstance : 0;
+        spData->values = std::move(values);
+        spData->version = mspData->version + 1;
+        mspData = spData;
+    }
+
+    void InstancedMesh::bind() const
+    {
+        mpShader->bind();
+        mpRecording->bindInstancedMesh(mspTarget, mspData);
+    }
+
+    void InstancedMesh::draw(GLenum mode) const
+    {
+        mpRecording->drawArraysInstanced(mode, (GLsizei)mpMesh->getVertexCount(), (GLsizei)mspData->count);
+    }
+
+    uint InstancedMesh::getInstanceCount() const
+    {
+        return mspData->count;
+    }
+
+    uint InstancedMesh::getValueCount() const
+    {
+        return (uint)mspData->values.size();
+    }
+
+    Shader const * InstancedMesh::getShader() const
+    {
+        return mpShader;
+    }
+}
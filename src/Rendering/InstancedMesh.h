@@ -0,0 +1,108 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Mesh drawn many times by one call, like the keys of a keyboard. Each
+// instance has own values for the attributes given at construction. Values
+// are set while updating and kept immutable afterwards like the data of
+// dynamic meshes. Instance buffer and vertex array object are created and
+// filled by the thread executing the snapshot, right before the mesh is used.
+
+#ifndef INSTANCED_MESH_H_
+#define INSTANCED_MESH_H_
+
+#include "Shader.h"
+#include "Mesh.h"
+#include "RenderSnapshot.h"
+#include "DeletionQueue.h"
+#include "src/Utilities/ElementArena.h"
+#include "externals/OpenGLLoader/gl_core_3_3.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eyegui
+{
+    // Attribute of shader with value per instance. Matrices have sixteen components
+    struct InstanceAttribute
+    {
+        std::string name;
+        int componentCount;
+    };
+
+    // Values of all instances at some point of time
+    struct InstanceData
+    {
+        std::vector<float> values;
+        uint count = 0;
+        uint version = 0;
+    };
+
+    // OpenGL objects of mesh, only used by thread executing snapshots
+    struct InstancedMeshTarget
+    {
+        // Constructor
+        InstancedMeshTarget(GLuint shaderProgram, Mesh const * pMesh, std::vector<InstanceAttribute> attributes, DeletionQueue* pDeletionQueue);
+
+        // Destructor, gives objects to deletion queue
+        ~InstancedMeshTarget();
+
+        // Bind vertex array object, uploads instances if not done yet
+        void bind(const InstanceData& rData);
+
+        // Members
+        GLuint shaderProgram;
+        Mesh const * pMesh;
+        std::vector<InstanceAttribute> attributes;
+        DeletionQueue* pDeletionQueue;
+        GLuint instanceBuffer;
+        GLuint vertexArrayObject;
+        size_t instanceBufferSize;
+        bool uploaded;
+        uint uploadedVersion;
+    };
+
+    class InstancedMesh : public ArenaAllocated
+    {
+    public:
+
+        // Constructor
+        InstancedMesh(RenderSnapshot* pRecording, DeletionQueue* pDeletionQueue, Shader const * pShader, Mesh const * pMesh, std::vector<InstanceAttribute> attributes);
+
+        // Destructor
+        virtual ~InstancedMesh();
+
+        // Set values of instances, ordered like attributes
+        void setInstances(std::vector<float> values);
+
+        // Record binding of shader and mesh
+        void bind() const;
+
+        // Record drawing of all instances
+        void draw(GLenum mode = GL_TRIANGLES) const;
+
+        // Get count of instances
+        uint getInstanceCount() const;
+
+        // Get count of values of all instances
+        uint getValueCount() const;
+
+        // Get shader
+        Shader const * getShader() const;
+
+    private:
+
+        // Members
+        RenderSnapshot* mpRecording;
+        Shader const * mpShader;
+        Mesh const * mpMesh;
+        uint mValuesPerInstance;
+        std::shared_ptr<InstancedMeshTarget> mspTarget;
+        std::shared_ptr<const InstanceData> mspData;
+    };
+}
+
+#endif // INSTANCED_MESH_H_
@@ -0,0 +1,214 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "Layer.h"
+
+#include "src/Utilities/Helper.h"
+#include "src/Utilities/OperationNotifier.h"
+
+#include <algorithm>
+
+namespace eyegui
+{
+    Layer::Layer(AssetManager* pAssetManager)
+    {
+        // Initialize members
+        mpComposition = pAssetManager->fetchRenderItem(shaders::Type::LAYER, meshes::Type::QUAD);
+        mpRecording = pAssetManager->getRecording();
+        mpDeletionQueue = pAssetManager->getDeletionQueue();
+        mspTarget = NULL;
+        mLayoutWidth = 0;
+        mLayoutHeight = 0;
+        mX = 0;
+        mY = 0;
+        mWidth = 0;
+        mHeight = 0;
+        mDirty = true;
+    }
+
+    Layer::~Layer()
+    {
+        // Target is released by last snapshot using it
+    }
+
+    void Layer::begin(int layoutWidth, int layoutHeight, int x, int y, int width, int height)
+    {
+        // Texture is only recreated when size changes
+        width = std::max(width, 1);
+        height = std::max(height, 1);
+        if (mspTarget == NULL || width != mWidth || height != mHeight)
+        {
+            mspTarget = std::shared_ptr<Target>(new Target(width, height, mpDeletionQueue));
+            mWidth = width;
+            mHeight = height;
+            mDirty = true;
+        }
+        mLayoutWidth = layoutWidth;
+        mLayoutHeight = layoutHeight;
+        mX = x;
+        mY = y;
+
+        // Target is kept alive by snapshot
+        std::shared_ptr<Target> spTarget = mspTarget;
+        mpRecording->call([spTarget, layoutWidth, layoutHeight, x, y]()
+        {
+            spTarget->begin(layoutWidth, layoutHeight, x, y);
+        });
+    }
+
+    void Layer::end()
+    {
+        std::shared_ptr<Target> spTarget = mspTarget;
+        mpRecording->call([spTarget]()
+        {
+            spTarget->end();
+        });
+        mDirty = false;
+    }
+
+    bool Layer::draw(int x, int y, int width, int height) const
+    {
+        // Area must be covered by up to date layer
+        if (mspTarget == NULL || mDirty
+            || x < mX || y < mY || x + width > mX + mWidth || y + height > mY + mHeight)
+        {
+            return false;
+        }
+        if (width <= 0 || height <= 0)
+        {
+            return true;
+        }
+
+        // Texture starts at bottom
+        mpComposition->bind();
+        std::shared_ptr<Target> spTarget = mspTarget;
+        mpRecording->call([spTarget]()
+        {
+            spTarget->bindTexture();
+        });
+        mpComposition->getShader()->fillValue("matrix", calculateDrawMatrix(mLayoutWidth, mLayoutHeight, x, y, width, height));
+        mpComposition->getShader()->fillValue(
+            "uvOffset",
+            glm::vec2((float)(x - mX) / (float)mWidth, (float)(mY + mHeight - y - height) / (float)mHeight));
+        mpComposition->getShader()->fillValue(
+            "uvScale",
+            glm::vec2((float)width / (float)mWidth, (float)height / (float)mHeight));
+
+        // Colors in layer are already multiplied with alpha
+        mpRecording->blendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        mpComposition->draw();
+        mpRecording->blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        return true;
+    }
+
+    void Layer::invalidate()
+    {
+        mDirty = true;
+    }
+
+    bool Layer::isDirty() const
+    {
+        return mDirty;
+    }
+
+    bool Layer::covers(int layoutWidth, int layoutHeight, int x, int y, int width, int height) const
+    {
+        return mspTarget != NULL
+            && layoutWidth == mLayoutWidth
+            && layoutHeight == mLayoutHeight
+            && x == mX
+            && y == mY
+            && std::max(width, 1) == mWidth
+            && std::max(height, 1) == mHeight;
+    }
+
+    Layer::Target::Target(int width, int height, DeletionQueue* pDeletionQueue)
+    {
+        // Objects are created at first usage
+        this->pDeletionQueue = pDeletionQueue;
+        this->width = width;
+        this->height = height;
+        framebuffer = 0;
+        texture = 0;
+        previousFramebuffer = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            previousViewport[i] = 0;
+            previousClearColor[i] = 0;
+        }
+        previousScissorTest = GL_FALSE;
+    }
+
+    Layer::Target::~Target()
+    {
+        // Last snapshot using the layer may be released by any thread
+        pDeletionQueue->deleteFramebuffer(framebuffer);
+        pDeletionQueue->deleteTexture(texture);
+    }
+
+    void Layer::Target::begin(int layoutWidth, int layoutHeight, int x, int y)
+    {
+        // Remember state of GUI drawing
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousFramebuffer);
+        glGetIntegerv(GL_VIEWPORT, previousViewport);
+        glGetBooleanv(GL_SCISSOR_TEST, &previousScissorTest);
+
+        if (framebuffer == 0)
+        {
+            // Nearest filtering, since texels match pixels
+            glGenTextures(1, &texture);
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glBindTexture(GL_TEXTURE_2D, 0);
+
+            glGenFramebuffers(1, &framebuffer);
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+            glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+            if (glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+            {
+                throwError(OperationNotifier::Operation::RUNTIME, "Framebuffer of layer not complete");
+            }
+        }
+
+        // Viewport is moved, so that elements keep their matrices. Partial
+        // redraw of screen must not restrict drawing into layer
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+        glDisable(GL_SCISSOR_TEST);
+        glViewport(-x, -(layoutHeight - y - height), layoutWidth, layoutHeight);
+        glGetFloatv(GL_COLOR_CLEAR_VALUE, previousClearColor);
+        glClearColor(0, 0, 0, 0);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glClearColor(previousClearColor[0], previousClearColor[1], previousClearColor[2], previousClearColor[3]);
+
+        // Alpha of layer is coverage of elements, which composes their colors
+        // correctly. Screen uses alpha of elements as factor for its own alpha
+        // instead, which is not reproduced, but neither visible nor captured
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    }
+
+    void Layer::Target::end()
+    {
+        // Restore state of GUI drawing
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, previousFramebuffer);
+        glViewport(previousViewport[0], previousViewport[1], previousViewport[2], previousViewport[3]);
+        if (previousScissorTest)
+        {
+            glEnable(GL_SCISSOR_TEST);
+        }
+    }
+
+    void Layer::Target::bindTexture() const
+    {
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, texture);
+    }
+}
@@ -0,0 +1,100 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Texture covering an area of the layout, into which static elements are
+// drawn once. Colors are stored multiplied with alpha, so composing areas of
+// the layer later on gives the same colors as drawing the elements directly.
+// Alpha of the screen differs, since the screen blends it with itself.
+// Framebuffer and texture are owned by a target, which is shared with the
+// render snapshots using it and created while executing them.
+
+#ifndef LAYER_H_
+#define LAYER_H_
+
+#include "AssetManager.h"
+#include "externals/OpenGLLoader/gl_core_3_3.h"
+
+#include <memory>
+
+namespace eyegui
+{
+    class Layer
+    {
+    public:
+
+        // Constructor
+        Layer(AssetManager* pAssetManager);
+
+        // Destructor
+        virtual ~Layer();
+
+        // Record binding and clearing of framebuffer of layer, which covers
+        // given area of layout. Drawing is redirected into layer until end
+        void begin(int layoutWidth, int layoutHeight, int x, int y, int width, int height);
+
+        // Record restoring of previous framebuffer and mark layer as up to date
+        void end();
+
+        // Record composing area of layout from layer, returns false if area is not covered
+        bool draw(int x, int y, int width, int height) const;
+
+        // Content of layer has to be drawn again
+        void invalidate();
+
+        // Whether content of layer has to be drawn again
+        bool isDirty() const;
+
+        // Whether layer covers given area of layout
+        bool covers(int layoutWidth, int layoutHeight, int x, int y, int width, int height) const;
+
+    private:
+
+        // OpenGL objects of layer, only used while executing snapshots
+        struct Target
+        {
+            // Constructor
+            Target(int width, int height, DeletionQueue* pDeletionQueue);
+
+            // Destructor, gives objects to deletion queue
+            ~Target();
+
+            // Bind and clear framebuffer, created at first usage
+            void begin(int layoutWidth, int layoutHeight, int x, int y);
+
+            // Restore previous framebuffer
+            void end();
+
+            // Bind texture to first slot
+            void bindTexture() const;
+
+            // Members
+            DeletionQueue* pDeletionQueue;
+            int width;
+            int height;
+            GLuint framebuffer;
+            GLuint texture;
+            GLint previousFramebuffer;
+            GLint previousViewport[4];
+            GLfloat previousClearColor[4];
+            GLboolean previousScissorTest;
+        };
+
+        // Members
+        RenderItem const * mpComposition;
+        RenderSnapshot* mpRecording;
+        DeletionQueue* mpDeletionQueue;
+        std::shared_ptr<Target> mspTarget;
+        int mLayoutWidth;
+        int mLayoutHeight;
+        int mX;
+        int mY;
+        int mWidth;
+        int mHeight;
+        bool mDirty;
+    };
+}
+
+#endif // LAYER_H_
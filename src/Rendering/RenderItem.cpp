@@ -15,17 +15,45 @@ namespace eyegui
         mpShader = pShader;
         mpMesh = pMesh;
 
-        // Save currently set buffer and vertex array object
-        GLint oldBuffer = -1;
-        GLint oldVAO = -1;
-        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
-        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVAO);
+        // Vertex array object is created at first binding
+        mVertexArrayObject = 0;
+    }
+
+    RenderItem::~RenderItem()
+    {
+        if (mVertexArrayObject != 0)
+        {
+            glDeleteVertexArrays(1, &mVertexArrayObject);
+        }
+    }
+
+    void RenderItem::bind() const
+    {
+        mpShader->bind();
+        mpShader->getRecording()->bindRenderItem(this);
+    }
+
+    void RenderItem::draw(GLenum mode) const
+    {
+        mpShader->getRecording()->drawArrays(mode, mpMesh->getVertexCount());
+    }
+
+    void RenderItem::bindVertexArray() const
+    {
+        if (mVertexArrayObject != 0)
+        {
+            glBindVertexArray(mVertexArrayObject);
+            return;
+        }
 
         // Vertex array object
-        mVertexArrayObject = 0;
         glGenVertexArrays(1, &mVertexArrayObject);
         glBindVertexArray(mVertexArrayObject);
 
+        // Binding of array buffer is not part of vertex array object
+        GLint oldBuffer = -1;
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &oldBuffer);
+
         // Vertices
         GLuint vertexAttrib = glGetAttribLocation(mpShader->getShaderProgram(), "posAttribute");
         glEnableVertexAttribArray(vertexAttrib);
@@ -38,25 +66,8 @@ namespace eyegui
         glBindBuffer(GL_ARRAY_BUFFER, mpMesh->getTextureCoordinateBuffer());
         glVertexAttribPointer(uvAttrib, 2, GL_FLOAT, GL_FALSE, 0, NULL);
 
-        // Restore old settings
+        // Restore old setting
         glBindBuffer(GL_ARRAY_BUFFER, oldBuffer);
-        glBindVertexArray(oldVAO);
-    }
-
-    RenderItem::~RenderItem()
-    {
-        glDeleteVertexArrays(1, &mVertexArrayObject);
-    }
-
-    void RenderItem::bind() const
-    {
-        mpShader->bind();
-        glBindVertexArray(mVertexArrayObject);
-    }
-
-    void RenderItem::draw(GLenum mode) const
-    {
-        glDrawArrays(mode, 0, mpMesh->getVertexCount());
     }
 
     Shader const * RenderItem::getShader() const
@@ -6,6 +6,8 @@
 // Author: Raphael Menges (https://github.com/raphaelmenges)
 // Encapsulation of the OpenGL vertex array object creation and usage. Forms
 // pair of shader and mesh and binds shader and vertex array object at once.
+// Vertex array objects are not shared between contexts, so it is created by
+// the context executing the render snapshot.
 
 #ifndef RENDER_ITEM_H_
 #define RENDER_ITEM_H_
@@ -26,12 +28,15 @@ namespace eyegui
         // Destructor
         virtual ~RenderItem();
 
-        // Bind whole render item (must used before filling values in shader and drawing)
+        // Record binding of whole render item (must used before filling values in shader and drawing)
         void bind() const;
 
-        // Draw
+        // Record drawing
         void draw(GLenum mode = GL_TRIANGLES) const;
 
+        // Bind vertex array object, called while executing render snapshot
+        void bindVertexArray() const;
+
         // Get pointer to shader
         Shader const * getShader() const;
 
@@ -43,7 +48,7 @@ namespace eyegui
         // Member
         Shader const * mpShader;
         Mesh const * mpMesh;
-        GLuint mVertexArrayObject;
+        mutable GLuint mVertexArrayObject;
     };
 }
 
@@ -0,0 +1,332 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "RenderSnapshot.h"
+
+#include "RenderItem.h"
+#include "DynamicMesh.h"
+#include "InstancedMesh.h"
+#include "externals/GLM/glm/gtc/type_ptr.hpp"
+
+namespace eyegui
+{
+    // Name which is never generated by OpenGL
+    const GLuint UNKNOWN_TEXTURE = ~0u;
+
+    RenderSnapshot::RenderSnapshot()
+    {
+        // Initialize members
+        mWindowWidth = 0;
+        mWindowHeight = 0;
+        mFence = NULL;
+    }
+
+    RenderSnapshot::~RenderSnapshot()
+    {
+        clear();
+    }
+
+    void RenderSnapshot::useProgram(GLuint program)
+    {
+        add(CommandType::USE_PROGRAM, (GLint)program);
+    }
+
+    void RenderSnapshot::bindRenderItem(RenderItem const * pRenderItem)
+    {
+        add(CommandType::BIND_RENDER_ITEM, 0, 0, 0, 0, pRenderItem);
+    }
+
+    void RenderSnapshot::bindDynamicMesh(std::shared_ptr<DynamicMeshTarget> spTarget, std::shared_ptr<const DynamicMeshData> spData)
+    {
+        MeshBinding binding;
+        binding.spTarget = spTarget;
+        binding.spData = spData;
+        mMeshBindings.push_back(binding);
+        add(CommandType::BIND_DYNAMIC_MESH, (GLint)mMeshBindings.size() - 1);
+    }
+
+    void RenderSnapshot::bindInstancedMesh(std::shared_ptr<InstancedMeshTarget> spTarget, std::shared_ptr<const InstanceData> spData)
+    {
+        InstanceBinding binding;
+        binding.spTarget = spTarget;
+        binding.spData = spData;
+        mInstanceBindings.push_back(binding);
+        add(CommandType::BIND_INSTANCED_MESH, (GLint)mInstanceBindings.size() - 1);
+    }
+
+    void RenderSnapshot::bindTexture(uint slot, GLuint texture)
+    {
+        add(CommandType::BIND_TEXTURE, (GLint)slot, (GLint)texture);
+    }
+
+    void RenderSnapshot::setTextureFiltering(bool linear)
+    {
+        add(CommandType::TEXTURE_FILTERING, linear ? GL_LINEAR : GL_NEAREST);
+    }
+
+    void RenderSnapshot::fillUniform(GLint location, float value)
+    {
+        addUniform(CommandType::UNIFORM_1F, location, &value, 1);
+    }
+
+    void RenderSnapshot::fillUniform(GLint location, const glm::vec2& rValue)
+    {
+        addUniform(CommandType::UNIFORM_2F, location, glm::value_ptr(rValue), 2);
+    }
+
+    void RenderSnapshot::fillUniform(GLint location, const glm::vec3& rValue)
+    {
+        addUniform(CommandType::UNIFORM_3F, location, glm::value_ptr(rValue), 3);
+    }
+
+    void RenderSnapshot::fillUniform(GLint location, const glm::vec4& rValue)
+    {
+        addUniform(CommandType::UNIFORM_4F, location, glm::value_ptr(rValue), 4);
+    }
+
+    void RenderSnapshot::fillUniform(GLint location, const glm::mat4x4& rValue)
+    {
+        addUniform(CommandType::UNIFORM_MAT4, location, glm::value_ptr(rValue), 16);
+    }
+
+    void RenderSnapshot::drawArrays(GLenum mode, GLsizei count)
+    {
+        // Nothing to draw is skipped already while recording
+        if (count > 0)
+        {
+            add(CommandType::DRAW_ARRAYS, (GLint)mode, (GLint)count);
+        }
+    }
+
+    void RenderSnapshot::drawArraysInstanced(GLenum mode, GLsizei count, GLsizei instanceCount)
+    {
+        if (count > 0 && instanceCount > 0)
+        {
+            add(CommandType::DRAW_ARRAYS_INSTANCED, (GLint)mode, (GLint)count, (GLint)instanceCount);
+        }
+    }
+
+    void RenderSnapshot::blendFunc(GLenum source, GLenum destination)
+    {
+        add(CommandType::BLEND_FUNC, (GLint)source, (GLint)destination);
+    }
+
+    void RenderSnapshot::enableScissor(int x, int y, int width, int height)
+    {
+        add(CommandType::ENABLE_SCISSOR, x, y, width, height);
+    }
+
+    void RenderSnapshot::call(std::function<void()> function)
+    {
+        mCalls.push_back(function);
+        add(CommandType::CALL, (GLint)mCalls.size() - 1);
+    }
+
+    void RenderSnapshot::setWindowSize(int width, int height)
+    {
+        mWindowWidth = width;
+        mWindowHeight = height;
+    }
+
+    int RenderSnapshot::getWindowWidth() const
+    {
+        return mWindowWidth;
+    }
+
+    int RenderSnapshot::getWindowHeight() const
+    {
+        return mWindowHeight;
+    }
+
+    void RenderSnapshot::setDamageRects(std::vector<DamageRect> rects)
+    {
+        mDamageRects = rects;
+    }
+
+    const std::vector<DamageRect>& RenderSnapshot::getDamageRects() const
+    {
+        return mDamageRects;
+    }
+
+    void RenderSnapshot::insertFence()
+    {
+        if (mFence != NULL)
+        {
+            glDeleteSync(mFence);
+        }
+        mFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        // Fence must reach server before other context waits for it
+        glFlush();
+    }
+
+    bool RenderSnapshot::isEmpty() const
+    {
+        return mCommands.empty();
+    }
+
+    void RenderSnapshot::execute() const
+    {
+        // Objects created by recording thread must be ready
+        if (mFence != NULL)
+        {
+            glWaitSync(mFence, 0, GL_TIMEOUT_IGNORED);
+        }
+
+        // Remember bound objects to skip binding them again
+        const uint textureSlotCount = 8;
+        GLuint program = 0;
+        void const * pVertexArray = NULL;
+        GLint activeSlot = -1;
+        GLuint textures[textureSlotCount];
+        for (uint i = 0; i < textureSlotCount; i++)
+        {
+            textures[i] = UNKNOWN_TEXTURE;
+        }
+
+        for (const Command& rCommand : mCommands)
+        {
+            switch (rCommand.type)
+            {
+            case CommandType::USE_PROGRAM:
+                if (program != (GLuint)rCommand.a)
+                {
+                    program = (GLuint)rCommand.a;
+                    glUseProgram(program);
+                }
+                break;
+            case CommandType::BIND_RENDER_ITEM:
+                if (pVertexArray != rCommand.pointer)
+                {
+                    pVertexArray = rCommand.pointer;
+                    static_cast<RenderItem const *>(rCommand.pointer)->bindVertexArray();
+                }
+                break;
+            case CommandType::BIND_DYNAMIC_MESH:
+            {
+                // Data may have changed, so mesh is bound in any case
+                const MeshBinding& rBinding = mMeshBindings[rCommand.a];
+                rBinding.spTarget->bind(*(rBinding.spData));
+                pVertexArray = rBinding.spTarget.get();
+                break;
+            }
+            case CommandType::BIND_INSTANCED_MESH:
+            {
+                // Instances may have changed, so mesh is bound in any case
+                const InstanceBinding& rBinding = mInstanceBindings[rCommand.a];
+                rBinding.spTarget->bind(*(rBinding.spData));
+                pVertexArray = rBinding.spTarget.get();
+                break;
+            }
+            case CommandType::BIND_TEXTURE:
+                if (activeSlot != rCommand.a)
+                {
+                    activeSlot = rCommand.a;
+                    glActiveTexture(GL_TEXTURE0 + activeSlot);
+                }
+                if (rCommand.a >= (GLint)textureSlotCount || textures[rCommand.a] != (GLuint)rCommand.b)
+                {
+                    if (rCommand.a < (GLint)textureSlotCount)
+                    {
+                        textures[rCommand.a] = (GLuint)rCommand.b;
+                    }
+                    glBindTexture(GL_TEXTURE_2D, (GLuint)rCommand.b);
+                }
+                break;
+            case CommandType::TEXTURE_FILTERING:
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, rCommand.a);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, rCommand.a);
+                break;
+            case CommandType::UNIFORM_1F:
+                glUniform1fv(rCommand.a, 1, &mFloats[rCommand.b]);
+                break;
+            case CommandType::UNIFORM_2F:
+                glUniform2fv(rCommand.a, 1, &mFloats[rCommand.b]);
+                break;
+            case CommandType::UNIFORM_3F:
+                glUniform3fv(rCommand.a, 1, &mFloats[rCommand.b]);
+                break;
+            case CommandType::UNIFORM_4F:
+                glUniform4fv(rCommand.a, 1, &mFloats[rCommand.b]);
+                break;
+            case CommandType::UNIFORM_MAT4:
+                glUniformMatrix4fv(rCommand.a, 1, GL_FALSE, &mFloats[rCommand.b]);
+                break;
+            case CommandType::DRAW_ARRAYS:
+                glDrawArrays((GLenum)rCommand.a, 0, (GLsizei)rCommand.b);
+                break;
+            case CommandType::DRAW_ARRAYS_INSTANCED:
+                glDrawArraysInstanced((GLenum)rCommand.a, 0, (GLsizei)rCommand.b, (GLsizei)rCommand.c);
+                break;
+            case CommandType::BLEND_FUNC:
+                glBlendFunc((GLenum)rCommand.a, (GLenum)rCommand.b);
+                break;
+            case CommandType::ENABLE_SCISSOR:
+                glEnable(GL_SCISSOR_TEST);
+                glScissor(rCommand.a, rCommand.b, rCommand.c, rCommand.d);
+                break;
+            case CommandType::CALL:
+                // Call may bind anything, so nothing is known afterwards
+                mCalls[rCommand.a]();
+                program = 0;
+                pVertexArray = NULL;
+                activeSlot = -1;
+                for (uint i = 0; i < textureSlotCount; i++)
+                {
+                    textures[i] = UNKNOWN_TEXTURE;
+                }
+                break;
+            }
+        }
+    }
+
+    void RenderSnapshot::clear()
+    {
+        mCommands.clear();
+        mFloats.clear();
+        mMeshBindings.clear();
+        mInstanceBindings.clear();
+        mCalls.clear();
+        mDamageRects.clear();
+        if (mFence != NULL)
+        {
+            glDeleteSync(mFence);
+            mFence = NULL;
+        }
+    }
+
+    void RenderSnapshot::swap(RenderSnapshot& rOther)
+    {
+        mCommands.swap(rOther.mCommands);
+        mFloats.swap(rOther.mFloats);
+        mMeshBindings.swap(rOther.mMeshBindings);
+        mInstanceBindings.swap(rOther.mInstanceBindings);
+        mCalls.swap(rOther.mCalls);
+        mDamageRects.swap(rOther.mDamageRects);
+        std::swap(mWindowWidth, rOther.mWindowWidth);
+        std::swap(mWindowHeight, rOther.mWindowHeight);
+        std::swap(mFence, rOther.mFence);
+    }
+
+    void RenderSnapshot::add(CommandType type, GLint a, GLint b, GLint c, GLint d, void const * pointer)
+    {
+        Command command;
+        command.type = type;
+        command.a = a;
+        command.b = b;
+        command.c = c;
+        command.d = d;
+        command.pointer = pointer;
+        mCommands.push_back(command);
+    }
+
+    void RenderSnapshot::addUniform(CommandType type, GLint location, float const * pValues, int count)
+    {
+        add(type, location, (GLint)mFloats.size());
+        mFloats.insert(mFloats.end(), pValues, pValues + count);
+    }
+}
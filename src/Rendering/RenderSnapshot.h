@@ -0,0 +1,170 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// List of drawing commands recorded without calling OpenGL. Shaders, render
+// items and textures record into it instead of binding and filling values
+// directly. Executing the list replays the commands, so drawing may be
+// recorded by the thread updating while the previous list is executed by
+// the thread owning the context. Uniform values are copied into the list and
+// meshes changing over time are referenced with their data at recording.
+
+#ifndef RENDER_SNAPSHOT_H_
+#define RENDER_SNAPSHOT_H_
+
+#include "include/eyeGUI.h"
+#include "src/Defines.h"
+#include "externals/OpenGLLoader/gl_core_3_3.h"
+#include "externals/GLM/glm/glm.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace eyegui
+{
+    // Forward declaration
+    class RenderItem;
+    struct DynamicMeshTarget;
+    struct DynamicMeshData;
+    struct InstancedMeshTarget;
+    struct InstanceData;
+
+    class RenderSnapshot
+    {
+    public:
+
+        // Constructor
+        RenderSnapshot();
+
+        // Destructor
+        virtual ~RenderSnapshot();
+
+        // Record usage of shader program
+        void useProgram(GLuint program);
+
+        // Record binding of vertex array object of render item
+        void bindRenderItem(RenderItem const * pRenderItem);
+
+        // Record binding of dynamic mesh, data is uploaded before first usage
+        void bindDynamicMesh(std::shared_ptr<DynamicMeshTarget> spTarget, std::shared_ptr<const DynamicMeshData> spData);
+
+        // Record binding of instanced mesh, instances are uploaded before first usage
+        void bindInstancedMesh(std::shared_ptr<InstancedMeshTarget> spTarget, std::shared_ptr<const InstanceData> spData);
+
+        // Record binding of texture to slot
+        void bindTexture(uint slot, GLuint texture);
+
+        // Record filtering of currently bound texture
+        void setTextureFiltering(bool linear);
+
+        // Record filling of uniform at location of current program
+        void fillUniform(GLint location, float value);
+        void fillUniform(GLint location, const glm::vec2& rValue);
+        void fillUniform(GLint location, const glm::vec3& rValue);
+        void fillUniform(GLint location, const glm::vec4& rValue);
+        void fillUniform(GLint location, const glm::mat4x4& rValue);
+
+        // Record drawing of bound vertex array object
+        void drawArrays(GLenum mode, GLsizei count);
+
+        // Record drawing of instances of bound vertex array object
+        void drawArraysInstanced(GLenum mode, GLsizei count, GLsizei instanceCount);
+
+        // Record change of blending function
+        void blendFunc(GLenum source, GLenum destination);
+
+        // Record restriction of drawing to area in OpenGL coordinates, which
+        // lasts until end of execution
+        void enableScissor(int x, int y, int width, int height);
+
+        // Record call, which is executed at its place in the list. Used for
+        // things which cannot be expressed by the commands above
+        void call(std::function<void()> function);
+
+        // Set size of window at recording
+        void setWindowSize(int width, int height);
+
+        // Getter for window size at recording
+        int getWindowWidth() const;
+        int getWindowHeight() const;
+
+        // Set areas drawn by this snapshot
+        void setDamageRects(std::vector<DamageRect> rects);
+
+        // Get areas drawn by this snapshot
+        const std::vector<DamageRect>& getDamageRects() const;
+
+        // Insert fence after commands of recording thread, which created
+        // objects used by the snapshot. Execution waits for it
+        void insertFence();
+
+        // Whether nothing is recorded
+        bool isEmpty() const;
+
+        // Execute recorded commands, context must be current
+        void execute() const;
+
+        // Forget recorded commands and release referenced meshes
+        void clear();
+
+        // Exchange content with other snapshot
+        void swap(RenderSnapshot& rOther);
+
+    private:
+
+        // Types of commands
+        enum class CommandType
+        {
+            USE_PROGRAM, BIND_RENDER_ITEM, BIND_DYNAMIC_MESH, BIND_INSTANCED_MESH, BIND_TEXTURE, TEXTURE_FILTERING,
+            UNIFORM_1F, UNIFORM_2F, UNIFORM_3F, UNIFORM_4F, UNIFORM_MAT4,
+            DRAW_ARRAYS, DRAW_ARRAYS_INSTANCED, BLEND_FUNC, ENABLE_SCISSOR, CALL
+        };
+
+        // Single command, meaning of values depends on type
+        struct Command
+        {
+            CommandType type;
+            GLint a;
+            GLint b;
+            GLint c;
+            GLint d;
+            void const * pointer;
+        };
+
+        // Dynamic mesh with data at recording
+        struct MeshBinding
+        {
+            std::shared_ptr<DynamicMeshTarget> spTarget;
+            std::shared_ptr<const DynamicMeshData> spData;
+        };
+
+        // Instanced mesh with instances at recording
+        struct InstanceBinding
+        {
+            std::shared_ptr<InstancedMeshTarget> spTarget;
+            std::shared_ptr<const InstanceData> spData;
+        };
+
+        // Add command to list
+        void add(CommandType type, GLint a = 0, GLint b = 0, GLint c = 0, GLint d = 0, void const * pointer = NULL);
+
+        // Add uniform with values to list
+        void addUniform(CommandType type, GLint location, float const * pValues, int count);
+
+        // Members
+        std::vector<Command> mCommands;
+        std::vector<float> mFloats;
+        std::vector<MeshBinding> mMeshBindings;
+        std::vector<InstanceBinding> mInstanceBindings;
+        std::vector<std::function<void()> > mCalls;
+        std::vector<DamageRect> mDamageRects;
+        int mWindowWidth;
+        int mWindowHeight;
+        GLsync mFence;
+    };
+}
+
+#endif // RENDER_SNAPSHOT_H_
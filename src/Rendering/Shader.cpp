@@ -7,15 +7,17 @@
 
 #include "Shader.h"
 
-#include "externals/GLM/glm/gtc/type_ptr.hpp"
 #include "src/Utilities/OperationNotifier.h"
 
 #include <fstream>
 
 namespace eyegui
 {
-    Shader::Shader(char const * const pVertexShaderSource, char const * const pFragmentShaderSource)
+    Shader::Shader(RenderSnapshot* pRecording, char const * const pVertexShaderSource, char const * const pFragmentShaderSource)
     {
+        // Save recording to fill
+        mpRecording = pRecording;
+
         // Vertex shader
         GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
         glShaderSource(vertexShader, 1, &pVertexShaderSource, NULL);
@@ -69,32 +71,32 @@ namespace eyegui
 
     void Shader::bind() const
     {
-        glUseProgram(mShaderProgram);
+        mpRecording->useProgram(mShaderProgram);
     }
 
     void Shader::fillValue(std::string location, const float rValue) const
     {
-        glUniform1fv(mUniformLocationCache.at(location), 1, &rValue);
+        mpRecording->fillUniform(mUniformLocationCache.at(location), rValue);
     }
 
     void Shader::fillValue(std::string location, const glm::vec2& rValue) const
     {
-        glUniform2fv(mUniformLocationCache.at(location), 1, glm::value_ptr(rValue));
+        mpRecording->fillUniform(mUniformLocationCache.at(location), rValue);
     }
 
     void Shader::fillValue(std::string location, const glm::vec3& rValue) const
     {
-        glUniform3fv(mUniformLocationCache.at(location), 1, glm::value_ptr(rValue));
+        mpRecording->fillUniform(mUniformLocationCache.at(location), rValue);
     }
 
     void Shader::fillValue(std::string location, const glm::vec4& rValue) const
     {
-        glUniform4fv(mUniformLocationCache.at(location), 1, glm::value_ptr(rValue));
+        mpRecording->fillUniform(mUniformLocationCache.at(location), rValue);
     }
 
     void Shader::fillValue(std::string location, const glm::mat4x4& rValue) const
     {
-        glUniformMatrix4fv(mUniformLocationCache.at(location), 1, GL_FALSE, glm::value_ptr(rValue));
+        mpRecording->fillUniform(mUniformLocationCache.at(location), rValue);
     }
 
     GLuint Shader::getShaderProgram() const
@@ -102,6 +104,11 @@ namespace eyegui
         return mShaderProgram;
     }
 
+    RenderSnapshot* Shader::getRecording() const
+    {
+        return mpRecording;
+    }
+
     void Shader::evaluateShaderLog(GLuint handle) const
     {
         // Get length of compiling log
@@ -4,11 +4,13 @@
 //============================================================================
 
 // Author: Raphael Menges (https://github.com/raphaelmenges)
-// Encapsulation of the OpenGL shader creation and usage.
+// Encapsulation of the OpenGL shader creation and usage. Binding and filling
+// of values is recorded into render snapshot, which is executed later on.
 
 #ifndef SHADER_H_
 #define SHADER_H_
 
+#include "RenderSnapshot.h"
 #include "externals/OpenGLLoader/gl_core_3_3.h"
 #include "externals/GLM/glm/glm.hpp"
 
@@ -22,15 +24,15 @@ namespace eyegui
 	public:
 
 		// Constructor
-		Shader(char const * const pVertexShader, char const * const pFragmentShader);
+		Shader(RenderSnapshot* pRecording, char const * const pVertexShader, char const * const pFragmentShader);
 
 		// Destructor
 		virtual ~Shader();
 
-		// Bind shader for filling uniforms and rendering
+		// Record binding of shader for filling uniforms and rendering
 		void bind() const;
 
-		// Fill value for rendering
+		// Record filling of value for rendering
 		void fillValue(std::string location, const float rValue) const;
 		void fillValue(std::string location, const glm::vec2& rValue) const;
 		void fillValue(std::string location, const glm::vec3& rValue) const;
@@ -40,12 +42,16 @@ namespace eyegui
 		// Getter for handle
 		GLuint getShaderProgram() const;
 
+		// Getter for recording filled by shader
+		RenderSnapshot* getRecording() const;
+
 	private:
 
 		// Evaluate shader compiling log
 		void evaluateShaderLog(GLuint handle) const;
 
 		// Member
+		RenderSnapshot* mpRecording;
 		GLuint mShaderProgram;
 		std::map<std::string, int> mUniformLocationCache;
 	};
@@ -26,6 +26,98 @@ namespace eyegui
             "   gl_Position = matrix * vec4(posAttribute, 1);\n"
             "}\n";
 
+        // Instance attributes:
+        // mat4 matrixAttribute
+        // float pickAttribute
+        // float alphaAttribute
+        static const char* pKeyVertexShader =
+            "#version 330 core\n"
+            "in vec3 posAttribute;\n"
+            "in vec2 uvAttribute;\n"
+            "in mat4 matrixAttribute;\n"
+            "in float pickAttribute;\n"
+            "in float alphaAttribute;\n"
+            "out vec2 uv;\n"
+            "flat out float pick;\n"
+            "flat out float alpha;\n"
+            "void main() {\n"
+            "   uv = uvAttribute;\n"
+            "   pick = pickAttribute;\n"
+            "   alpha = alphaAttribute;\n"
+            "   gl_Position = matrixAttribute * vec4(posAttribute, 1);\n"
+            "}\n";
+
+        // Instance attributes:
+        // mat4 matrixAttribute
+        // float borderAttribute
+        // vec4 atlasAttribute
+        // float alphaAttribute
+        static const char* pCharacterKeyVertexShader =
+            "#version 330 core\n"
+            "in vec3 posAttribute;\n"
+            "in vec2 uvAttribute;\n"
+            "in mat4 matrixAttribute;\n"
+            "in float borderAttribute;\n"
+            "in vec4 atlasAttribute;\n"
+            "in float alphaAttribute;\n"
+            "out vec2 uv;\n"
+            "flat out float alpha;\n"
+            "void main() {\n"
+            "   uv = mix(atlasAttribute.xy, atlasAttribute.zw, uvAttribute);\n" // Glyph in atlas
+            "   alpha = alphaAttribute;\n"
+            "   vec2 pos = mix(vec2(borderAttribute), vec2(1.0 - borderAttribute), posAttribute.xy);\n" // Character is smaller than key
+            "   gl_Position = matrixAttribute * vec4(pos, 0, 1);\n"
+            "}\n";
+
+        // Instance attributes:
+        // vec4 lineAttribute
+        // float ageAttribute
+        // Uniforms:
+        // vec2 resolution
+        // float fadeDuration
+        static const char* pGazeLineVertexShader =
+            "#version 330 core\n"
+            "in vec3 posAttribute;\n"
+            "in vec2 uvAttribute;\n"
+            "in vec4 lineAttribute;\n" // Start and end in pixels
+            "in float ageAttribute;\n" // Seconds since start began to fade
+            "out vec2 uv;\n"
+            "flat out float alpha;\n"
+            "uniform vec2 resolution;\n"
+            "uniform float fadeDuration;\n"
+            "void main() {\n"
+            "   uv = uvAttribute;\n"
+            "   alpha = clamp(1.0 - (ageAttribute / fadeDuration), 0.0, 1.0);\n"
+            "   vec2 pixel = mix(lineAttribute.xy, lineAttribute.zw, posAttribute.x);\n"
+            "   gl_Position = vec4(2.0 * (pixel.x / resolution.x) - 1.0, 1.0 - 2.0 * (pixel.y / resolution.y), 0, 1);\n" // Pixels have origin at upper left
+            "}\n";
+
+        // Instance attributes:
+        // vec3 pointAttribute
+        // float ageAttribute
+        // Uniforms:
+        // vec2 resolution
+        // vec2 sizes
+        // float fadeDuration
+        static const char* pGazeCircleVertexShader =
+            "#version 330 core\n"
+            "in vec3 posAttribute;\n"
+            "in vec2 uvAttribute;\n"
+            "in vec3 pointAttribute;\n" // Center in pixels and focus
+            "in float ageAttribute;\n" // Seconds since point began to fade
+            "out vec2 uv;\n"
+            "flat out float alpha;\n"
+            "uniform vec2 resolution;\n"
+            "uniform vec2 sizes;\n" // Minimal and maximal size in pixels
+            "uniform float fadeDuration;\n"
+            "void main() {\n"
+            "   uv = uvAttribute;\n"
+            "   alpha = clamp(1.0 - (ageAttribute / fadeDuration), 0.0, 1.0);\n"
+            "   float diameter = floor(2.0 * mix(sizes.x, sizes.y, pointAttribute.z));\n" // Distance is used and mesh is from 0..1, so double the size
+            "   vec2 pixel = pointAttribute.xy - floor(diameter / 2.0) + vec2(posAttribute.x, 1.0 - posAttribute.y) * diameter;\n"
+            "   gl_Position = vec4(2.0 * (pixel.x / resolution.x) - 1.0, 1.0 - 2.0 * (pixel.y / resolution.y), 0, 1);\n" // Pixels have origin at upper left
+            "}\n";
+
         // Uniforms:
         // vec4 color
         // float alpha
@@ -53,6 +145,31 @@ namespace eyegui
             "   fragColor = vec4(color.rgb, color.a * alpha * min(circle, 1.0));\n"
             "}\n";
 
+        // Uniforms:
+        // vec4 color
+        static const char* pGazeLineFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "flat in float alpha;\n"
+            "uniform vec4 color = vec4(1,1,1,1);\n"
+            "void main() {\n"
+            "   fragColor = vec4(color.rgb, color.a * alpha);\n"
+            "}\n";
+
+        // Uniforms:
+        // vec4 color
+        static const char* pGazeCircleFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "flat in float alpha;\n"
+            "uniform vec4 color = vec4(1,1,1,1);\n"
+            "void main() {\n"
+            "   float gradient = length(2*uv-1);\n" // Simple gradient as base
+            "   float circle = (1-gradient) * 75;\n" // Extend gradient to unclamped circle
+            "   fragColor = vec4(color.rgb, color.a * alpha * min(circle, 1.0));\n"
+            "}\n";
+
         // Uniforms:
         // vec4 separatorColor
         // vec4 dimColor
@@ -355,7 +472,6 @@ namespace eyegui
         // vec4 markColor
         // vec4 highlightColor
         // vec4 stencil
-        // float pick
         // float activity
         // float dim
         // float mark
@@ -364,6 +480,8 @@ namespace eyegui
             "#version 330 core\n"
             "out vec4 fragColor;\n"
             "in vec2 uv;\n"
+            "flat in float pick;\n"
+            "flat in float alpha;\n"
             "uniform float time;\n"
             "uniform vec4 color = vec4(1,0,0,1);\n"
             "uniform vec4 pickColor = vec4(0,1,1,0.5);\n"
@@ -371,7 +489,6 @@ namespace eyegui
             "uniform vec4 markColor;\n"
             "uniform vec4 highlightColor = vec4(0,1,0,1);\n"
             "uniform vec4 stencil;\n"
-            "uniform float pick = 0;\n"
             "uniform float activity;\n"
             "uniform float dim;\n"
             "uniform float mark;\n"
@@ -386,7 +503,7 @@ namespace eyegui
             "   float circle = (1.0-gradient) * 75;\n" // Extend gradient to unclamped circle
             "   float inner = clamp(circle - (pick * innerBorder), 0, 1);\n" // Inner circle for character
             "	float outer = clamp(circle, 0, 1);\n" // Outer circle for pick
-            "	vec4 col = color;\n" // Color
+            "	vec4 col = vec4(color.rgb, color.a * alpha);\n" // Color
             "   col.rgb = mix(col.rgb, highlightColor.rgb, 0.5 * (1 + sin(3 * time)) * highlight * highlightColor.a);\n" // Adding highlight
             "   col.rgb = mix(vec3(0.3,0.3,0.3), col.rgb, max(0.2, activity));\n" // Activity
             "	col.rgb = (1.0 - (mark * markColor.a)) * col.rgb + (mark * markColor.a * markColor.rgb);\n" // Marking
@@ -414,6 +531,7 @@ namespace eyegui
             "#version 330 core\n"
             "out vec4 fragColor;\n"
             "in vec2 uv;\n"
+            "flat in float alpha;\n"
             "uniform float time;\n"
             "uniform sampler2D atlas;\n"
             "uniform vec4 stencil;\n"
@@ -431,13 +549,28 @@ namespace eyegui
             "       discard;\n"
             "   }"
             "   float value = texture(atlas, uv).r;\n"
-            "   vec4 col = color;\n"
+            "   vec4 col = vec4(color.rgb, color.a * alpha);\n"
             "   col.rgb = mix(col.rgb, highlightColor.rgb, 0.5 * (1 + sin(3 * time)) * highlight * highlightColor.a);\n" // Adding highlight
             "   col.rgb = mix(vec3(0.3,0.3,0.3), col.rgb, max(0.2, activity));\n" // Activity
             "	col.rgb = (1.0 - (mark * markColor.a)) * col.rgb + (mark * markColor.a * markColor.rgb);\n" // Marking
             "	col.rgba *= (1.0 - dim) + (dim * dimColor);\n" // Dimming
             "   fragColor = vec4(col.rgb, col.a * value);\n" // Composing pixel
             "}\n";
+
+        // Uniforms:
+        // sampler2D layer
+        // vec2 uvOffset
+        // vec2 uvScale
+        static const char* pLayerFragmentShader =
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "in vec2 uv;\n"
+            "uniform sampler2D layer;\n"
+            "uniform vec2 uvOffset;\n"
+            "uniform vec2 uvScale;\n"
+            "void main() {\n"
+            "   fragColor = texture(layer, uvOffset + (uv * uvScale));\n" // Color is already multiplied with alpha
+            "}\n";
     }
 }
 
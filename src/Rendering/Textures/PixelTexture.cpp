@@ -10,6 +10,7 @@
 #include "src/Utilities/Helper.h"
 #include "src/Utilities/OperationNotifier.h"
 #include "src/Utilities/PathBuilder.h"
+#include "src/Utilities/Tracer.h"
 
 // stb_image wants those defines
 #define STB_IMAGE_IMPLEMENTATION
@@ -18,10 +19,40 @@
 
 namespace eyegui
 {
-    PixelTexture::PixelTexture(std::string filepath, Filtering filtering, Wrap wrap, int suspectedChannels) : Texture()
+    namespace
     {
-        // Setup stb_image
-        stbi_set_flip_vertically_on_load(true);
+        // Images are flipped for OpenGL. Set once, so decoding on multiple threads only reads it
+        const bool flipSet = (stbi_set_flip_vertically_on_load(true), true);
+    }
+
+    PixelTexture::PixelTexture(RenderSnapshot* pRecording, std::string filepath, Filtering filtering, Wrap wrap, int suspectedChannels) : Texture(pRecording)
+    {
+        // Decode image
+        DecodedImage image;
+        if (!decode(filepath, suspectedChannels, image))
+        {
+            throwError(OperationNotifier::Operation::IMAGE_LOADING, "Image file not found or error at parsing", filepath);
+
+            // Use single transparent pixel instead
+            image.width = 1;
+            image.height = 1;
+            image.channelCount = suspectedChannels > 0 ? suspectedChannels : 4;
+            image.pixels.assign(image.channelCount, 0);
+        }
+
+        // Create OpenGL texture
+        createOpenGLTexture(image.pixels, filtering, wrap, image.width, image.height, image.channelCount, filepath);
+    }
+
+    PixelTexture::PixelTexture(RenderSnapshot* pRecording, std::string filepath, const DecodedImage& rImage, Filtering filtering, Wrap wrap) : Texture(pRecording)
+    {
+        // Create OpenGL texture
+        createOpenGLTexture(rImage.pixels, filtering, wrap, rImage.width, rImage.height, rImage.channelCount, filepath);
+    }
+
+    bool PixelTexture::decode(std::string filepath, int suspectedChannels, DecodedImage& rImage)
+    {
+        EYEGUI_TRACE_SCOPE("PixelTexture::decode", filepath);
 
         // Try to load image
         int width, height, channelCount;
@@ -30,17 +61,22 @@ namespace eyegui
         // Check whether file was found and parsed
         if (data == NULL)
         {
-            throwError(OperationNotifier::Operation::IMAGE_LOADING, "Image file not found or error at parsing", filepath);
+            return false;
         }
 
-        // Create vector out of data
-        std::vector<unsigned char> image(data, data + width * height * suspectedChannels);
-
-        // Create OpenGL texture
-        createOpenGLTexture(image, filtering, wrap, width, height, suspectedChannels, filepath);
+        // Create vector out of data, which has suspected count of channels if given
+        if (suspectedChannels > 0)
+        {
+            channelCount = suspectedChannels;
+        }
+        rImage.pixels.assign(data, data + width * height * channelCount);
+        rImage.width = width;
+        rImage.height = height;
+        rImage.channelCount = channelCount;
 
         // Delete raw image data
         stbi_image_free(data);
+        return true;
     }
 
     PixelTexture::~PixelTexture()
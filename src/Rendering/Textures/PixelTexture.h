@@ -11,14 +11,31 @@
 
 #include "Texture.h"
 
+#include <vector>
+
 namespace eyegui
 {
+    // Image decoded from file, which may happen on other thread than creation of texture
+    struct DecodedImage
+    {
+        std::vector<unsigned char> pixels;
+        int width = 0;
+        int height = 0;
+        int channelCount = 0;
+    };
+
     class PixelTexture : public Texture
     {
     public:
 
         // Constructor
-        PixelTexture(std::string filepath, Filtering filtering, Wrap wrap, int suspectedChannels = 0);
+        PixelTexture(RenderSnapshot* pRecording, std::string filepath, Filtering filtering, Wrap wrap, int suspectedChannels = 0);
+
+        // Constructor with already decoded image
+        PixelTexture(RenderSnapshot* pRecording, std::string filepath, const DecodedImage& rImage, Filtering filtering, Wrap wrap);
+
+        // Decode image file, does not use OpenGL. Returns false if not found or not parsed
+        static bool decode(std::string filepath, int suspectedChannels, DecodedImage& rImage);
 
         // Destructor
         virtual ~PixelTexture();
@@ -13,9 +13,10 @@
 
 namespace eyegui
 {
-    Texture::Texture()
+    Texture::Texture(RenderSnapshot* pRecording)
     {
         // Initialize members
+        mpRecording = pRecording;
         mTexture = 0;
         mWidth = 0;
         mHeight = 0;
@@ -30,11 +31,7 @@ namespace eyegui
 
     void Texture::bind(uint slot) const
     {
-        // Choose slot
-        glActiveTexture(GL_TEXTURE0 + slot);
-
-        // Bind texture
-        glBindTexture(GL_TEXTURE_2D, mTexture);
+        mpRecording->bindTexture(slot, mTexture);
     }
 
     uint Texture::getWidth() const
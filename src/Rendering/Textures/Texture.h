@@ -12,6 +12,7 @@
 #include "include/eyeGUI.h"
 
 #include "Defines.h"
+#include "src/Rendering/RenderSnapshot.h"
 #include "externals/OpenGLLoader/gl_core_3_3.h"
 
 #include <string>
@@ -33,13 +34,13 @@ namespace eyegui
             CLAMP, MIRROR, REPEAT
         };
 
-        // Constructor for pixel based image
-        Texture();
+        // Constructor, binding is recorded into given snapshot
+        Texture(RenderSnapshot* pRecording);
 
         // Destructor
         virtual ~Texture() = 0;
 
-        // Bind texture to slot for rendering
+        // Record binding of texture to slot for rendering
         void bind(uint slot = 0) const;
 
         // Getter for width and height
@@ -60,6 +61,7 @@ namespace eyegui
     private:
 
         // Members
+        RenderSnapshot* mpRecording;
         GLuint mTexture;
         uint mWidth;
         uint mHeight;
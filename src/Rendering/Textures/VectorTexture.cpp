@@ -20,7 +20,7 @@
 
 namespace eyegui
 {
-    VectorTexture::VectorTexture(std::string filepath, Filtering filtering, Wrap wrap, float dpi) : Texture()
+    VectorTexture::VectorTexture(RenderSnapshot* pRecording, std::string filepath, Filtering filtering, Wrap wrap, float dpi) : Texture(pRecording)
     {
         // Parse file
         NSVGimage* svg = nsvgParseFromFile(buildPath(filepath).c_str(), "px", dpi);
@@ -38,7 +38,7 @@ namespace eyegui
         nsvgDelete(svg);
     }
 
-    VectorTexture::VectorTexture(std::string const * pGraphic, Filtering filtering, Wrap wrap, float dpi)
+    VectorTexture::VectorTexture(RenderSnapshot* pRecording, std::string const * pGraphic, Filtering filtering, Wrap wrap, float dpi) : Texture(pRecording)
     {
         // Parse graphics
         char* str = static_cast<char*>(malloc(sizeof(char) * pGraphic->size() + 1));
@@ -0,0 +1,75 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "StyleTable.h"
+
+#include <algorithm>
+
+namespace eyegui
+{
+    StyleTable::StyleTable(const std::map<std::string, Style>& rStyles)
+    {
+        // Map is sorted by name already
+        std::map<std::string, Style> styles = rStyles;
+        if (styles.find(DEFAULT_STYLE_NAME) == styles.end())
+        {
+            styles[DEFAULT_STYLE_NAME] = Style();
+        }
+        mNames.reserve(styles.size());
+        mStyles.reserve(styles.size());
+        for (const auto& rPair : styles)
+        {
+            mNames.push_back(rPair.first);
+            mStyles.push_back(rPair.second);
+        }
+
+        // Initialize members
+        mDefaultId = 0;
+        findId(DEFAULT_STYLE_NAME, mDefaultId);
+    }
+
+    StyleTable::~StyleTable()
+    {
+        // Nothing to do
+    }
+
+    bool StyleTable::findId(const std::string& rName, uint& rId) const
+    {
+        auto it = std::lower_bound(mNames.begin(), mNames.end(), rName);
+        if (it != mNames.end() && *it == rName)
+        {
+            rId = (uint)(it - mNames.begin());
+            return true;
+        }
+        return false;
+    }
+
+    uint StyleTable::getDefaultId() const
+    {
+        return mDefaultId;
+    }
+
+    Style const * StyleTable::getStyle(uint id) const
+    {
+        return id < mStyles.size() ? &(mStyles[id]) : NULL;
+    }
+
+    Style* StyleTable::getStyle(uint id)
+    {
+        return id < mStyles.size() ? &(mStyles[id]) : NULL;
+    }
+
+    const std::string& StyleTable::getName(uint id) const
+    {
+        return mNames[id];
+    }
+
+    uint StyleTable::getCount() const
+    {
+        return (uint)mNames.size();
+    }
+}
@@ -0,0 +1,58 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Styles of a stylesheet with integer ids. Names and ids are fixed after
+// construction, so elements keep id and pointer to their style. Only values
+// of styles may change.
+
+#ifndef STYLE_TABLE_H_
+#define STYLE_TABLE_H_
+
+#include "Style.h"
+#include "Defines.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace eyegui
+{
+    class StyleTable
+    {
+    public:
+
+        // Constructor, default style is added if not included
+        StyleTable(const std::map<std::string, Style>& rStyles);
+
+        // Destructor
+        virtual ~StyleTable();
+
+        // Find id of style by name, returns whether found
+        bool findId(const std::string& rName, uint& rId) const;
+
+        // Get id of default style
+        uint getDefaultId() const;
+
+        // Get style by id, returns NULL if not existing
+        Style const * getStyle(uint id) const;
+        Style* getStyle(uint id);
+
+        // Get name of style by id
+        const std::string& getName(uint id) const;
+
+        // Get count of styles
+        uint getCount() const;
+
+    private:
+
+        // Members, index is id. Names are sorted for search
+        std::vector<std::string> mNames;
+        std::vector<Style> mStyles;
+        uint mDefaultId;
+    };
+}
+
+#endif // STYLE_TABLE_H_
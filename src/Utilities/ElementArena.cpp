@@ -0,0 +1,126 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "ElementArena.h"
+
+#include "src/Defines.h"
+
+#include <algorithm>
+#include <new>
+
+namespace eyegui
+{
+    namespace
+    {
+        // Every allocation is preceded by pointer to its arena, padded to keep alignment
+        const std::size_t ALIGNMENT = alignof(std::max_align_t);
+        const std::size_t HEADER_SIZE = ((sizeof(ElementArena*) + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT;
+
+        // Arena of scope of calling thread
+        thread_local ElementArena* tpCurrentArena = NULL;
+    }
+
+    ElementArena::Scope::Scope()
+    {
+        if (tpCurrentArena == NULL)
+        {
+            // Scope holds reference until it ends
+            mpArena = new ElementArena();
+            tpCurrentArena = mpArena;
+        }
+        else
+        {
+            mpArena = NULL;
+        }
+    }
+
+    ElementArena::Scope::~Scope()
+    {
+        if (mpArena != NULL)
+        {
+            tpCurrentArena = NULL;
+            mpArena->release();
+        }
+    }
+
+    void* ElementArena::allocate(std::size_t size)
+    {
+        ElementArena* pArena = tpCurrentArena;
+        char* pMemory = NULL;
+        if (pArena != NULL)
+        {
+            pMemory = (char*)pArena->allocateInChunk(HEADER_SIZE + size);
+        }
+        else
+        {
+            pMemory = (char*)::operator new(HEADER_SIZE + size);
+        }
+        *((ElementArena**)pMemory) = pArena;
+        return pMemory + HEADER_SIZE;
+    }
+
+    void ElementArena::deallocate(void* pMemory)
+    {
+        if (pMemory == NULL)
+        {
+            return;
+        }
+        char* pBlock = (char*)pMemory - HEADER_SIZE;
+        ElementArena* pArena = *((ElementArena**)pBlock);
+        if (pArena != NULL)
+        {
+            pArena->release();
+        }
+        else
+        {
+            ::operator delete(pBlock);
+        }
+    }
+
+    ElementArena::ElementArena()
+    {
+        // Reference of creating scope
+        mUsed = 0;
+        mChunkSize = 0;
+        mReferences.store(1);
+    }
+
+    ElementArena::~ElementArena()
+    {
+        for (char* pChunk : mChunks)
+        {
+            ::operator delete(pChunk);
+        }
+    }
+
+    void* ElementArena::allocateInChunk(std::size_t size)
+    {
+        // Keep following allocations aligned
+        size = ((size + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT;
+
+        // Start new chunk if last one is full, large objects get chunk of their own size
+        if (mChunks.empty() || mUsed + size > mChunkSize)
+        {
+            mChunkSize = std::max((std::size_t)ELEMENT_ARENA_CHUNK_SIZE, size);
+            mChunks.push_back((char*)::operator new(mChunkSize));
+            mUsed = 0;
+        }
+
+        void* pMemory = mChunks.back() + mUsed;
+        mUsed += size;
+        mReferences.fetch_add(1);
+        return pMemory;
+    }
+
+    void ElementArena::release()
+    {
+        if (mReferences.fetch_sub(1) == 1)
+        {
+            delete this;
+        }
+    }
+}
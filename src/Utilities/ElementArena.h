@@ -0,0 +1,91 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Monotonic arena for elements and their small owned objects, created while
+// parsing a layout or brick. Objects are placed one after another into a few
+// chunks and still owned by unique pointers. Deleting an object only counts
+// down the arena, which frees its chunks when the last object is gone, so
+// elements may move freely between frames. Outside of parsing, objects are
+// allocated on the heap as usual.
+
+#ifndef ELEMENT_ARENA_H_
+#define ELEMENT_ARENA_H_
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace eyegui
+{
+    class ElementArena
+    {
+    public:
+
+        // Objects allocated by calling thread are placed into arena while scope exists.
+        // Nested scopes use arena of outer scope
+        class Scope
+        {
+        public:
+
+            // Constructor
+            Scope();
+
+            // Destructor
+            virtual ~Scope();
+
+        private:
+
+            // Members
+            ElementArena* mpArena; // NULL if nested
+        };
+
+        // Allocate memory in arena of calling thread or on heap
+        static void* allocate(std::size_t size);
+
+        // Free memory allocated by arena or heap
+        static void deallocate(void* pMemory);
+
+    private:
+
+        // Constructor
+        ElementArena();
+
+        // Destructor
+        virtual ~ElementArena();
+
+        // Allocate memory in own chunks
+        void* allocateInChunk(std::size_t size);
+
+        // Release one reference, deletes arena if last one
+        void release();
+
+        // Members
+        std::vector<char*> mChunks;
+        std::size_t mUsed; // Bytes used in last chunk
+        std::size_t mChunkSize; // Size of last chunk
+        std::atomic<unsigned int> mReferences; // Living objects and scope
+    };
+
+    // Superclass of objects which may be allocated in element arena
+    class ArenaAllocated
+    {
+    public:
+
+        // Allocation
+        static void* operator new(std::size_t size)
+        {
+            return ElementArena::allocate(size);
+        }
+
+        // Deallocation
+        static void operator delete(void* pMemory)
+        {
+            ElementArena::deallocate(pMemory);
+        }
+    };
+}
+
+#endif // ELEMENT_ARENA_H_
@@ -0,0 +1,105 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Lock-free ring buffer for gaze samples. Exactly one thread (eye tracker
+// callback) may push and exactly one thread (update of GUI) may pop. Push
+// never blocks, a sample is dropped when buffer is full.
+
+#ifndef GAZE_SAMPLE_BUFFER_H_
+#define GAZE_SAMPLE_BUFFER_H_
+
+#include <atomic>
+#include <vector>
+
+namespace eyegui
+{
+    // Single sample of eye tracker
+    struct GazeSample
+    {
+        float gazeX;
+        float gazeY;
+        double timestamp; // In seconds, provided by eye tracker
+        float duration; // Time since previous sample, filled when consumed
+    };
+
+    class GazeSampleBuffer
+    {
+    public:
+
+        // Constructor
+        GazeSampleBuffer(unsigned int capacity)
+        {
+            // One slot stays empty to distinguish full from empty buffer
+            mSamples.resize(capacity + 1);
+            mHead.store(0);
+            mTail.store(0);
+            mDroppedCount.store(0);
+        }
+
+        // Destructor
+        virtual ~GazeSampleBuffer() {}
+
+        // Push sample, returns false if buffer is full. Only called by producer
+        bool push(const GazeSample& rSample)
+        {
+            unsigned int head = mHead.load(std::memory_order_relaxed);
+            unsigned int next = increment(head);
+
+            // Check whether consumer is too slow
+            if (next == mTail.load(std::memory_order_acquire))
+            {
+                mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            mSamples[head] = rSample;
+            mHead.store(next, std::memory_order_release);
+            return true;
+        }
+
+        // Append all available samples to vector. Only called by consumer
+        void popAll(std::vector<GazeSample>& rSamples)
+        {
+            unsigned int tail = mTail.load(std::memory_order_relaxed);
+            unsigned int head = mHead.load(std::memory_order_acquire);
+
+            while (tail != head)
+            {
+                rSamples.push_back(mSamples[tail]);
+                tail = increment(tail);
+            }
+
+            mTail.store(tail, std::memory_order_release);
+        }
+
+        // Get and reset count of dropped samples
+        unsigned int fetchDroppedCount()
+        {
+            return mDroppedCount.exchange(0);
+        }
+
+    private:
+
+        // Move index to next slot
+        unsigned int increment(unsigned int index) const
+        {
+            index++;
+            if (index >= mSamples.size())
+            {
+                index = 0;
+            }
+            return index;
+        }
+
+        // Members
+        std::vector<GazeSample> mSamples;
+        std::atomic<unsigned int> mHead; // Written by producer
+        std::atomic<unsigned int> mTail; // Written by consumer
+        std::atomic<unsigned int> mDroppedCount;
+    };
+}
+
+#endif // GAZE_SAMPLE_BUFFER_H_
@@ -0,0 +1,1016 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "InputRecorder.h"
+
+#include "src/Utilities/OperationNotifier.h"
+#include "src/Utilities/PathBuilder.h"
+
+namespace eyegui
+{
+    InputRecorder::InputRecorder()
+    {
+        mAddedLayoutCount = 0;
+    }
+
+    InputRecorder::~InputRecorder()
+    {
+        if (mFile.is_open())
+        {
+            mFile.close();
+        }
+    }
+
+    void InputRecorder::open(
+        std::string filepath,
+        int width,
+        int height,
+        std::string fontFilepath,
+        CharacterSet characterSet,
+        std::string localizationFilepath,
+        float vectorGraphicsDPI,
+        float fontTallSize,
+        float fontMediumSize,
+        float fontSmallSize)
+    {
+        // Log is not relative to root filepath
+        mFile.open(filepath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!mFile.is_open())
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Could not open file for input recording", filepath);
+            return;
+        }
+
+        // Header
+        writeUInt(INPUT_LOG_MAGIC);
+        writeUInt(INPUT_LOG_VERSION);
+        writeString(PathBuilder::getRootFilepath());
+        writeInt(width);
+        writeInt(height);
+        writeString(fontFilepath);
+        writeInt((int)characterSet);
+        writeString(localizationFilepath);
+        writeFloat(vectorGraphicsDPI);
+        writeFloat(fontTallSize);
+        writeFloat(fontMediumSize);
+        writeFloat(fontSmallSize);
+    }
+
+    bool InputRecorder::isRecording() const
+    {
+        return mFile.is_open();
+    }
+
+    void InputRecorder::recordUpdate(float tpf, const Input& rInput)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::UPDATE);
+        writeFloat(tpf);
+        writeInt(rInput.gazeX);
+        writeInt(rInput.gazeY);
+        writeBool(rInput.gazeUsed);
+        writeBool(rInput.instantInteraction);
+    }
+
+    void InputRecorder::recordGazeSample(float gazeX, float gazeY, double timestamp)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::GAZE_SAMPLE);
+        writeFloat(gazeX);
+        writeFloat(gazeY);
+        writeDouble(timestamp);
+    }
+
+    void InputRecorder::recordDraw()
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::DRAW);
+    }
+
+    void InputRecorder::recordResize(int width, int height)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::RESIZE);
+        writeInt(width);
+        writeInt(height);
+    }
+
+    void InputRecorder::recordAddLayout(Layout const * pLayout, std::string filepath, bool visible)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        // Remember index of layout for following records. Replay appends
+        // every added layout, so removed ones keep their index
+        mLayoutIndices[pLayout] = mAddedLayoutCount;
+        mAddedLayoutCount++;
+
+        writeType(InputRecordType::ADD_LAYOUT);
+        writeString(filepath);
+        writeBool(visible);
+    }
+
+    void InputRecorder::recordRemoveLayout(Layout const * pLayout)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::REMOVE_LAYOUT);
+        writeLayout(pLayout);
+
+        // Address may be reused by a layout added later
+        mLayoutIndices.erase(pLayout);
+    }
+
+    void InputRecorder::recordLoadConfig(std::string filepath)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::LOAD_CONFIG);
+        writeString(filepath);
+    }
+
+    void InputRecorder::recordSwitchLocalization(std::string filepath)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SWITCH_LOCALIZATION);
+        writeString(filepath);
+    }
+
+    void InputRecorder::recordSetValueOfConfigAttribute(std::string attribute, std::string value)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_VALUE_OF_CONFIG_ATTRIBUTE);
+        writeString(attribute);
+        writeString(value);
+    }
+
+    void InputRecorder::recordSetGazeVisualizationDrawing(bool draw)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_GAZE_VISUALIZATION_DRAWING);
+        writeBool(draw);
+    }
+
+    void InputRecorder::recordPrefetchImage(std::string filepath)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::PREFETCH_IMAGE);
+        writeString(filepath);
+    }
+
+    void InputRecorder::recordMoveLayout(Layout const * pLayout, bool toFront)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(toFront ? InputRecordType::MOVE_LAYOUT_TO_FRONT : InputRecordType::MOVE_LAYOUT_TO_BACK);
+        writeLayout(pLayout);
+    }
+
+    void InputRecorder::recordInvalidateBrick(std::string filepath)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::INVALIDATE_BRICK);
+        writeString(filepath);
+    }
+
+    void InputRecorder::recordInvalidateAllBricks()
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::INVALIDATE_ALL_BRICKS);
+    }
+
+    void InputRecorder::recordInvalidateStylesheet(std::string filepath)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::INVALIDATE_STYLESHEET);
+        writeString(filepath);
+    }
+
+    void InputRecorder::recordInvalidateAllStylesheets()
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::INVALIDATE_ALL_STYLESHEETS);
+    }
+
+    void InputRecorder::recordSetProfiling(bool enabled, bool gpuTiming)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_PROFILING);
+        writeBool(enabled);
+        writeBool(gpuTiming);
+    }
+
+    void InputRecorder::recordSetLayerCaching(bool enabled)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_LAYER_CACHING);
+        writeBool(enabled);
+    }
+
+    void InputRecorder::recordSetPartialRedraw(bool enabled)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_PARTIAL_REDRAW);
+        writeBool(enabled);
+    }
+
+    void InputRecorder::recordSetRenderSnapshots(bool enabled)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_RENDER_SNAPSHOTS);
+        writeBool(enabled);
+    }
+
+    void InputRecorder::recordSetParallelUpdate(bool enabled)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_PARALLEL_UPDATE);
+        writeBool(enabled);
+    }
+
+    void InputRecorder::recordSetInputUsageOfLayout(Layout const * pLayout, bool useInput)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_INPUT_USAGE_OF_LAYOUT);
+        writeLayout(pLayout);
+        writeBool(useInput);
+    }
+
+    void InputRecorder::recordSetVisibilityOfLayout(Layout const * pLayout, bool visible, bool reset, bool fade)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_VISIBILITY_OF_LAYOUT);
+        writeLayout(pLayout);
+        writeBool(visible);
+        writeBool(reset);
+        writeBool(fade);
+    }
+
+    void InputRecorder::recordSetElementActivity(Layout const * pLayout, std::string id, bool active, bool fade)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_ELEMENT_ACTIVITY);
+        writeLayout(pLayout);
+        writeString(id);
+        writeBool(active);
+        writeBool(fade);
+    }
+
+    void InputRecorder::recordSetElementDimming(Layout const * pLayout, std::string id, bool dimming)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_ELEMENT_DIMMING);
+        writeLayout(pLayout);
+        writeString(id);
+        writeBool(dimming);
+    }
+
+    void InputRecorder::recordSetElementMarking(Layout const * pLayout, std::string id, bool marking, int depth)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_ELEMENT_MARKING);
+        writeLayout(pLayout);
+        writeString(id);
+        writeBool(marking);
+        writeInt(depth);
+    }
+
+    void InputRecorder::recordSetStyleOfElement(Layout const * pLayout, std::string id, std::string style)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_STYLE_OF_ELEMENT);
+        writeLayout(pLayout);
+        writeString(id);
+        writeString(style);
+    }
+
+    void InputRecorder::recordSetElementHiding(Layout const * pLayout, std::string id, bool hidden)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_ELEMENT_HIDING);
+        writeLayout(pLayout);
+        writeString(id);
+        writeBool(hidden);
+    }
+
+    void InputRecorder::recordHighlightInteractiveElement(Layout const * pLayout, std::string id, bool doHighlight)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::HIGHLIGHT_INTERACTIVE_ELEMENT);
+        writeLayout(pLayout);
+        writeString(id);
+        writeBool(doHighlight);
+    }
+
+    void InputRecorder::recordSetValueOfStyleAttribute(Layout const * pLayout, std::string styleName, std::string attribute, float r, float g, float b, float a)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_VALUE_OF_STYLE_ATTRIBUTE);
+        writeLayout(pLayout);
+        writeString(styleName);
+        writeString(attribute);
+        writeFloat(r);
+        writeFloat(g);
+        writeFloat(b);
+        writeFloat(a);
+    }
+
+    void InputRecorder::recordSetIconOfIconInteractiveElement(Layout const * pLayout, std::string id, std::string iconFilepath)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_ICON_OF_ICON_INTERACTIVE_ELEMENT);
+        writeLayout(pLayout);
+        writeString(id);
+        writeString(iconFilepath);
+    }
+
+    void InputRecorder::recordInteractWithInteractiveElement(Layout const * pLayout, std::string id)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::INTERACT_WITH_INTERACTIVE_ELEMENT);
+        writeLayout(pLayout);
+        writeString(id);
+    }
+
+    void InputRecorder::recordSelectInteractiveElement(Layout const * pLayout, std::string id)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SELECT_INTERACTIVE_ELEMENT);
+        writeLayout(pLayout);
+        writeString(id);
+    }
+
+    void InputRecorder::recordDeselectInteractiveElement(Layout const * pLayout)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::DESELECT_INTERACTIVE_ELEMENT);
+        writeLayout(pLayout);
+    }
+
+    void InputRecorder::recordInteractWithSelectedInteractiveElement(Layout const * pLayout)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::INTERACT_WITH_SELECTED_INTERACTIVE_ELEMENT);
+        writeLayout(pLayout);
+    }
+
+    void InputRecorder::recordSelectNextInteractiveElement(Layout const * pLayout)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SELECT_NEXT_INTERACTIVE_ELEMENT);
+        writeLayout(pLayout);
+    }
+
+    void InputRecorder::recordSetContentOfTextBlock(Layout const * pLayout, std::string id, std::string content)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_CONTENT_OF_TEXT_BLOCK);
+        writeLayout(pLayout);
+        writeString(id);
+        writeString(content);
+    }
+
+    void InputRecorder::recordSetKeyOfTextBlock(Layout const * pLayout, std::string id, std::string key)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_KEY_OF_TEXT_BLOCK);
+        writeLayout(pLayout);
+        writeString(id);
+        writeString(key);
+    }
+
+    void InputRecorder::recordSetContentOfTextEdit(Layout const * pLayout, std::string id, std::string content)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_CONTENT_OF_TEXT_EDIT);
+        writeLayout(pLayout);
+        writeString(id);
+        writeString(content);
+    }
+
+    void InputRecorder::recordAddContentAtCursorInTextEdit(Layout const * pLayout, std::string id, std::string content)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::ADD_CONTENT_AT_CURSOR_IN_TEXT_EDIT);
+        writeLayout(pLayout);
+        writeString(id);
+        writeString(content);
+    }
+
+    void InputRecorder::recordDeleteContentAtCursorInTextEdit(Layout const * pLayout, std::string id, int letterCount)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::DELETE_CONTENT_AT_CURSOR_IN_TEXT_EDIT);
+        writeLayout(pLayout);
+        writeString(id);
+        writeInt(letterCount);
+    }
+
+    void InputRecorder::recordMoveCursorOverLettersInTextEdit(Layout const * pLayout, std::string id, int letterCount)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::MOVE_CURSOR_OVER_LETTERS_IN_TEXT_EDIT);
+        writeLayout(pLayout);
+        writeString(id);
+        writeInt(letterCount);
+    }
+
+    void InputRecorder::recordMoveCursorOverLinesInTextEdit(Layout const * pLayout, std::string id, int lineCount)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::MOVE_CURSOR_OVER_LINES_IN_TEXT_EDIT);
+        writeLayout(pLayout);
+        writeString(id);
+        writeInt(lineCount);
+    }
+
+    void InputRecorder::recordHitButton(Layout const * pLayout, std::string id)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::HIT_BUTTON);
+        writeLayout(pLayout);
+        writeString(id);
+    }
+
+    void InputRecorder::recordButtonDown(Layout const * pLayout, std::string id, bool immediately)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::BUTTON_DOWN);
+        writeLayout(pLayout);
+        writeString(id);
+        writeBool(immediately);
+    }
+
+    void InputRecorder::recordButtonUp(Layout const * pLayout, std::string id, bool immediately)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::BUTTON_UP);
+        writeLayout(pLayout);
+        writeString(id);
+        writeBool(immediately);
+    }
+
+    void InputRecorder::recordPenetrateSensor(Layout const * pLayout, std::string id, float amount)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::PENETRATE_SENSOR);
+        writeLayout(pLayout);
+        writeString(id);
+        writeFloat(amount);
+    }
+
+    void InputRecorder::recordSetFastTypingOfKeyboard(Layout const * pLayout, std::string id, bool useFastTyping)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_FAST_TYPING_OF_KEYBOARD);
+        writeLayout(pLayout);
+        writeString(id);
+        writeBool(useFastTyping);
+    }
+
+    void InputRecorder::recordSetCaseOfKeyboard(Layout const * pLayout, std::string id, KeyboardCase keyboardCase)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_CASE_OF_KEYBOARD);
+        writeLayout(pLayout);
+        writeString(id);
+        writeInt((int)keyboardCase);
+    }
+
+    void InputRecorder::recordSetKeymapOfKeyboard(Layout const * pLayout, std::string id, unsigned int keymapIndex)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_KEYMAP_OF_KEYBOARD);
+        writeLayout(pLayout);
+        writeString(id);
+        writeUInt(keymapIndex);
+    }
+
+    void InputRecorder::recordSetDictionaryOfKeyboard(Layout const * pLayout, std::string id, std::string filepath)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_DICTIONARY_OF_KEYBOARD);
+        writeLayout(pLayout);
+        writeString(id);
+        writeString(filepath);
+    }
+
+    void InputRecorder::recordSetWordOfKeyboard(Layout const * pLayout, std::string id, std::string word)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_WORD_OF_KEYBOARD);
+        writeLayout(pLayout);
+        writeString(id);
+        writeString(word);
+    }
+
+    void InputRecorder::recordReplaceElementWithBlock(Layout const * pLayout, std::string id, bool consumeInput, std::string backgroundFilepath, ImageAlignment backgroundAlignment, bool fade)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::REPLACE_ELEMENT_WITH_BLOCK);
+        writeLayout(pLayout);
+        writeString(id);
+        writeBool(consumeInput);
+        writeString(backgroundFilepath);
+        writeInt((int)backgroundAlignment);
+        writeBool(fade);
+    }
+
+    void InputRecorder::recordReplaceElementWithPicture(Layout const * pLayout, std::string id, std::string filepath, ImageAlignment alignment, bool fade)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::REPLACE_ELEMENT_WITH_PICTURE);
+        writeLayout(pLayout);
+        writeString(id);
+        writeString(filepath);
+        writeInt((int)alignment);
+        writeBool(fade);
+    }
+
+    void InputRecorder::recordReplaceElementWithBlank(Layout const * pLayout, std::string id, bool fade)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::REPLACE_ELEMENT_WITH_BLANK);
+        writeLayout(pLayout);
+        writeString(id);
+        writeBool(fade);
+    }
+
+    void InputRecorder::recordReplaceElementWithCircleButton(Layout const * pLayout, std::string id, std::string iconFilepath, bool isSwitch, bool fade)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::REPLACE_ELEMENT_WITH_CIRCLE_BUTTON);
+        writeLayout(pLayout);
+        writeString(id);
+        writeString(iconFilepath);
+        writeBool(isSwitch);
+        writeBool(fade);
+    }
+
+    void InputRecorder::recordReplaceElementWithBoxButton(Layout const * pLayout, std::string id, std::string iconFilepath, bool isSwitch, bool fade)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::REPLACE_ELEMENT_WITH_BOX_BUTTON);
+        writeLayout(pLayout);
+        writeString(id);
+        writeString(iconFilepath);
+        writeBool(isSwitch);
+        writeBool(fade);
+    }
+
+    void InputRecorder::recordReplaceElementWithSensor(Layout const * pLayout, std::string id, std::string iconFilepath, bool fade)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::REPLACE_ELEMENT_WITH_SENSOR);
+        writeLayout(pLayout);
+        writeString(id);
+        writeString(iconFilepath);
+        writeBool(fade);
+    }
+
+    void InputRecorder::recordReplaceElementWithTextBlock(Layout const * pLayout, std::string id, bool consumeInput, FontSize fontSize, TextFlowAlignment alignment, TextFlowVerticalAlignment verticalAlignment, std::string content, float innerBorder, float textScale, std::string key, std::string backgroundFilepath, ImageAlignment backgroundAlignment, bool fade)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::REPLACE_ELEMENT_WITH_TEXT_BLOCK);
+        writeLayout(pLayout);
+        writeString(id);
+        writeBool(consumeInput);
+        writeInt((int)fontSize);
+        writeInt((int)alignment);
+        writeInt((int)verticalAlignment);
+        writeString(content);
+        writeFloat(innerBorder);
+        writeFloat(textScale);
+        writeString(key);
+        writeString(backgroundFilepath);
+        writeInt((int)backgroundAlignment);
+        writeBool(fade);
+    }
+
+    void InputRecorder::recordReplaceElementWithBrick(Layout const * pLayout, std::string id, std::string filepath, const std::map<std::string, std::string>& rIdMapper, bool fade)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::REPLACE_ELEMENT_WITH_BRICK);
+        writeLayout(pLayout);
+        writeString(id);
+        writeString(filepath);
+        writeIdMapper(rIdMapper);
+        writeBool(fade);
+    }
+
+    void InputRecorder::recordAddFloatingFrameWithBrick(Layout const * pLayout, std::string filepath, float relativePositionX, float relativePositionY, float relativeSizeX, float relativeSizeY, const std::map<std::string, std::string>& rIdMapper, bool visible, bool fade)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::ADD_FLOATING_FRAME_WITH_BRICK);
+        writeLayout(pLayout);
+        writeString(filepath);
+        writeFloat(relativePositionX);
+        writeFloat(relativePositionY);
+        writeFloat(relativeSizeX);
+        writeFloat(relativeSizeY);
+        writeIdMapper(rIdMapper);
+        writeBool(visible);
+        writeBool(fade);
+    }
+
+    void InputRecorder::recordSetVisibilityOfFloatingFrame(Layout const * pLayout, unsigned int frameIndex, bool visible, bool reset, bool fade)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_VISIBILITY_OF_FLOATING_FRAME);
+        writeLayout(pLayout);
+        writeUInt(frameIndex);
+        writeBool(visible);
+        writeBool(reset);
+        writeBool(fade);
+    }
+
+    void InputRecorder::recordRemoveFloatingFrame(Layout const * pLayout, unsigned int frameIndex, bool fade)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::REMOVE_FLOATING_FRAME);
+        writeLayout(pLayout);
+        writeUInt(frameIndex);
+        writeBool(fade);
+    }
+
+    void InputRecorder::recordSetPositionOfFloatingFrame(Layout const * pLayout, unsigned int frameIndex, float relativePositionX, float relativePositionY)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_POSITION_OF_FLOATING_FRAME);
+        writeLayout(pLayout);
+        writeUInt(frameIndex);
+        writeFloat(relativePositionX);
+        writeFloat(relativePositionY);
+    }
+
+    void InputRecorder::recordSetSizeOfFloatingFrame(Layout const * pLayout, unsigned int frameIndex, float relativeSizeX, float relativeSizeY)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SET_SIZE_OF_FLOATING_FRAME);
+        writeLayout(pLayout);
+        writeUInt(frameIndex);
+        writeFloat(relativeSizeX);
+        writeFloat(relativeSizeY);
+    }
+
+    void InputRecorder::recordTranslateFloatingFrame(Layout const * pLayout, unsigned int frameIndex, float translateX, float translateY)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::TRANSLATE_FLOATING_FRAME);
+        writeLayout(pLayout);
+        writeUInt(frameIndex);
+        writeFloat(translateX);
+        writeFloat(translateY);
+    }
+
+    void InputRecorder::recordScaleFloatingFrame(Layout const * pLayout, unsigned int frameIndex, float scaleX, float scaleY)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(InputRecordType::SCALE_FLOATING_FRAME);
+        writeLayout(pLayout);
+        writeUInt(frameIndex);
+        writeFloat(scaleX);
+        writeFloat(scaleY);
+    }
+
+    void InputRecorder::recordMoveFloatingFrame(Layout const * pLayout, unsigned int frameIndex, bool toFront)
+    {
+        if (!isRecording())
+        {
+            return;
+        }
+
+        writeType(toFront ? InputRecordType::MOVE_FLOATING_FRAME_TO_FRONT : InputRecordType::MOVE_FLOATING_FRAME_TO_BACK);
+        writeLayout(pLayout);
+        writeUInt(frameIndex);
+    }
+
+    void InputRecorder::writeType(InputRecordType type)
+    {
+        unsigned char value = (unsigned char)type;
+        mFile.write((const char*)&value, sizeof(value));
+    }
+
+    void InputRecorder::writeInt(int value)
+    {
+        mFile.write((const char*)&value, sizeof(value));
+    }
+
+    void InputRecorder::writeUInt(unsigned int value)
+    {
+        mFile.write((const char*)&value, sizeof(value));
+    }
+
+    void InputRecorder::writeFloat(float value)
+    {
+        mFile.write((const char*)&value, sizeof(value));
+    }
+
+    void InputRecorder::writeDouble(double value)
+    {
+        mFile.write((const char*)&value, sizeof(value));
+    }
+
+    void InputRecorder::writeBool(bool value)
+    {
+        unsigned char byte = value ? 1 : 0;
+        mFile.write((const char*)&byte, sizeof(byte));
+    }
+
+    void InputRecorder::writeString(const std::string& rValue)
+    {
+        writeUInt((unsigned int)rValue.size());
+        mFile.write(rValue.data(), rValue.size());
+    }
+
+    void InputRecorder::writeLayout(Layout const * pLayout)
+    {
+        // Layouts added before recording are unknown
+        auto it = mLayoutIndices.find(pLayout);
+        if (it != mLayoutIndices.end())
+        {
+            writeInt(it->second);
+        }
+        else
+        {
+            writeInt(-1);
+        }
+    }
+
+    void InputRecorder::writeIdMapper(const std::map<std::string, std::string>& rIdMapper)
+    {
+        writeUInt((unsigned int)rIdMapper.size());
+        for (const auto& rPair : rIdMapper)
+        {
+            writeString(rPair.first);
+            writeString(rPair.second);
+        }
+    }
+}
@@ -0,0 +1,222 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Records input, time per frame and calls of interface into a compact binary
+// log, which can be replayed by the replay tool. Layouts are referenced by the
+// order they were added. All records start with their type as one byte, all
+// strings are stored as 32 bit length followed by utf-8 bytes. Only used by
+// main thread, gaze samples are recorded when consumed by update. If no file
+// is opened, all calls return immediately.
+
+#ifndef INPUT_RECORDER_H_
+#define INPUT_RECORDER_H_
+
+#include "include/eyeGUI.h"
+
+#include <fstream>
+#include <map>
+#include <string>
+
+namespace eyegui
+{
+    // Identification of log files
+    static const unsigned int INPUT_LOG_MAGIC = 0x4C524745; // "EGRL"
+    static const unsigned int INPUT_LOG_VERSION = 2;
+
+    // Types of records
+    enum class InputRecordType : unsigned char
+    {
+        UPDATE,
+        GAZE_SAMPLE,
+        DRAW,
+        RESIZE,
+        ADD_LAYOUT,
+        REMOVE_LAYOUT,
+        LOAD_CONFIG,
+        SET_VALUE_OF_CONFIG_ATTRIBUTE,
+        SET_GAZE_VISUALIZATION_DRAWING,
+        PREFETCH_IMAGE,
+        MOVE_LAYOUT_TO_FRONT,
+        MOVE_LAYOUT_TO_BACK,
+        SET_INPUT_USAGE_OF_LAYOUT,
+        SET_VISIBILITY_OF_LAYOUT,
+        SET_ELEMENT_ACTIVITY,
+        SET_CONTENT_OF_TEXT_BLOCK,
+        SET_KEY_OF_TEXT_BLOCK,
+        HIT_BUTTON,
+        PENETRATE_SENSOR,
+        REPLACE_ELEMENT_WITH_BRICK,
+        ADD_FLOATING_FRAME_WITH_BRICK,
+        SET_VISIBILITY_OF_FLOATING_FRAME,
+        REMOVE_FLOATING_FRAME,
+        SET_POSITION_OF_FLOATING_FRAME,
+        SET_SIZE_OF_FLOATING_FRAME,
+        SWITCH_LOCALIZATION,
+        INVALIDATE_BRICK,
+        INVALIDATE_ALL_BRICKS,
+        SET_PROFILING,
+        SET_LAYER_CACHING,
+        SET_PARTIAL_REDRAW,
+        SET_RENDER_SNAPSHOTS,
+        SET_PARALLEL_UPDATE,
+        SET_ELEMENT_DIMMING,
+        SET_ELEMENT_MARKING,
+        SET_STYLE_OF_ELEMENT,
+        SET_ELEMENT_HIDING,
+        HIGHLIGHT_INTERACTIVE_ELEMENT,
+        SET_VALUE_OF_STYLE_ATTRIBUTE,
+        SET_ICON_OF_ICON_INTERACTIVE_ELEMENT,
+        INTERACT_WITH_INTERACTIVE_ELEMENT,
+        SELECT_INTERACTIVE_ELEMENT,
+        DESELECT_INTERACTIVE_ELEMENT,
+        INTERACT_WITH_SELECTED_INTERACTIVE_ELEMENT,
+        SELECT_NEXT_INTERACTIVE_ELEMENT,
+        BUTTON_DOWN,
+        BUTTON_UP,
+        SET_FAST_TYPING_OF_KEYBOARD,
+        SET_CASE_OF_KEYBOARD,
+        SET_KEYMAP_OF_KEYBOARD,
+        REPLACE_ELEMENT_WITH_BLOCK,
+        REPLACE_ELEMENT_WITH_PICTURE,
+        REPLACE_ELEMENT_WITH_BLANK,
+        REPLACE_ELEMENT_WITH_CIRCLE_BUTTON,
+        REPLACE_ELEMENT_WITH_BOX_BUTTON,
+        REPLACE_ELEMENT_WITH_SENSOR,
+        REPLACE_ELEMENT_WITH_TEXT_BLOCK,
+        TRANSLATE_FLOATING_FRAME,
+        SCALE_FLOATING_FRAME,
+        MOVE_FLOATING_FRAME_TO_FRONT,
+        MOVE_FLOATING_FRAME_TO_BACK,
+        INVALIDATE_STYLESHEET,
+        INVALIDATE_ALL_STYLESHEETS,
+        SET_DICTIONARY_OF_KEYBOARD,
+        SET_WORD_OF_KEYBOARD,
+        SET_CONTENT_OF_TEXT_EDIT,
+        ADD_CONTENT_AT_CURSOR_IN_TEXT_EDIT,
+        DELETE_CONTENT_AT_CURSOR_IN_TEXT_EDIT,
+        MOVE_CURSOR_OVER_LETTERS_IN_TEXT_EDIT,
+        MOVE_CURSOR_OVER_LINES_IN_TEXT_EDIT
+    };
+
+    class InputRecorder
+    {
+    public:
+
+        // Constructor
+        InputRecorder();
+
+        // Destructor
+        virtual ~InputRecorder();
+
+        // Open file and write header with values used to create GUI
+        void open(
+            std::string filepath,
+            int width,
+            int height,
+            std::string fontFilepath,
+            CharacterSet characterSet,
+            std::string localizationFilepath,
+            float vectorGraphicsDPI,
+            float fontTallSize,
+            float fontMediumSize,
+            float fontSmallSize);
+
+        // Is file opened
+        bool isRecording() const;
+
+        // Records of GUI
+        void recordUpdate(float tpf, const Input& rInput);
+        void recordGazeSample(float gazeX, float gazeY, double timestamp);
+        void recordDraw();
+        void recordResize(int width, int height);
+        void recordAddLayout(Layout const * pLayout, std::string filepath, bool visible);
+        void recordRemoveLayout(Layout const * pLayout);
+        void recordLoadConfig(std::string filepath);
+        void recordSwitchLocalization(std::string filepath);
+        void recordSetValueOfConfigAttribute(std::string attribute, std::string value);
+        void recordSetGazeVisualizationDrawing(bool draw);
+        void recordPrefetchImage(std::string filepath);
+        void recordMoveLayout(Layout const * pLayout, bool toFront);
+        void recordInvalidateBrick(std::string filepath);
+        void recordInvalidateAllBricks();
+        void recordInvalidateStylesheet(std::string filepath);
+        void recordInvalidateAllStylesheets();
+        void recordSetProfiling(bool enabled, bool gpuTiming);
+        void recordSetLayerCaching(bool enabled);
+        void recordSetPartialRedraw(bool enabled);
+        void recordSetRenderSnapshots(bool enabled);
+        void recordSetParallelUpdate(bool enabled);
+
+        // Records of layouts
+        void recordSetInputUsageOfLayout(Layout const * pLayout, bool useInput);
+        void recordSetVisibilityOfLayout(Layout const * pLayout, bool visible, bool reset, bool fade);
+        void recordSetElementActivity(Layout const * pLayout, std::string id, bool active, bool fade);
+        void recordSetElementDimming(Layout const * pLayout, std::string id, bool dimming);
+        void recordSetElementMarking(Layout const * pLayout, std::string id, bool marking, int depth);
+        void recordSetStyleOfElement(Layout const * pLayout, std::string id, std::string style);
+        void recordSetElementHiding(Layout const * pLayout, std::string id, bool hidden);
+        void recordHighlightInteractiveElement(Layout const * pLayout, std::string id, bool doHighlight);
+        void recordSetValueOfStyleAttribute(Layout const * pLayout, std::string styleName, std::string attribute, float r, float g, float b, float a);
+        void recordSetIconOfIconInteractiveElement(Layout const * pLayout, std::string id, std::string iconFilepath);
+        void recordInteractWithInteractiveElement(Layout const * pLayout, std::string id);
+        void recordSelectInteractiveElement(Layout const * pLayout, std::string id);
+        void recordDeselectInteractiveElement(Layout const * pLayout);
+        void recordInteractWithSelectedInteractiveElement(Layout const * pLayout);
+        void recordSelectNextInteractiveElement(Layout const * pLayout);
+        void recordSetContentOfTextBlock(Layout const * pLayout, std::string id, std::string content);
+        void recordSetKeyOfTextBlock(Layout const * pLayout, std::string id, std::string key);
+        void recordSetContentOfTextEdit(Layout const * pLayout, std::string id, std::string content);
+        void recordAddContentAtCursorInTextEdit(Layout const * pLayout, std::string id, std::string content);
+        void recordDeleteContentAtCursorInTextEdit(Layout const * pLayout, std::string id, int letterCount);
+        void recordMoveCursorOverLettersInTextEdit(Layout const * pLayout, std::string id, int letterCount);
+        void recordMoveCursorOverLinesInTextEdit(Layout const * pLayout, std::string id, int lineCount);
+        void recordHitButton(Layout const * pLayout, std::string id);
+        void recordButtonDown(Layout const * pLayout, std::string id, bool immediately);
+        void recordButtonUp(Layout const * pLayout, std::string id, bool immediately);
+        void recordPenetrateSensor(Layout const * pLayout, std::string id, float amount);
+        void recordSetFastTypingOfKeyboard(Layout const * pLayout, std::string id, bool useFastTyping);
+        void recordSetCaseOfKeyboard(Layout const * pLayout, std::string id, KeyboardCase keyboardCase);
+        void recordSetKeymapOfKeyboard(Layout const * pLayout, std::string id, unsigned int keymapIndex);
+        void recordSetDictionaryOfKeyboard(Layout const * pLayout, std::string id, std::string filepath);
+        void recordSetWordOfKeyboard(Layout const * pLayout, std::string id, std::string word);
+        void recordReplaceElementWithBlock(Layout const * pLayout, std::string id, bool consumeInput, std::string backgroundFilepath, ImageAlignment backgroundAlignment, bool fade);
+        void recordReplaceElementWithPicture(Layout const * pLayout, std::string id, std::string filepath, ImageAlignment alignment, bool fade);
+        void recordReplaceElementWithBlank(Layout const * pLayout, std::string id, bool fade);
+        void recordReplaceElementWithCircleButton(Layout const * pLayout, std::string id, std::string iconFilepath, bool isSwitch, bool fade);
+        void recordReplaceElementWithBoxButton(Layout const * pLayout, std::string id, std::string iconFilepath, bool isSwitch, bool fade);
+        void recordReplaceElementWithSensor(Layout const * pLayout, std::string id, std::string iconFilepath, bool fade);
+        void recordReplaceElementWithTextBlock(Layout const * pLayout, std::string id, bool consumeInput, FontSize fontSize, TextFlowAlignment alignment, TextFlowVerticalAlignment verticalAlignment, std::string content, float innerBorder, float textScale, std::string key, std::string backgroundFilepath, ImageAlignment backgroundAlignment, bool fade);
+        void recordReplaceElementWithBrick(Layout const * pLayout, std::string id, std::string filepath, const std::map<std::string, std::string>& rIdMapper, bool fade);
+        void recordAddFloatingFrameWithBrick(Layout const * pLayout, std::string filepath, float relativePositionX, float relativePositionY, float relativeSizeX, float relativeSizeY, const std::map<std::string, std::string>& rIdMapper, bool visible, bool fade);
+        void recordSetVisibilityOfFloatingFrame(Layout const * pLayout, unsigned int frameIndex, bool visible, bool reset, bool fade);
+        void recordRemoveFloatingFrame(Layout const * pLayout, unsigned int frameIndex, bool fade);
+        void recordSetPositionOfFloatingFrame(Layout const * pLayout, unsigned int frameIndex, float relativePositionX, float relativePositionY);
+        void recordSetSizeOfFloatingFrame(Layout const * pLayout, unsigned int frameIndex, float relativeSizeX, float relativeSizeY);
+        void recordTranslateFloatingFrame(Layout const * pLayout, unsigned int frameIndex, float translateX, float translateY);
+        void recordScaleFloatingFrame(Layout const * pLayout, unsigned int frameIndex, float scaleX, float scaleY);
+        void recordMoveFloatingFrame(Layout const * pLayout, unsigned int frameIndex, bool toFront);
+
+    private:
+
+        // Writing of values
+        void writeType(InputRecordType type);
+        void writeInt(int value);
+        void writeUInt(unsigned int value);
+        void writeFloat(float value);
+        void writeDouble(double value);
+        void writeBool(bool value);
+        void writeString(const std::string& rValue);
+        void writeLayout(Layout const * pLayout);
+        void writeIdMapper(const std::map<std::string, std::string>& rIdMapper);
+
+        // Members
+        std::ofstream mFile;
+        std::map<Layout const *, int> mLayoutIndices;
+        int mAddedLayoutCount;
+    };
+}
+
+#endif // INPUT_RECORDER_H_
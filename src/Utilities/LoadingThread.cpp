@@ -0,0 +1,60 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "LoadingThread.h"
+
+namespace eyegui
+{
+    LoadingThread::LoadingThread()
+    {
+        // Initialize members
+        mShutdown = false;
+        mThread = std::thread(&LoadingThread::loop, this);
+    }
+
+    LoadingThread::~LoadingThread()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mShutdown = true;
+            mTasks.clear();
+        }
+        mCondition.notify_all();
+        mThread.join();
+    }
+
+    void LoadingThread::enqueue(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mTasks.push_back(std::move(task));
+        }
+        mCondition.notify_one();
+    }
+
+    void LoadingThread::loop()
+    {
+        while (true)
+        {
+            // Wait for task
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mCondition.wait(lock, [this] { return mShutdown || !mTasks.empty(); });
+                if (mShutdown)
+                {
+                    return;
+                }
+                task = std::move(mTasks.front());
+                mTasks.pop_front();
+            }
+
+            // Execute it without holding lock
+            task();
+        }
+    }
+}
@@ -0,0 +1,49 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Single background thread executing tasks in order of enqueueing, e.g. file
+// reading, compiling and image decoding of asynchronous loading. Tasks must
+// not use OpenGL. Tasks not started yet are dropped at destruction.
+
+#ifndef LOADING_THREAD_H_
+#define LOADING_THREAD_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace eyegui
+{
+    class LoadingThread
+    {
+    public:
+
+        // Constructor, starts thread
+        LoadingThread();
+
+        // Destructor, waits for current task
+        virtual ~LoadingThread();
+
+        // Enqueue task
+        void enqueue(std::function<void()> task);
+
+    private:
+
+        // Loop of thread
+        void loop();
+
+        // Members
+        std::deque<std::function<void()> > mTasks;
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        bool mShutdown;
+        std::thread mThread;
+    };
+}
+
+#endif // LOADING_THREAD_H_
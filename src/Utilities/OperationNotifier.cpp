@@ -10,4 +10,6 @@
 namespace eyegui
 {
 	OperationNotifier* OperationNotifier::pInstance = NULL;
+	std::atomic<unsigned int> OperationNotifier::errorCount(0);
+	thread_local std::vector<OperationNotifier::Notification>* OperationNotifier::pCollection = NULL;
 }
@@ -12,7 +12,9 @@
 
 #include "PathBuilder.h"
 
+#include <atomic>
 #include <string>
+#include <vector>
 
 // Defines for easier use
 #define throwError eyegui::OperationNotifier::notifyAboutError
@@ -27,16 +29,68 @@ namespace eyegui
         // Enumeration of operations which could occur
         enum class Operation { PARSING, IMAGE_LOADING, FONT_LOADING, RUNTIME, BUG };
 
-        // Send error to callback
+        // Notification collected on background thread
+        struct Notification
+        {
+            bool error;
+            std::string content;
+        };
+
+        // Send error to callback or collect it
         static void notifyAboutError(Operation operation, std::string message = "", std::string filepath = "")
         {
-            getInstance()->callbackError(operation, message, filepath);
+            errorCount++;
+            if (pCollection != NULL)
+            {
+                pCollection->push_back({ true, getInstance()->buildContent(Type::ERROR_CALLBACK, operation, message, filepath) });
+            }
+            else
+            {
+                getInstance()->callbackError(operation, message, filepath);
+            }
         }
 
-        // Send warning to callback
+        // Send warning to callback or collect it
         static void notifyAboutWarning(Operation operation, std::string message = "", std::string filepath = "")
         {
-            getInstance()->callbackWarning(operation, message, filepath);
+            if (pCollection != NULL)
+            {
+                pCollection->push_back({ false, getInstance()->buildContent(Type::WARNING_CALLBACK, operation, message, filepath) });
+            }
+            else
+            {
+                getInstance()->callbackWarning(operation, message, filepath);
+            }
+        }
+
+        // Collect notifications of calling thread instead of sending them, NULL stops collecting.
+        // Used by background threads, so callbacks of user are only called by updating thread
+        static void collectNotifications(std::vector<Notification>* pNotifications)
+        {
+            pCollection = pNotifications;
+        }
+
+        // Send collected notifications to callbacks, errors are already counted
+        static void emitNotifications(const std::vector<Notification>& rNotifications)
+        {
+            OperationNotifier* pNotifier = getInstance();
+            for (const Notification& rNotification : rNotifications)
+            {
+                if (rNotification.error && pNotifier->mErrorCallbackSet)
+                {
+                    pNotifier->mpErrorCallbackFunction(rNotification.content);
+                }
+                else if (!rNotification.error && pNotifier->mWarningCallbackSet)
+                {
+                    pNotifier->mpWarningCallbackFunction(rNotification.content);
+                }
+            }
+        }
+
+        // Get count of errors so far, used to detect errors of an operation
+        static unsigned int getErrorCount()
+        {
+            return errorCount;
         }
 
         // Set function to call back
@@ -165,6 +219,12 @@ namespace eyegui
         // The pointer to the single instance
         static OperationNotifier* pInstance;
 
+        // Count of errors
+        static std::atomic<unsigned int> errorCount;
+
+        // Collection of calling thread, NULL when notifications are sent
+        static thread_local std::vector<Notification>* pCollection;
+
         // Member
         bool mErrorCallbackSet;
         bool mWarningCallbackSet;
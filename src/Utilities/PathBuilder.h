@@ -31,6 +31,12 @@ namespace eyegui
             return getInstance()->internalBuildFullFilepath(filepath);
         }
 
+        // Get root filepath
+        static std::string getRootFilepath()
+        {
+            return rootFilepath;
+        }
+
     private:
 
         // Check for instance existence
@@ -0,0 +1,407 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "PieceTable.h"
+
+#include <algorithm>
+
+namespace eyegui
+{
+    // Index of no node
+    static const uint32_t NO_NODE = 0xFFFFFFFF;
+
+    PieceTable::PieceTable(std::u16string content)
+    {
+        // Fixed seed, so structure of tree is reproducible
+        mRandom = 2463534242;
+        mRoot = NO_NODE;
+        setContent(content);
+    }
+
+    PieceTable::~PieceTable()
+    {
+        // Nothing to do
+    }
+
+    void PieceTable::setContent(std::u16string content)
+    {
+        // Forget everything
+        mNodes.clear();
+        mFreeNodes.clear();
+        mAdded.clear();
+        mOriginal = std::move(content);
+        mRoot = NO_NODE;
+
+        // Short pieces keep splitting cheap
+        for (size_t start = 0; start < mOriginal.size(); start += PIECE_TABLE_MAX_PIECE_LENGTH)
+        {
+            uint32_t length = (uint32_t)std::min(mOriginal.size() - start, (size_t)PIECE_TABLE_MAX_PIECE_LENGTH);
+            mRoot = merge(mRoot, createNode(Buffer::ORIGINAL, (uint32_t)start, length));
+        }
+    }
+
+    void PieceTable::insert(uint position, const std::u16string& rText)
+    {
+        if (rText.empty())
+        {
+            return;
+        }
+        position = std::min(position, getLength());
+
+        uint32_t left, right;
+        split(mRoot, position, left, right);
+
+        // Typing continues last added piece instead of creating a new one
+        uint32_t appendStart = (uint32_t)mAdded.size();
+        uint32_t newlines = (uint32_t)std::count(rText.begin(), rText.end(), u'\n');
+        if (left != NO_NODE && extendLast(left, appendStart, (uint32_t)rText.size(), newlines))
+        {
+            mAdded.append(rText);
+        }
+        else
+        {
+            left = merge(left, appendText(rText));
+        }
+
+        mRoot = merge(left, right);
+    }
+
+    void PieceTable::erase(uint position, uint count)
+    {
+        position = std::min(position, getLength());
+        count = std::min(count, getLength() - position);
+        if (count == 0)
+        {
+            return;
+        }
+
+        uint32_t left, middle, right, rest;
+        split(mRoot, position, left, rest);
+        split(rest, count, middle, right);
+        releaseTree(middle);
+        mRoot = merge(left, right);
+    }
+
+    uint PieceTable::getLength() const
+    {
+        return getSubtreeLength(mRoot);
+    }
+
+    uint PieceTable::getLineCount() const
+    {
+        return getSubtreeNewlines(mRoot) + 1;
+    }
+
+    uint PieceTable::getLineStart(uint line) const
+    {
+        if (line == 0)
+        {
+            return 0;
+        }
+        if (line >= getLineCount())
+        {
+            return getLength();
+        }
+
+        // Search newline ending previous line
+        uint32_t remaining = line;
+        uint32_t offset = 0;
+        uint32_t node = mRoot;
+        while (node != NO_NODE)
+        {
+            const Node& rNode = mNodes[node];
+            uint32_t leftNewlines = getSubtreeNewlines(rNode.left);
+            if (remaining <= leftNewlines)
+            {
+                node = rNode.left;
+                continue;
+            }
+            remaining -= leftNewlines;
+            offset += getSubtreeLength(rNode.left);
+
+            if (remaining <= rNode.newlines)
+            {
+                const std::u16string& rBuffer = getBuffer(rNode.buffer);
+                for (uint32_t i = 0; i < rNode.length; i++)
+                {
+                    if (rBuffer[rNode.start + i] == u'\n' && --remaining == 0)
+                    {
+                        return offset + i + 1;
+                    }
+                }
+            }
+            remaining -= rNode.newlines;
+            offset += rNode.length;
+            node = rNode.right;
+        }
+        return getLength();
+    }
+
+    uint PieceTable::getLineOfPosition(uint position) const
+    {
+        position = std::min(position, getLength());
+
+        // Count newlines in front of position
+        uint32_t line = 0;
+        uint32_t node = mRoot;
+        while (node != NO_NODE)
+        {
+            const Node& rNode = mNodes[node];
+            uint32_t leftLength = getSubtreeLength(rNode.left);
+            if (position <= leftLength)
+            {
+                node = rNode.left;
+                continue;
+            }
+            line += getSubtreeNewlines(rNode.left);
+            position -= leftLength;
+
+            if (position <= rNode.length)
+            {
+                return line + countNewlines(rNode.buffer, rNode.start, position);
+            }
+            line += rNode.newlines;
+            position -= rNode.length;
+            node = rNode.right;
+        }
+        return line;
+    }
+
+    std::u16string PieceTable::getText(uint position, uint count) const
+    {
+        position = std::min(position, getLength());
+        count = std::min(count, getLength() - position);
+
+        std::u16string text;
+        text.reserve(count);
+        collect(mRoot, position, count, text);
+        return text;
+    }
+
+    std::u16string PieceTable::getContent() const
+    {
+        return getText(0, getLength());
+    }
+
+    uint32_t PieceTable::createNode(Buffer buffer, uint32_t start, uint32_t length)
+    {
+        uint32_t node;
+        if (mFreeNodes.empty())
+        {
+            node = (uint32_t)mNodes.size();
+            mNodes.push_back(Node());
+        }
+        else
+        {
+            node = mFreeNodes.back();
+            mFreeNodes.pop_back();
+        }
+
+        // Xorshift is enough for balancing
+        mRandom ^= mRandom << 13;
+        mRandom ^= mRandom >> 17;
+        mRandom ^= mRandom << 5;
+
+        Node& rNode = mNodes[node];
+        rNode.left = NO_NODE;
+        rNode.right = NO_NODE;
+        rNode.priority = mRandom;
+        rNode.buffer = buffer;
+        rNode.start = start;
+        rNode.length = length;
+        rNode.newlines = countNewlines(buffer, start, length);
+        update(node);
+        return node;
+    }
+
+    void PieceTable::releaseTree(uint32_t node)
+    {
+        if (node == NO_NODE)
+        {
+            return;
+        }
+        releaseTree(mNodes[node].left);
+        releaseTree(mNodes[node].right);
+        mFreeNodes.push_back(node);
+    }
+
+    void PieceTable::update(uint32_t node)
+    {
+        Node& rNode = mNodes[node];
+        rNode.subtreeLength = getSubtreeLength(rNode.left) + rNode.length + getSubtreeLength(rNode.right);
+        rNode.subtreeNewlines = getSubtreeNewlines(rNode.left) + rNode.newlines + getSubtreeNewlines(rNode.right);
+    }
+
+    void PieceTable::split(uint32_t node, uint32_t position, uint32_t& rLeft, uint32_t& rRight)
+    {
+        if (node == NO_NODE)
+        {
+            rLeft = NO_NODE;
+            rRight = NO_NODE;
+            return;
+        }
+
+        uint32_t leftLength = getSubtreeLength(mNodes[node].left);
+        if (position <= leftLength)
+        {
+            uint32_t rest;
+            split(mNodes[node].left, position, rLeft, rest);
+            mNodes[node].left = rest;
+            update(node);
+            rRight = node;
+        }
+        else if (position >= leftLength + mNodes[node].length)
+        {
+            uint32_t rest;
+            split(mNodes[node].right, position - leftLength - mNodes[node].length, rest, rRight);
+            mNodes[node].right = rest;
+            update(node);
+            rLeft = node;
+        }
+        else
+        {
+            // Position is inside of piece, second part takes right subtree
+            uint32_t offset = position - leftLength;
+            uint32_t second = createNode(
+                mNodes[node].buffer,
+                mNodes[node].start + offset,
+                mNodes[node].length - offset);
+            mNodes[second].priority = mNodes[node].priority;
+            mNodes[second].right = mNodes[node].right;
+            update(second);
+
+            mNodes[node].right = NO_NODE;
+            mNodes[node].length = offset;
+            mNodes[node].newlines -= mNodes[second].newlines;
+            update(node);
+
+            rLeft = node;
+            rRight = second;
+        }
+    }
+
+    uint32_t PieceTable::merge(uint32_t left, uint32_t right)
+    {
+        if (left == NO_NODE)
+        {
+            return right;
+        }
+        if (right == NO_NODE)
+        {
+            return left;
+        }
+
+        if (mNodes[left].priority > mNodes[right].priority)
+        {
+            uint32_t merged = merge(mNodes[left].right, right);
+            mNodes[left].right = merged;
+            update(left);
+            return left;
+        }
+        else
+        {
+            uint32_t merged = merge(left, mNodes[right].left);
+            mNodes[right].left = merged;
+            update(right);
+            return right;
+        }
+    }
+
+    uint32_t PieceTable::appendText(const std::u16string& rText)
+    {
+        uint32_t tree = NO_NODE;
+        for (size_t offset = 0; offset < rText.size(); offset += PIECE_TABLE_MAX_PIECE_LENGTH)
+        {
+            uint32_t length = (uint32_t)std::min(rText.size() - offset, (size_t)PIECE_TABLE_MAX_PIECE_LENGTH);
+            uint32_t start = (uint32_t)mAdded.size();
+            mAdded.append(rText, offset, length);
+            tree = merge(tree, createNode(Buffer::ADDED, start, length));
+        }
+        return tree;
+    }
+
+    bool PieceTable::extendLast(uint32_t node, uint32_t appendStart, uint32_t length, uint32_t newlines)
+    {
+        Node& rNode = mNodes[node];
+        if (rNode.right != NO_NODE)
+        {
+            if (!extendLast(rNode.right, appendStart, length, newlines))
+            {
+                return false;
+            }
+        }
+        else if (rNode.buffer == Buffer::ADDED
+            && rNode.start + rNode.length == appendStart
+            && rNode.length + length <= PIECE_TABLE_MAX_PIECE_LENGTH)
+        {
+            rNode.length += length;
+            rNode.newlines += newlines;
+        }
+        else
+        {
+            return false;
+        }
+
+        rNode.subtreeLength += length;
+        rNode.subtreeNewlines += newlines;
+        return true;
+    }
+
+    void PieceTable::collect(uint32_t node, uint32_t position, uint32_t count, std::u16string& rText) const
+    {
+        if (node == NO_NODE || count == 0)
+        {
+            return;
+        }
+
+        const Node& rNode = mNodes[node];
+        uint32_t leftLength = getSubtreeLength(rNode.left);
+        uint32_t end = position + count;
+
+        // Characters in left subtree
+        if (position < leftLength)
+        {
+            collect(rNode.left, position, std::min(end, leftLength) - position, rText);
+        }
+
+        // Characters of own piece
+        uint32_t pieceEnd = leftLength + rNode.length;
+        uint32_t begin = std::max(position, leftLength);
+        if (begin < std::min(end, pieceEnd))
+        {
+            rText.append(getBuffer(rNode.buffer), rNode.start + (begin - leftLength), std::min(end, pieceEnd) - begin);
+        }
+
+        // Characters in right subtree
+        if (end > pieceEnd)
+        {
+            begin = std::max(position, pieceEnd);
+            collect(rNode.right, begin - pieceEnd, end - begin, rText);
+        }
+    }
+
+    const std::u16string& PieceTable::getBuffer(Buffer buffer) const
+    {
+        return buffer == Buffer::ORIGINAL ? mOriginal : mAdded;
+    }
+
+    uint32_t PieceTable::countNewlines(Buffer buffer, uint32_t start, uint32_t length) const
+    {
+        const std::u16string& rBuffer = getBuffer(buffer);
+        return (uint32_t)std::count(rBuffer.begin() + start, rBuffer.begin() + start + length, u'\n');
+    }
+
+    uint32_t PieceTable::getSubtreeLength(uint32_t node) const
+    {
+        return node == NO_NODE ? 0 : mNodes[node].subtreeLength;
+    }
+
+    uint32_t PieceTable::getSubtreeNewlines(uint32_t node) const
+    {
+        return node == NO_NODE ? 0 : mNodes[node].subtreeNewlines;
+    }
+}
@@ -0,0 +1,126 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Text buffer for editing. Text is never moved, pieces reference ranges of
+// the original content or of an append-only buffer of added text. Pieces are
+// kept in a randomized balanced tree ordered by position, each node knows
+// length and count of newlines of its subtree. So inserting, erasing and
+// finding lines take logarithmic time in count of pieces.
+
+#ifndef PIECE_TABLE_H_
+#define PIECE_TABLE_H_
+
+#include "Defines.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace eyegui
+{
+    class PieceTable
+    {
+    public:
+
+        // Constructor
+        PieceTable(std::u16string content = u"");
+
+        // Destructor
+        virtual ~PieceTable();
+
+        // Replace whole content
+        void setContent(std::u16string content);
+
+        // Insert text in front of character at position
+        void insert(uint position, const std::u16string& rText);
+
+        // Erase count of characters starting at position
+        void erase(uint position, uint count);
+
+        // Get count of characters
+        uint getLength() const;
+
+        // Get count of lines separated by newlines, at least one
+        uint getLineCount() const;
+
+        // Get position of first character of line, length if line does not exist
+        uint getLineStart(uint line) const;
+
+        // Get line which contains character at position
+        uint getLineOfPosition(uint position) const;
+
+        // Get count of characters starting at position
+        std::u16string getText(uint position, uint count) const;
+
+        // Get whole content
+        std::u16string getContent() const;
+
+    private:
+
+        // Buffer referenced by piece
+        enum class Buffer : uint8_t { ORIGINAL, ADDED };
+
+        // Node of tree with one piece
+        struct Node
+        {
+            uint32_t left;
+            uint32_t right;
+            uint32_t priority; // higher than priorities of subtree
+            Buffer buffer;
+            uint32_t start;
+            uint32_t length;
+            uint32_t newlines;
+            uint32_t subtreeLength;
+            uint32_t subtreeNewlines;
+        };
+
+        // Create node for piece, reuses free nodes
+        uint32_t createNode(Buffer buffer, uint32_t start, uint32_t length);
+
+        // Release node and its subtree
+        void releaseTree(uint32_t node);
+
+        // Update values of subtree from children
+        void update(uint32_t node);
+
+        // Split tree in first count of characters and rest, pieces are split if necessary
+        void split(uint32_t node, uint32_t position, uint32_t& rLeft, uint32_t& rRight);
+
+        // Merge trees where all characters of left one are in front of right one
+        uint32_t merge(uint32_t left, uint32_t right);
+
+        // Create tree of pieces for text appended to added buffer
+        uint32_t appendText(const std::u16string& rText);
+
+        // Try to extend last piece of tree by characters just appended to added buffer
+        bool extendLast(uint32_t node, uint32_t appendStart, uint32_t length, uint32_t newlines);
+
+        // Append characters of range in tree to text
+        void collect(uint32_t node, uint32_t position, uint32_t count, std::u16string& rText) const;
+
+        // Get characters of buffer
+        const std::u16string& getBuffer(Buffer buffer) const;
+
+        // Count newlines in range of buffer
+        uint32_t countNewlines(Buffer buffer, uint32_t start, uint32_t length) const;
+
+        // Get length of subtree, zero for no node
+        uint32_t getSubtreeLength(uint32_t node) const;
+
+        // Get newlines of subtree, zero for no node
+        uint32_t getSubtreeNewlines(uint32_t node) const;
+
+        // Members
+        std::u16string mOriginal;
+        std::u16string mAdded;
+        std::vector<Node> mNodes;
+        std::vector<uint32_t> mFreeNodes;
+        uint32_t mRoot;
+        uint32_t mRandom;
+    };
+}
+
+#endif // PIECE_TABLE_H_
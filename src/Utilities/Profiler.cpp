@@ -0,0 +1,226 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "Profiler.h"
+
+#include "src/Defines.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace eyegui
+{
+    Profiler::Profiler()
+    {
+        // Initialize members
+        mEnabled = false;
+        mGPUTiming = false;
+        mFrameRunning = false;
+        std::fill(mCurrent, mCurrent + PROFILE_PHASE_COUNT, 0.0);
+        mCurrentGPUTimed = false;
+        mCurrentPendingQueries = 0;
+        mFrames.resize(PROFILER_FRAME_COUNT);
+        mFrameSerial = 0;
+        mFrameCount = 0;
+        mQueryRunning = false;
+        mRunningQuery = 0;
+    }
+
+    Profiler::~Profiler()
+    {
+        // Delete all timer queries
+        for (const PendingQuery& rPending : mPendingQueries)
+        {
+            mFreeQueries.push_back(rPending.query);
+        }
+        if (!mFreeQueries.empty())
+        {
+            glDeleteQueries((GLsizei)mFreeQueries.size(), mFreeQueries.data());
+        }
+    }
+
+    void Profiler::setEnabled(bool enabled, bool gpuTiming)
+    {
+#ifndef EYEGUI_PROFILING
+        // Timers are not compiled in
+        enabled = false;
+#endif
+
+        // Start with empty ring when enabled again
+        if (enabled && !mEnabled)
+        {
+            mFrameCount = 0;
+            mFrameRunning = false;
+        }
+
+        mEnabled = enabled;
+        mGPUTiming = gpuTiming;
+    }
+
+    bool Profiler::isEnabled() const
+    {
+        return mEnabled;
+    }
+
+    void Profiler::beginFrame()
+    {
+        if (!mEnabled)
+        {
+            return;
+        }
+
+        // Results of previous frames
+        collectQueries();
+
+        // Store current frame in ring
+        if (mFrameRunning)
+        {
+            ProfileFrame& rFrame = mFrames[mFrameSerial % mFrames.size()];
+            for (int i = 0; i < PROFILE_PHASE_COUNT; i++)
+            {
+                rFrame.durations[i] = (float)mCurrent[i];
+            }
+            rFrame.gpuTimed = mCurrentGPUTimed;
+            rFrame.pendingQueries = mCurrentPendingQueries;
+            mFrameSerial++;
+            mFrameCount = std::min(mFrameCount + 1, (unsigned int)mFrames.size());
+        }
+
+        // Begin next frame
+        std::fill(mCurrent, mCurrent + PROFILE_PHASE_COUNT, 0.0);
+        mCurrentGPUTimed = false;
+        mCurrentPendingQueries = 0;
+        mFrameRunning = true;
+    }
+
+    void Profiler::addTime(ProfilePhase phase, double milliseconds)
+    {
+        mCurrent[(int)phase] += milliseconds;
+    }
+
+    void Profiler::beginGPUTiming()
+    {
+        if (!mEnabled || !mGPUTiming || !mFrameRunning || mQueryRunning)
+        {
+            return;
+        }
+
+        // Reuse query if possible
+        if (mFreeQueries.empty())
+        {
+            glGenQueries(1, &mRunningQuery);
+        }
+        else
+        {
+            mRunningQuery = mFreeQueries.back();
+            mFreeQueries.pop_back();
+        }
+
+        glBeginQuery(GL_TIME_ELAPSED, mRunningQuery);
+        mQueryRunning = true;
+    }
+
+    void Profiler::endGPUTiming()
+    {
+        if (!mQueryRunning)
+        {
+            return;
+        }
+
+        glEndQuery(GL_TIME_ELAPSED);
+        mQueryRunning = false;
+
+        // Result is read back in one of the next frames
+        PendingQuery pending;
+        pending.query = mRunningQuery;
+        pending.frameSerial = mFrameSerial;
+        mPendingQueries.push_back(pending);
+        mCurrentGPUTimed = true;
+        mCurrentPendingQueries++;
+    }
+
+    ProfileStatistics Profiler::getStatistics(ProfilePhase phase) const
+    {
+        ProfileStatistics statistics;
+
+        // Collect durations of stored frames
+        std::vector<float> durations;
+        durations.reserve(mFrameCount);
+        for (unsigned int i = 1; i <= mFrameCount; i++)
+        {
+            const ProfileFrame& rFrame = mFrames[(mFrameSerial - i) % mFrames.size()];
+
+            // Only frames with all results of timer queries
+            if (phase == ProfilePhase::LAYOUT_DRAW_GPU && (!rFrame.gpuTimed || rFrame.pendingQueries > 0))
+            {
+                continue;
+            }
+            durations.push_back(rFrame.durations[(int)phase]);
+        }
+
+        if (durations.empty())
+        {
+            return statistics;
+        }
+
+        // Calculate statistics
+        std::sort(durations.begin(), durations.end());
+        double sum = 0;
+        for (float duration : durations)
+        {
+            sum += duration;
+        }
+        int p99Index = (int)std::ceil(0.99 * durations.size()) - 1;
+        statistics.minimum = durations.front();
+        statistics.mean = (float)(sum / durations.size());
+        statistics.p99 = durations[std::max(p99Index, 0)];
+        statistics.frameCount = (unsigned int)durations.size();
+
+        return statistics;
+    }
+
+    void Profiler::collectQueries()
+    {
+        std::vector<PendingQuery> stillPending;
+        for (const PendingQuery& rPending : mPendingQueries)
+        {
+            // Do not wait for results
+            GLuint available = 0;
+            glGetQueryObjectuiv(rPending.query, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (available == 0)
+            {
+                stillPending.push_back(rPending);
+                continue;
+            }
+
+            // Time in nanoseconds, saturated by 32 bit query when result is invalid or too big
+            GLuint elapsed = 0;
+            glGetQueryObjectuiv(rPending.query, GL_QUERY_RESULT, &elapsed);
+            bool valid = elapsed != std::numeric_limits<GLuint>::max();
+            double milliseconds = elapsed / 1000000.0;
+
+            // Add to frame of query, if still available
+            if (rPending.frameSerial == mFrameSerial && mFrameRunning)
+            {
+                mCurrent[(int)ProfilePhase::LAYOUT_DRAW_GPU] += milliseconds;
+                mCurrentGPUTimed = mCurrentGPUTimed && valid;
+                mCurrentPendingQueries--;
+            }
+            else if (rPending.frameSerial < mFrameSerial && mFrameSerial - rPending.frameSerial <= mFrameCount)
+            {
+                ProfileFrame& rFrame = mFrames[rPending.frameSerial % mFrames.size()];
+                rFrame.durations[(int)ProfilePhase::LAYOUT_DRAW_GPU] += (float)milliseconds;
+                rFrame.gpuTimed = rFrame.gpuTimed && valid;
+                rFrame.pendingQueries--;
+            }
+
+            mFreeQueries.push_back(rPending.query);
+        }
+        mPendingQueries = stillPending;
+    }
+}
@@ -0,0 +1,136 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Frame profiler of GUI. Scoped timers accumulate time per phase, a frame
+// begins with each update of GUI and is pushed into a ring of recent frames.
+// Layout drawing may be measured by OpenGL timer queries, which are read
+// back some frames later to avoid stalls. Timers are compiled in only when
+// EYEGUI_PROFILING is defined and do nothing while profiler is disabled.
+
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+#include "include/eyeGUI.h"
+#include "externals/OpenGLLoader/gl_core_3_3.h"
+
+#include <chrono>
+#include <vector>
+
+// Macro for scoped timer, expands to nothing without profiling
+#ifdef EYEGUI_PROFILING
+#define EYEGUI_PROFILE_CONCAT_INNER(a, b) a##b
+#define EYEGUI_PROFILE_CONCAT(a, b) EYEGUI_PROFILE_CONCAT_INNER(a, b)
+#define EYEGUI_PROFILE_SCOPE(pProfiler, phase) eyegui::ProfileScope EYEGUI_PROFILE_CONCAT(profileScope, __LINE__)(pProfiler, phase)
+#else
+#define EYEGUI_PROFILE_SCOPE(pProfiler, phase)
+#endif
+
+namespace eyegui
+{
+    // Count of phases
+    static const int PROFILE_PHASE_COUNT = (int)ProfilePhase::LAYOUT_DRAW_GPU + 1;
+
+    class Profiler
+    {
+    public:
+
+        // Constructor
+        Profiler();
+
+        // Destructor
+        virtual ~Profiler();
+
+        // Enable or disable
+        void setEnabled(bool enabled, bool gpuTiming);
+
+        // Is enabled
+        bool isEnabled() const;
+
+        // Finish current frame and begin next one
+        void beginFrame();
+
+        // Add time to phase of current frame
+        void addTime(ProfilePhase phase, double milliseconds);
+
+        // Timer query around drawing of one layout
+        void beginGPUTiming();
+        void endGPUTiming();
+
+        // Statistics of phase over recent frames
+        ProfileStatistics getStatistics(ProfilePhase phase) const;
+
+    private:
+
+        // Recorded frame
+        struct ProfileFrame
+        {
+            float durations[PROFILE_PHASE_COUNT];
+            bool gpuTimed;
+            int pendingQueries;
+        };
+
+        // Timer query which result is not yet available
+        struct PendingQuery
+        {
+            GLuint query;
+            unsigned long long frameSerial;
+        };
+
+        // Read back available results of timer queries
+        void collectQueries();
+
+        // Members
+        bool mEnabled;
+        bool mGPUTiming;
+        bool mFrameRunning;
+        double mCurrent[PROFILE_PHASE_COUNT];
+        bool mCurrentGPUTimed;
+        int mCurrentPendingQueries;
+        std::vector<ProfileFrame> mFrames;
+        unsigned long long mFrameSerial; // Serial of current frame, frame is stored at serial modulo count
+        unsigned int mFrameCount; // Count of stored frames
+        std::vector<GLuint> mFreeQueries;
+        std::vector<PendingQuery> mPendingQueries;
+        bool mQueryRunning;
+        GLuint mRunningQuery;
+    };
+
+    // Scoped timer adding its lifetime to phase
+    class ProfileScope
+    {
+    public:
+
+        // Constructor
+        ProfileScope(Profiler* pProfiler, ProfilePhase phase)
+        {
+            mpProfiler = pProfiler->isEnabled() ? pProfiler : NULL;
+            mPhase = phase;
+            if (mpProfiler != NULL)
+            {
+                mStart = std::chrono::steady_clock::now();
+            }
+        }
+
+        // Destructor
+        ~ProfileScope()
+        {
+            if (mpProfiler != NULL)
+            {
+                std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - mStart;
+                mpProfiler->addTime(mPhase, duration.count());
+            }
+        }
+
+    private:
+
+        // Members
+        Profiler* mpProfiler;
+        ProfilePhase mPhase;
+        std::chrono::steady_clock::time_point mStart;
+    };
+}
+
+#endif // PROFILER_H_
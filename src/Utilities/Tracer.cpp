@@ -0,0 +1,183 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "Tracer.h"
+
+#include "src/Defines.h"
+#include "src/Utilities/OperationNotifier.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+
+namespace eyegui
+{
+    Tracer* Tracer::pInstance = NULL;
+
+    namespace
+    {
+        // Write string with escaping of JSON
+        void writeJSONString(std::ofstream& rFile, const std::string& rValue)
+        {
+            rFile << '"';
+            for (char c : rValue)
+            {
+                switch (c)
+                {
+                case '"':
+                    rFile << "\\\"";
+                    break;
+                case '\\':
+                    rFile << "\\\\";
+                    break;
+                case '\n':
+                    rFile << "\\n";
+                    break;
+                case '\t':
+                    rFile << "\\t";
+                    break;
+                default:
+                    if ((unsigned char)c < 0x20)
+                    {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned int)c);
+                        rFile << escaped;
+                    }
+                    else
+                    {
+                        rFile << c;
+                    }
+                }
+            }
+            rFile << '"';
+        }
+    }
+
+    Tracer::Tracer()
+    {
+        // Initialize members
+        mEnabled.store(false);
+        mStartTime = std::chrono::steady_clock::now();
+    }
+
+    void Tracer::internalSetEnabled(bool enabled)
+    {
+        std::lock_guard<std::mutex> lock(mBufferMutex);
+
+        // Discard events of previous tracing
+        if (enabled && !mEnabled.load())
+        {
+            for (auto& rupBuffer : mBuffers)
+            {
+                rupBuffer->count.store(0);
+                rupBuffer->droppedCount.store(0);
+            }
+            mStartTime = std::chrono::steady_clock::now();
+        }
+
+        mEnabled.store(enabled);
+    }
+
+    void Tracer::internalAddSpan(const char* pName, std::string detail, double start, double duration)
+    {
+        ThreadBuffer* pBuffer = getThreadBuffer();
+
+        // Drop event if buffer is full
+        unsigned int count = pBuffer->count.load(std::memory_order_relaxed);
+        if (count >= pBuffer->events.size())
+        {
+            pBuffer->droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // Fill event and publish it afterwards
+        TraceEvent& rEvent = pBuffer->events[count];
+        rEvent.pName = pName;
+        rEvent.detail = std::move(detail);
+        rEvent.start = start;
+        rEvent.duration = duration;
+        pBuffer->count.store(count + 1, std::memory_order_release);
+    }
+
+    bool Tracer::internalWrite(std::string filepath)
+    {
+        std::lock_guard<std::mutex> lock(mBufferMutex);
+
+        // Trace is not relative to root filepath
+        std::ofstream file(filepath.c_str(), std::ios::out | std::ios::trunc);
+        if (!file.is_open())
+        {
+            throwWarning(OperationNotifier::Operation::RUNTIME, "Could not open file for trace", filepath);
+            return false;
+        }
+
+        file << std::fixed << std::setprecision(3);
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+        bool first = true;
+        unsigned int droppedCount = 0;
+        for (const auto& rupBuffer : mBuffers)
+        {
+            // Name of thread
+            file << (first ? "" : ",") << "\n";
+            file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << rupBuffer->threadIndex;
+            file << ",\"args\":{\"name\":\"eyeGUI thread " << rupBuffer->threadIndex << "\"}}";
+            first = false;
+
+            // Only published events are read
+            unsigned int count = rupBuffer->count.load(std::memory_order_acquire);
+            for (unsigned int i = 0; i < count; i++)
+            {
+                const TraceEvent& rEvent = rupBuffer->events[i];
+                file << ",\n{\"name\":";
+                writeJSONString(file, rEvent.pName);
+                file << ",\"cat\":\"eyeGUI\",\"ph\":\"X\",\"pid\":1,\"tid\":" << rupBuffer->threadIndex;
+                file << ",\"ts\":" << rEvent.start << ",\"dur\":" << rEvent.duration;
+                if (!rEvent.detail.empty())
+                {
+                    file << ",\"args\":{\"detail\":";
+                    writeJSONString(file, rEvent.detail);
+                    file << "}";
+                }
+                file << "}";
+            }
+            droppedCount += rupBuffer->droppedCount.load();
+        }
+
+        file << "\n]}\n";
+        file.close();
+
+        // Tell about full buffers
+        if (droppedCount > 0)
+        {
+            throwWarning(
+                OperationNotifier::Operation::RUNTIME,
+                "Trace buffers were full, dropped events: " + std::to_string(droppedCount),
+                filepath);
+        }
+
+        return true;
+    }
+
+    Tracer::ThreadBuffer* Tracer::getThreadBuffer()
+    {
+        // Buffers live as long as tracer
+        static thread_local ThreadBuffer* pBuffer = NULL;
+        if (pBuffer == NULL)
+        {
+            std::lock_guard<std::mutex> lock(mBufferMutex);
+            std::unique_ptr<ThreadBuffer> upBuffer = std::unique_ptr<ThreadBuffer>(new ThreadBuffer);
+            upBuffer->events.resize(TRACE_BUFFER_CAPACITY);
+            upBuffer->count.store(0);
+            upBuffer->droppedCount.store(0);
+            upBuffer->threadIndex = (unsigned int)mBuffers.size() + 1;
+            pBuffer = upBuffer.get();
+            mBuffers.push_back(std::move(upBuffer));
+        }
+        return pBuffer;
+    }
+}
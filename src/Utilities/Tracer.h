@@ -0,0 +1,167 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Singleton collecting spans of internal events, written in the JSON format
+// of chrome://tracing and Perfetto. Each thread appends to its own buffer
+// without locking, only the first event of a thread registers its buffer.
+// Events are dropped when a buffer is full. Detail of span is only built
+// while tracing is enabled. Spans are compiled in only when
+// EYEGUI_PROFILING is defined.
+
+#ifndef TRACER_H_
+#define TRACER_H_
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Macro for traced span with lazy detail, expands to nothing without profiling
+#ifdef EYEGUI_PROFILING
+#define EYEGUI_TRACE_CONCAT_INNER(a, b) a##b
+#define EYEGUI_TRACE_CONCAT(a, b) EYEGUI_TRACE_CONCAT_INNER(a, b)
+#define EYEGUI_TRACE_SCOPE(name, detail) eyegui::TraceScope EYEGUI_TRACE_CONCAT(traceScope, __LINE__)(name, [&]() -> std::string { return detail; })
+#else
+#define EYEGUI_TRACE_SCOPE(name, detail)
+#endif
+
+namespace eyegui
+{
+    class Tracer
+    {
+    public:
+
+        // Enable or disable tracing, enabling discards traced events
+        static void setEnabled(bool enabled)
+        {
+            getInstance()->internalSetEnabled(enabled);
+        }
+
+        // Is tracing enabled
+        static bool isEnabled()
+        {
+            return getInstance()->mEnabled.load(std::memory_order_relaxed);
+        }
+
+        // Microseconds since tracing was enabled
+        static double now()
+        {
+            std::chrono::duration<double, std::micro> time = std::chrono::steady_clock::now() - getInstance()->mStartTime;
+            return time.count();
+        }
+
+        // Add span of calling thread. Name must be string literal
+        static void addSpan(const char* pName, std::string detail, double start, double duration)
+        {
+            getInstance()->internalAddSpan(pName, std::move(detail), start, duration);
+        }
+
+        // Write all traced events to file, returns whether successful
+        static bool write(std::string filepath)
+        {
+            return getInstance()->internalWrite(filepath);
+        }
+
+    private:
+
+        // Single span
+        struct TraceEvent
+        {
+            const char* pName;
+            std::string detail;
+            double start;
+            double duration;
+        };
+
+        // Buffer of one thread, written only by owning thread
+        struct ThreadBuffer
+        {
+            std::vector<TraceEvent> events;
+            std::atomic<unsigned int> count;
+            std::atomic<unsigned int> droppedCount;
+            unsigned int threadIndex;
+        };
+
+        // Private constructor
+        Tracer();
+
+        // Destructor
+        virtual ~Tracer() {}
+
+        // Private copy constuctor
+        Tracer(Tracer const&) {}
+
+        // Private assignment operator
+        Tracer& operator = (Tracer const&) { return *this; }
+
+        // Check for instance existence
+        static Tracer* getInstance()
+        {
+            if (pInstance == NULL)
+            {
+                static Tracer tracer;
+                pInstance = &tracer;
+            }
+            return pInstance;
+        }
+
+        // Internal methods
+        void internalSetEnabled(bool enabled);
+        void internalAddSpan(const char* pName, std::string detail, double start, double duration);
+        bool internalWrite(std::string filepath);
+
+        // Get buffer of calling thread, registers it if necessary
+        ThreadBuffer* getThreadBuffer();
+
+        // Members
+        static Tracer* pInstance;
+        std::atomic<bool> mEnabled;
+        std::chrono::steady_clock::time_point mStartTime;
+        std::mutex mBufferMutex; // Only used to register buffers and to write
+        std::vector<std::unique_ptr<ThreadBuffer> > mBuffers;
+    };
+
+    // Scoped span which is added to tracer at destruction
+    class TraceScope
+    {
+    public:
+
+        // Constructor, detail function is only called while tracing
+        template<typename DetailFunction>
+        TraceScope(const char* pName, DetailFunction detailFunction)
+        {
+            mActive = Tracer::isEnabled();
+            if (mActive)
+            {
+                mpName = pName;
+                mDetail = detailFunction();
+                mStart = Tracer::now();
+            }
+        }
+
+        // Destructor
+        ~TraceScope()
+        {
+            if (mActive)
+            {
+                Tracer::addSpan(mpName, std::move(mDetail), mStart, Tracer::now() - mStart);
+            }
+        }
+
+    private:
+
+        // Members
+        bool mActive;
+        const char* mpName;
+        std::string mDetail;
+        double mStart;
+    };
+}
+
+#endif // TRACER_H_
@@ -0,0 +1,176 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+
+#include "WorkerPool.h"
+
+namespace eyegui
+{
+    WorkerPool::WorkerPool(unsigned int workerCount)
+    {
+        // Initialize members
+        mBatch = 0;
+        mRemainingTasks = 0;
+        mBusyWorkers = 0;
+        mShutdown = false;
+
+        // Calling thread works, too
+        if (workerCount == 0)
+        {
+            unsigned int hardwareCount = std::thread::hardware_concurrency();
+            workerCount = hardwareCount > 1 ? hardwareCount - 1 : 0;
+        }
+
+        // One deque per worker and one for calling thread
+        for (unsigned int i = 0; i <= workerCount; i++)
+        {
+            mDeques.push_back(std::unique_ptr<TaskDeque>(new TaskDeque));
+        }
+
+        // Start workers
+        for (unsigned int i = 0; i < workerCount; i++)
+        {
+            mWorkers.push_back(std::thread(&WorkerPool::workerLoop, this, i));
+        }
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mShutdown = true;
+        }
+        mWorkCondition.notify_all();
+        for (std::thread& rWorker : mWorkers)
+        {
+            rWorker.join();
+        }
+    }
+
+    void WorkerPool::run(std::vector<std::function<void()> >& rTasks)
+    {
+        if (rTasks.empty())
+        {
+            return;
+        }
+
+        // Without workers, tasks are executed in order
+        if (mWorkers.empty())
+        {
+            for (std::function<void()>& rTask : rTasks)
+            {
+                rTask();
+            }
+            return;
+        }
+
+        // Distribute tasks over deques
+        for (unsigned int i = 0; i < rTasks.size(); i++)
+        {
+            TaskDeque& rDeque = *(mDeques[i % mDeques.size()]);
+            std::lock_guard<std::mutex> lock(rDeque.mutex);
+            rDeque.tasks.push_back(&rTasks[i]);
+        }
+
+        // Wake up workers
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRemainingTasks = (unsigned int)rTasks.size();
+            mBusyWorkers = (unsigned int)mWorkers.size();
+            mBatch++;
+        }
+        mWorkCondition.notify_all();
+
+        // Work on batch
+        work((unsigned int)mDeques.size() - 1);
+
+        // Tasks must not be accessed by workers after returning
+        std::unique_lock<std::mutex> lock(mMutex);
+        mDoneCondition.wait(lock, [&]() { return mRemainingTasks == 0 && mBusyWorkers == 0; });
+    }
+
+    unsigned int WorkerPool::getThreadCount() const
+    {
+        return (unsigned int)mDeques.size();
+    }
+
+    void WorkerPool::work(unsigned int dequeIndex)
+    {
+        while (true)
+        {
+            std::function<void()>* pTask = NULL;
+
+            // Take from front of own deque
+            {
+                TaskDeque& rDeque = *(mDeques[dequeIndex]);
+                std::lock_guard<std::mutex> lock(rDeque.mutex);
+                if (!rDeque.tasks.empty())
+                {
+                    pTask = rDeque.tasks.front();
+                    rDeque.tasks.pop_front();
+                }
+            }
+
+            // Steal from back of other deques
+            for (unsigned int i = 1; pTask == NULL && i < mDeques.size(); i++)
+            {
+                TaskDeque& rDeque = *(mDeques[(dequeIndex + i) % mDeques.size()]);
+                std::lock_guard<std::mutex> lock(rDeque.mutex);
+                if (!rDeque.tasks.empty())
+                {
+                    pTask = rDeque.tasks.back();
+                    rDeque.tasks.pop_back();
+                }
+            }
+
+            // Nothing left in batch
+            if (pTask == NULL)
+            {
+                return;
+            }
+
+            // Execute task
+            (*pTask)();
+
+            // Calling thread waits for last task
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRemainingTasks--;
+            if (mRemainingTasks == 0)
+            {
+                mDoneCondition.notify_all();
+            }
+        }
+    }
+
+    void WorkerPool::workerLoop(unsigned int dequeIndex)
+    {
+        unsigned long long batch = 0;
+        while (true)
+        {
+            // Wait for next batch
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mWorkCondition.wait(lock, [&]() { return mShutdown || mBatch != batch; });
+                if (mShutdown)
+                {
+                    return;
+                }
+                batch = mBatch;
+            }
+
+            // Work on batch
+            work(dequeIndex);
+
+            // Report being done with batch
+            std::lock_guard<std::mutex> lock(mMutex);
+            mBusyWorkers--;
+            if (mBusyWorkers == 0)
+            {
+                mDoneCondition.notify_all();
+            }
+        }
+    }
+}
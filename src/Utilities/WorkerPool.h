@@ -0,0 +1,69 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Pool of worker threads executing batches of independent tasks. Tasks are
+// distributed over one deque per thread, each thread takes tasks from the
+// front of its own deque and steals from the back of others when empty.
+// Calling thread works on the batch, too, and returns when it is finished.
+
+#ifndef WORKER_POOL_H_
+#define WORKER_POOL_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eyegui
+{
+    class WorkerPool
+    {
+    public:
+
+        // Constructor, count of zero uses one thread less than hardware provides
+        WorkerPool(unsigned int workerCount = 0);
+
+        // Destructor
+        virtual ~WorkerPool();
+
+        // Execute tasks and wait for all of them
+        void run(std::vector<std::function<void()> >& rTasks);
+
+        // Get count of threads working on batch, including calling thread
+        unsigned int getThreadCount() const;
+
+    private:
+
+        // Deque of tasks owned by one thread
+        struct TaskDeque
+        {
+            std::mutex mutex;
+            std::deque<std::function<void()>*> tasks;
+        };
+
+        // Work on current batch until no task is left
+        void work(unsigned int dequeIndex);
+
+        // Loop of worker thread
+        void workerLoop(unsigned int dequeIndex);
+
+        // Members
+        std::vector<std::unique_ptr<TaskDeque> > mDeques; // Last one belongs to calling thread
+        std::vector<std::thread> mWorkers;
+        std::mutex mMutex;
+        std::condition_variable mWorkCondition;
+        std::condition_variable mDoneCondition;
+        unsigned long long mBatch;
+        unsigned int mRemainingTasks;
+        unsigned int mBusyWorkers;
+        bool mShutdown;
+    };
+}
+
+#endif // WORKER_POOL_H_
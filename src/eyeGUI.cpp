@@ -9,8 +9,11 @@
 
 #include "GUI.h"
 #include "Layout.h"
+#include "src/Parser/DocumentCompiler.h"
 #include "src/Utilities/OperationNotifier.h"
 #include "src/Utilities/PathBuilder.h"
+#include "src/Utilities/Tracer.h"
+#include "externals/utfcpp/source/utf8.h"
 
 // Version
 static const std::string VERSION_STRING = "0.8";
@@ -28,7 +31,8 @@ namespace eyegui
             vectorGraphicsDPI,
             fontTallSize,
             fontMediumSize,
-            fontSmallSize);
+            fontSmallSize,
+            recordingFilepath);
     }
 
     Layout* addLayout(GUI* pGUI, std::string filepath, bool visible)
@@ -41,11 +45,21 @@ namespace eyegui
         pGUI->removeLayout(pLayout);
     }
 
+    std::shared_ptr<const AsyncLoading> addLayoutAsync(GUI* pGUI, std::string filepath, bool visible, std::weak_ptr<LoadingListener> wpListener)
+    {
+        return pGUI->addLayoutAsync(filepath, visible, wpListener);
+    }
+
     Input updateGUI(GUI* pGUI, float tpf, const Input input)
     {
         return pGUI->update(tpf, input);
     }
 
+    void pushGazeSample(GUI* pGUI, float gazeX, float gazeY, double timestamp)
+    {
+        pGUI->pushGazeSample(gazeX, gazeY, timestamp);
+    }
+
     void drawGUI(GUI const * pGUI)
     {
         pGUI->draw();
@@ -74,6 +88,11 @@ namespace eyegui
         pGUI->loadConfig(filepath);
     }
 
+    void switchLocalization(GUI* pGUI, std::string filepath)
+    {
+        pGUI->switchLocalization(filepath);
+    }
+
     void setGazeVisualizationDrawing(GUI* pGUI, bool draw)
     {
         pGUI->setGazeVisualizationDrawing(draw);
@@ -89,6 +108,76 @@ namespace eyegui
         pGUI->prefetchImage(filepath);
     }
 
+    void invalidateBrick(GUI* pGUI, std::string filepath)
+    {
+        pGUI->invalidateBrick(filepath);
+    }
+
+    void invalidateAllBricks(GUI* pGUI)
+    {
+        pGUI->invalidateAllBricks();
+    }
+
+    void invalidateStylesheet(GUI* pGUI, std::string filepath)
+    {
+        pGUI->invalidateStylesheet(filepath);
+    }
+
+    void invalidateAllStylesheets(GUI* pGUI)
+    {
+        pGUI->invalidateAllStylesheets();
+    }
+
+    void setProfiling(GUI* pGUI, bool enabled, bool gpuTiming)
+    {
+        pGUI->setProfiling(enabled, gpuTiming);
+    }
+
+    ProfileStatistics getProfileStatistics(GUI const * pGUI, ProfilePhase phase)
+    {
+        return pGUI->getProfileStatistics(phase);
+    }
+
+    bool captureFrame(GUI* pGUI, FrameCapture& rCapture, bool wait)
+    {
+        return pGUI->captureFrame(rCapture, wait);
+    }
+
+    void setLayerCaching(GUI* pGUI, bool enabled)
+    {
+        pGUI->setLayerCaching(enabled);
+    }
+
+    unsigned int getCountOfCachedElements(GUI const * pGUI)
+    {
+        return pGUI->getCountOfCachedElements();
+    }
+
+    bool needsRedraw(GUI const * pGUI)
+    {
+        return pGUI->needsRedraw();
+    }
+
+    std::vector<DamageRect> getDamageRects(GUI const * pGUI)
+    {
+        return pGUI->getDamageRects();
+    }
+
+    void setPartialRedraw(GUI* pGUI, bool enabled)
+    {
+        pGUI->setPartialRedraw(enabled);
+    }
+
+    void setRenderSnapshots(GUI* pGUI, bool enabled)
+    {
+        pGUI->setRenderSnapshots(enabled);
+    }
+
+    void setParallelUpdate(GUI* pGUI, bool enabled)
+    {
+        pGUI->setParallelUpdate(enabled);
+    }
+
     void setValueOfConfigAttribute(
         GUI* pGUI,
         std::string attribute,
@@ -110,11 +199,13 @@ namespace eyegui
 
     void setInputUsageOfLayout(Layout* pLayout, bool useInput)
     {
+        pLayout->getInputRecorder()->recordSetInputUsageOfLayout(pLayout, useInput);
         pLayout->useInput(useInput);
     }
 
     void setVisibilityOfLayout(Layout* pLayout, bool visible, bool reset, bool fade)
     {
+        pLayout->getInputRecorder()->recordSetVisibilityOfLayout(pLayout, visible, reset, fade);
         pLayout->setVisibility(visible, fade);
 
         if (reset)
@@ -139,11 +230,13 @@ namespace eyegui
 
     void setElementActivity(Layout* pLayout, std::string id, bool active, bool fade)
     {
+        pLayout->getInputRecorder()->recordSetElementActivity(pLayout, id, active, fade);
         pLayout->setElementActivity(id, active, fade);
     }
 
     void toggleElementActivity(Layout* pLayout, std::string id, bool fade)
     {
+        pLayout->getInputRecorder()->recordSetElementActivity(pLayout, id, !pLayout->isElementActive(id), fade);
         pLayout->setElementActivity(id, !pLayout->isElementActive(id), fade);
     }
 
@@ -157,6 +250,7 @@ namespace eyegui
         std::string id,
         bool dimming)
     {
+        pLayout->getInputRecorder()->recordSetElementDimming(pLayout, id, dimming);
         pLayout->setElementDimming(id, dimming);
     }
 
@@ -166,6 +260,7 @@ namespace eyegui
         bool marking,
         int depth)
     {
+        pLayout->getInputRecorder()->recordSetElementMarking(pLayout, id, marking, depth);
         pLayout->setElementMarking(id, marking, depth);
     }
 
@@ -174,6 +269,7 @@ namespace eyegui
         std::string id,
         std::string style)
     {
+        pLayout->getInputRecorder()->recordSetStyleOfElement(pLayout, id, style);
         pLayout->setStyleOfElement(id, style);
     }
 
@@ -189,6 +285,7 @@ namespace eyegui
 
     void setElementHiding(Layout* pLayout, std::string id, bool hidden)
     {
+        pLayout->getInputRecorder()->recordSetElementHiding(pLayout, id, hidden);
         pLayout->setElementHiding(id, hidden);
     }
 
@@ -199,11 +296,13 @@ namespace eyegui
 
     void highlightInteractiveElement(Layout* pLayout, std::string id, bool doHighlight)
     {
+        pLayout->getInputRecorder()->recordHighlightInteractiveElement(pLayout, id, doHighlight);
         pLayout->highlightInteractiveElement(id, doHighlight);
     }
 
     void toggleHighlightInteractiveElement(Layout* pLayout, std::string id)
     {
+        pLayout->getInputRecorder()->recordHighlightInteractiveElement(pLayout, id, pLayout->isInteractiveElementHighlighted(id));
         pLayout->highlightInteractiveElement(id, pLayout->isInteractiveElementHighlighted(id));
     }
 
@@ -221,51 +320,61 @@ namespace eyegui
         float b,
         float a)
     {
+        pLayout->getInputRecorder()->recordSetValueOfStyleAttribute(pLayout, styleName, attribute, r, g, b, a);
         pLayout->setValueOfStyleAttribute(styleName, attribute, glm::vec4(r, g, b, a));
     }
 
     void setIconOfIconInteractiveElement(Layout* pLayout, std::string id, std::string iconFilepath)
     {
+        pLayout->getInputRecorder()->recordSetIconOfIconInteractiveElement(pLayout, id, iconFilepath);
         pLayout->setIconOfIconInteractiveElement(id, iconFilepath);
     }
 
     void interactWithInteractiveElement(Layout* pLayout, std::string id)
     {
+        pLayout->getInputRecorder()->recordInteractWithInteractiveElement(pLayout, id);
         pLayout->interactWithInteractiveElement(id);
     }
 
     void selectInteractiveElement(Layout* pLayout, std::string id)
     {
+        pLayout->getInputRecorder()->recordSelectInteractiveElement(pLayout, id);
         pLayout->selectInteractiveElement(id);
     }
 
     void deselectInteractiveElement(Layout* pLayout)
     {
+        pLayout->getInputRecorder()->recordDeselectInteractiveElement(pLayout);
         pLayout->deselectInteractiveElement();
     }
 
     void interactWithSelectedInteractiveElement(Layout* pLayout)
     {
+        pLayout->getInputRecorder()->recordInteractWithSelectedInteractiveElement(pLayout);
         pLayout->interactWithSelectedInteractiveElement();
     }
 
     bool selectNextInteractiveElement(Layout* pLayout)
     {
+        pLayout->getInputRecorder()->recordSelectNextInteractiveElement(pLayout);
         return pLayout->selectNextInteractiveElement();
     }
 
     void hitButton(Layout* pLayout, std::string id)
     {
+        pLayout->getInputRecorder()->recordHitButton(pLayout, id);
         pLayout->hitButton(id);
     }
 
     void buttonDown(Layout* pLayout, std::string id, bool immediately)
     {
+        pLayout->getInputRecorder()->recordButtonDown(pLayout, id, immediately);
         pLayout->buttonDown(id, immediately);
     }
 
     void buttonUp(Layout* pLayout, std::string id, bool immediately)
     {
+        pLayout->getInputRecorder()->recordButtonUp(pLayout, id, immediately);
         pLayout->buttonUp(id, immediately);
     }
 
@@ -276,31 +385,99 @@ namespace eyegui
 
     void penetrateSensor(Layout* pLayout, std::string id, float amount)
     {
+        pLayout->getInputRecorder()->recordPenetrateSensor(pLayout, id, amount);
         pLayout->penetrateSensor(id, amount);
     }
 
     void setContentOfTextBlock(Layout* pLayout, std::string id, std::u16string content)
     {
+        if (pLayout->getInputRecorder()->isRecording())
+        {
+            std::string content8;
+            utf8::utf16to8(content.begin(), content.end(), back_inserter(content8));
+            pLayout->getInputRecorder()->recordSetContentOfTextBlock(pLayout, id, content8);
+        }
         pLayout->setContentOfTextBlock(id, content);
     }
 
     void setContentOfTextBlock(Layout* pLayout, std::string id, std::string content)
     {
+        pLayout->getInputRecorder()->recordSetContentOfTextBlock(pLayout, id, content);
         pLayout->setContentOfTextBlock(id, content);
     }
 
     void setKeyOfTextBlock(Layout* pLayout, std::string id, std::string key)
     {
+        pLayout->getInputRecorder()->recordSetKeyOfTextBlock(pLayout, id, key);
         pLayout->setKeyOfTextBlock(id, key);
     }
 
+    void setContentOfTextEdit(Layout* pLayout, std::string id, std::u16string content)
+    {
+        if (pLayout->getInputRecorder()->isRecording())
+        {
+            std::string content8;
+            utf8::utf16to8(content.begin(), content.end(), back_inserter(content8));
+            pLayout->getInputRecorder()->recordSetContentOfTextEdit(pLayout, id, content8);
+        }
+        pLayout->setContentOfTextEdit(id, content);
+    }
+
+    void setContentOfTextEdit(Layout* pLayout, std::string id, std::string content)
+    {
+        pLayout->getInputRecorder()->recordSetContentOfTextEdit(pLayout, id, content);
+        pLayout->setContentOfTextEdit(id, content);
+    }
+
+    std::u16string getContentOfTextEdit(Layout const * pLayout, std::string id)
+    {
+        return pLayout->getContentOfTextEdit(id);
+    }
+
+    void addContentAtCursorInTextEdit(Layout* pLayout, std::string id, std::u16string content)
+    {
+        if (pLayout->getInputRecorder()->isRecording())
+        {
+            std::string content8;
+            utf8::utf16to8(content.begin(), content.end(), back_inserter(content8));
+            pLayout->getInputRecorder()->recordAddContentAtCursorInTextEdit(pLayout, id, content8);
+        }
+        pLayout->addContentAtCursorInTextEdit(id, content);
+    }
+
+    void addContentAtCursorInTextEdit(Layout* pLayout, std::string id, std::string content)
+    {
+        pLayout->getInputRecorder()->recordAddContentAtCursorInTextEdit(pLayout, id, content);
+        pLayout->addContentAtCursorInTextEdit(id, content);
+    }
+
+    void deleteContentAtCursorInTextEdit(Layout* pLayout, std::string id, int letterCount)
+    {
+        pLayout->getInputRecorder()->recordDeleteContentAtCursorInTextEdit(pLayout, id, letterCount);
+        pLayout->deleteContentAtCursorInTextEdit(id, letterCount);
+    }
+
+    void moveCursorOverLettersInTextEdit(Layout* pLayout, std::string id, int letterCount)
+    {
+        pLayout->getInputRecorder()->recordMoveCursorOverLettersInTextEdit(pLayout, id, letterCount);
+        pLayout->moveCursorOverLettersInTextEdit(id, letterCount);
+    }
+
+    void moveCursorOverLinesInTextEdit(Layout* pLayout, std::string id, int lineCount)
+    {
+        pLayout->getInputRecorder()->recordMoveCursorOverLinesInTextEdit(pLayout, id, lineCount);
+        pLayout->moveCursorOverLinesInTextEdit(id, lineCount);
+    }
+
     void setFastTypingOfKeyboard(Layout* pLayout, std::string id, bool useFastTyping)
     {
+        pLayout->getInputRecorder()->recordSetFastTypingOfKeyboard(pLayout, id, useFastTyping);
         pLayout->setFastTypingOfKeyboard(id, useFastTyping);
     }
 
     void setCaseOfKeyboard(Layout* pLayout, std::string id, KeyboardCase keyboardCase)
     {
+        pLayout->getInputRecorder()->recordSetCaseOfKeyboard(pLayout, id, keyboardCase);
         pLayout->setCaseOfKeyboard(id, keyboardCase);
     }
 
@@ -311,9 +488,33 @@ namespace eyegui
 
     void setKeymapOfKeyboard(Layout* pLayout, std::string id, unsigned int keymapIndex)
     {
+        pLayout->getInputRecorder()->recordSetKeymapOfKeyboard(pLayout, id, keymapIndex);
         pLayout->setKeymapOfKeyboard(id, keymapIndex);
     }
 
+    void setDictionaryOfKeyboard(Layout* pLayout, std::string id, std::string filepath)
+    {
+        pLayout->getInputRecorder()->recordSetDictionaryOfKeyboard(pLayout, id, filepath);
+        pLayout->setDictionaryOfKeyboard(id, filepath);
+    }
+
+    void setWordOfKeyboard(Layout* pLayout, std::string id, std::u16string word)
+    {
+        if (pLayout->getInputRecorder()->isRecording())
+        {
+            std::string word8;
+            utf8::utf16to8(word.begin(), word.end(), back_inserter(word8));
+            pLayout->getInputRecorder()->recordSetWordOfKeyboard(pLayout, id, word8);
+        }
+        pLayout->setWordOfKeyboard(id, word);
+    }
+
+    void setWordOfKeyboard(Layout* pLayout, std::string id, std::string word)
+    {
+        pLayout->getInputRecorder()->recordSetWordOfKeyboard(pLayout, id, word);
+        pLayout->setWordOfKeyboard(id, word);
+    }
+
     void registerButtonListener(Layout* pLayout, std::string id, std::weak_ptr<ButtonListener> wpListener)
     {
         pLayout->registerButtonListener(id, wpListener);
@@ -337,31 +538,37 @@ namespace eyegui
         ImageAlignment backgroundAlignment,
         bool fade)
     {
+        pLayout->getInputRecorder()->recordReplaceElementWithBlock(pLayout, id, consumeInput, backgroundFilepath, backgroundAlignment, fade);
         pLayout->replaceElementWithBlock(id, consumeInput, backgroundFilepath, backgroundAlignment, fade);
     }
 
     void replaceElementWithPicture(Layout* pLayout, std::string id, std::string filepath, ImageAlignment alignment, bool fade)
     {
+        pLayout->getInputRecorder()->recordReplaceElementWithPicture(pLayout, id, filepath, alignment, fade);
         pLayout->replaceElementWithPicture(id, filepath, alignment, fade);
     }
 
     void replaceElementWithBlank(Layout* pLayout, std::string id, bool fade)
     {
+        pLayout->getInputRecorder()->recordReplaceElementWithBlank(pLayout, id, fade);
         pLayout->replaceElementWithBlank(id, fade);
     }
 
     void replaceElementWithCircleButton(Layout* pLayout, std::string id, std::string iconFilepath, bool isSwitch, bool fade)
     {
+        pLayout->getInputRecorder()->recordReplaceElementWithCircleButton(pLayout, id, iconFilepath, isSwitch, fade);
         pLayout->replaceElementWithCircleButton(id, iconFilepath, isSwitch, fade);
     }
 
     void replaceElementWithBoxButton(Layout* pLayout, std::string id, std::string iconFilepath, bool isSwitch, bool fade)
     {
+        pLayout->getInputRecorder()->recordReplaceElementWithBoxButton(pLayout, id, iconFilepath, isSwitch, fade);
         pLayout->replaceElementWithBoxButton(id, iconFilepath, isSwitch, fade);
     }
 
     void replaceElementWithSensor(Layout* pLayout, std::string id, std::string iconFilepath, bool fade)
     {
+        pLayout->getInputRecorder()->recordReplaceElementWithSensor(pLayout, id, iconFilepath, fade);
         pLayout->replaceElementWithSensor(id, iconFilepath, fade);
     }
 
@@ -380,6 +587,12 @@ namespace eyegui
         ImageAlignment backgroundAlignment,
         bool fade)
     {
+        if (pLayout->getInputRecorder()->isRecording())
+        {
+            std::string content8;
+            utf8::utf16to8(content.begin(), content.end(), back_inserter(content8));
+            pLayout->getInputRecorder()->recordReplaceElementWithTextBlock(pLayout, id, consumeInput, fontSize, alignment, verticalAlignment, content8, innerBorder, textScale, key, backgroundFilepath, backgroundAlignment, fade);
+        }
         pLayout->replaceElementWithTextBlock(
             id,
             consumeInput,
@@ -403,6 +616,7 @@ namespace eyegui
 
     void replaceElementWithBrick(Layout* pLayout, std::string id, std::string filepath, std::map<std::string, std::string> idMapper, bool fade)
     {
+        pLayout->getInputRecorder()->recordReplaceElementWithBrick(pLayout, id, filepath, idMapper, fade);
         pLayout->replaceElementWithBrick(id, filepath, idMapper, fade);
     }
 
@@ -440,11 +654,29 @@ namespace eyegui
         bool visible,
         bool fade)
     {
+        pLayout->getInputRecorder()->recordAddFloatingFrameWithBrick(pLayout, filepath, relativePositionX, relativePositionY, relativeSizeX, relativeSizeY, idMapper, visible, fade);
         return pLayout->addFloatingFrameWithBrick(filepath, relativePositionX, relativePositionY, relativeSizeX, relativeSizeY, idMapper, visible, fade);
     }
 
+    std::shared_ptr<const AsyncLoading> addFloatingFrameWithBrickAsync(
+        GUI* pGUI,
+        Layout* pLayout,
+        std::string filepath,
+        float relativePositionX,
+        float relativePositionY,
+        float relativeSizeX,
+        float relativeSizeY,
+        std::map<std::string, std::string> idMapper,
+        bool visible,
+        bool fade,
+        std::weak_ptr<LoadingListener> wpListener)
+    {
+        return pGUI->addFloatingFrameWithBrickAsync(pLayout, filepath, relativePositionX, relativePositionY, relativeSizeX, relativeSizeY, idMapper, visible, fade, wpListener);
+    }
+
     void setVisibilityOFloatingfFrame(Layout* pLayout, unsigned int frameIndex, bool visible, bool reset, bool fade)
     {
+        pLayout->getInputRecorder()->recordSetVisibilityOfFloatingFrame(pLayout, frameIndex, visible, reset, fade);
         pLayout->setVisibiltyOfFloatingFrame(frameIndex, visible, fade);
 
         if (reset)
@@ -455,36 +687,43 @@ namespace eyegui
 
     void removeFloatingFrame(Layout* pLayout, unsigned int frameIndex, bool fade)
     {
+        pLayout->getInputRecorder()->recordRemoveFloatingFrame(pLayout, frameIndex, fade);
         pLayout->removeFloatingFrame(frameIndex, fade);
     }
 
     void translateFloatingFrame(Layout* pLayout, unsigned int frameIndex, float translateX, float translateY)
     {
+        pLayout->getInputRecorder()->recordTranslateFloatingFrame(pLayout, frameIndex, translateX, translateY);
         pLayout->translateFloatingFrame(frameIndex, translateX, translateY);
     }
 
     void scaleFloatingFrame(Layout* pLayout, unsigned int frameIndex, float scaleX, float scaleY)
     {
+        pLayout->getInputRecorder()->recordScaleFloatingFrame(pLayout, frameIndex, scaleX, scaleY);
         pLayout->scaleFloatingFrame(frameIndex, scaleX, scaleY);
     }
 
     void setPositionOfFloatingFrame(Layout* pLayout, unsigned int frameIndex, float relativePositionX, float relativePositionY)
     {
+        pLayout->getInputRecorder()->recordSetPositionOfFloatingFrame(pLayout, frameIndex, relativePositionX, relativePositionY);
         pLayout->setPositionOfFloatingFrame(frameIndex, relativePositionX, relativePositionY);
     }
 
     void setSizeOfFloatingFrame(Layout* pLayout, unsigned int frameIndex, float relativeSizeX, float relativeSizeY)
     {
+        pLayout->getInputRecorder()->recordSetSizeOfFloatingFrame(pLayout, frameIndex, relativeSizeX, relativeSizeY);
         pLayout->setSizeOfFloatingFrame(frameIndex, relativeSizeX, relativeSizeY);
     }
 
     void moveFloatingFrameToFront(Layout* pLayout, unsigned int frameIndex)
     {
+        pLayout->getInputRecorder()->recordMoveFloatingFrame(pLayout, frameIndex, true);
         pLayout->moveFloatingFrameToFront(frameIndex);
     }
 
     void moveFloatingFrameToBack(Layout* pLayout, unsigned int frameIndex)
     {
+        pLayout->getInputRecorder()->recordMoveFloatingFrame(pLayout, frameIndex, false);
         pLayout->moveFloatingFrameToBack(frameIndex);
     }
 
@@ -512,6 +751,18 @@ namespace eyegui
         OperationNotifier::setWarningCallback(pCallbackFunction);
     }
 
+    void setTracing(bool enabled)
+    {
+#ifdef EYEGUI_PROFILING
+        Tracer::setEnabled(enabled);
+#endif
+    }
+
+    bool writeTrace(std::string filepath)
+    {
+        return Tracer::write(filepath);
+    }
+
     std::string getLibraryVersion()
     {
         return VERSION_STRING;
@@ -522,4 +773,14 @@ namespace eyegui
         // Set root filepath as friend of path builder
         PathBuilder::rootFilepath = rootFilepath;
     }
+
+    void setCompiledCaching(bool enabled)
+    {
+        document_compiler::setCaching(enabled);
+    }
+
+    bool compileFile(std::string filepath)
+    {
+        return document_compiler::compileFile(filepath);
+    }
 }
@@ -0,0 +1,624 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Generates synthetic layouts (deep stack, wide grid, large localized text,
+// many floating frames, many styles and many localization keys), runs them
+// in a headless OpenGL context and reports construction time of the GUI
+// including loading of localization, parse time, time of relayout after
+// resizing, update and draw time, frames per second and growth of resident
+// memory. Lookups of localization keys are timed, too. Without a font, text
+// is not meshed, so pass a .ttf file to measure text layout.
+// Usage: eyeGUI_bench [--out <dir>] [--font <ttf>] [--frames <count>]
+//                     [--scale <factor>] [--scenario <name>] [--csv <file>]
+//                     [--layer-caching <0|1>] [--parallel-update <0|1>]
+
+#include "include/eyeGUI.h"
+#include "include/eyeGUIHeadless.h"
+#include "src/Parser/LocalizationParser.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    // Size of headless framebuffer
+    const int BENCH_WIDTH = 1280;
+    const int BENCH_HEIGHT = 720;
+
+    // Frames before measurement
+    const int BENCH_WARMUP_FRAMES = 10;
+
+    // Time per frame given to GUI
+    const float BENCH_TPF = 1.0f / 60.0f;
+
+    // Generated scenario
+    struct Scenario
+    {
+        std::string name;
+        std::string layoutFilepath;
+        std::string brickFilepath; // Added as floating frames if not empty
+        std::string localizationFilepath = "bench.leyegui";
+        int lookupKeyCount = 0; // Keys of localization to look up if not zero
+        int floatingFrameCount = 0;
+        int elementCount = 0;
+    };
+
+    // Results of scenario
+    struct Result
+    {
+        double constructMilliseconds = 0;
+        double parseMilliseconds = 0;
+        double relayoutMilliseconds = 0;
+        double updateMean = 0;
+        double updateP99 = 0;
+        double drawMean = 0;
+        double drawP99 = 0;
+        double framesPerSecond = 0;
+        double memoryMegabytes = 0;
+        unsigned int cachedElements = 0;
+        double firstLookupNanoseconds = 0;
+        double lookupNanoseconds = 0;
+    };
+
+    // Mean and 99th percentile
+    void calculateStatistics(std::vector<double> values, double& rMean, double& rP99)
+    {
+        rMean = 0;
+        rP99 = 0;
+        if (values.empty())
+        {
+            return;
+        }
+
+        std::sort(values.begin(), values.end());
+        double sum = 0;
+        for (double value : values)
+        {
+            sum += value;
+        }
+        rMean = sum / (double)values.size();
+        rP99 = values[std::min(values.size() - 1, (size_t)(0.99 * (double)values.size()))];
+    }
+
+    // Resident memory of process in bytes, zero if unknown
+    double getResidentMemory()
+    {
+#ifdef __linux__
+        std::ifstream statm("/proc/self/statm");
+        long pages = 0;
+        long residentPages = 0;
+        if (statm >> pages >> residentPages)
+        {
+            return (double)residentPages * (double)sysconf(_SC_PAGESIZE);
+        }
+#endif
+        return 0;
+    }
+
+    // Create directory, existing one is fine
+    void createDirectory(std::string path)
+    {
+#ifdef _WIN32
+        _mkdir(path.c_str());
+#else
+        mkdir(path.c_str(), 0755);
+#endif
+    }
+
+    // Write text file into directory
+    bool writeFile(std::string directory, std::string filename, std::string content)
+    {
+        std::ofstream file((directory + "/" + filename).c_str(), std::ios::out | std::ios::trunc);
+        if (!file.is_open())
+        {
+            std::cerr << "Could not write file: " << directory << "/" << filename << std::endl;
+            return false;
+        }
+        file << content;
+        return true;
+    }
+
+    // Copy font into directory, since paths are relative to root
+    bool copyFont(std::string fontFilepath, std::string directory)
+    {
+        std::ifstream source(fontFilepath.c_str(), std::ios::in | std::ios::binary);
+        std::ofstream target((directory + "/bench.ttf").c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!source.is_open() || !target.is_open())
+        {
+            std::cerr << "Could not copy font: " << fontFilepath << std::endl;
+            return false;
+        }
+        target << source.rdbuf();
+        return true;
+    }
+
+    // Percentage with enough digits to sum up exactly for powers of two
+    std::string percentage(int count)
+    {
+        std::ostringstream stream;
+        stream.precision(10);
+        stream << (100.0 / (double)count) << "%";
+        return stream.str();
+    }
+
+    // Stack nested into stack, down to depth
+    Scenario generateDeepStack(std::string directory, int depth)
+    {
+        Scenario scenario;
+        scenario.name = "deep_stack";
+        scenario.layoutFilepath = "deep_stack.xeyegui";
+
+        std::ostringstream xml;
+        xml << "<layout stylesheet=\"bench.seyegui\">\n";
+        for (int i = 0; i < depth; i++)
+        {
+            xml << "<stack>\n<circlebutton id=\"button_" << i << "\"/>\n";
+        }
+        xml << "<textblock id=\"bottom\" content=\"Bottom of stack\"/>\n";
+        for (int i = 0; i < depth; i++)
+        {
+            xml << "</stack>\n";
+        }
+        xml << "</layout>\n";
+
+        writeFile(directory, scenario.layoutFilepath, xml.str());
+        scenario.elementCount = 2 * depth + 1;
+        return scenario;
+    }
+
+    // Grid with side times side buttons. Side must be power of two
+    Scenario generateWideGrid(std::string directory, int side)
+    {
+        Scenario scenario;
+        scenario.name = "wide_grid";
+        scenario.layoutFilepath = "wide_grid.xeyegui";
+
+        std::ostringstream xml;
+        xml << "<layout stylesheet=\"bench.seyegui\">\n<grid>\n";
+        for (int row = 0; row < side; row++)
+        {
+            xml << "<row size=\"" << percentage(side) << "\">\n";
+            for (int column = 0; column < side; column++)
+            {
+                std::string element = ((row + column) % 2 == 0) ? "circlebutton" : "boxbutton";
+                xml << "<column size=\"" << percentage(side) << "\"><" << element
+                    << " id=\"button_" << row << "_" << column << "\"/></column>\n";
+            }
+            xml << "</row>\n";
+        }
+        xml << "</grid>\n</layout>\n";
+
+        writeFile(directory, scenario.layoutFilepath, xml.str());
+        scenario.elementCount = side * side + 1;
+        return scenario;
+    }
+
+    // Grid of text blocks which get large content from localization
+    Scenario generateLargeText(std::string directory, int wordCount)
+    {
+        Scenario scenario;
+        scenario.name = "large_text";
+        scenario.layoutFilepath = "large_text.xeyegui";
+
+        const int rowCount = 2;
+        const int columnCount = 4;
+        const char* words[] = { "gaze", "controlled", "interface", "with", "layouts", "and", "bricks", "keyboard", "dwell", "time" };
+
+        // Localization with one large text per block
+        std::ostringstream localization;
+        for (int i = 0; i < rowCount * columnCount; i++)
+        {
+            localization << "large_text_" << i << " = ";
+            for (int j = 0; j < wordCount; j++)
+            {
+                localization << words[(i + j) % 10] << (j % 12 == 11 ? ". " : " ");
+            }
+            localization << "\n";
+        }
+        writeFile(directory, "bench.leyegui", localization.str());
+
+        std::ostringstream xml;
+        xml << "<layout stylesheet=\"bench.seyegui\">\n<grid>\n";
+        for (int row = 0; row < rowCount; row++)
+        {
+            xml << "<row size=\"" << percentage(rowCount) << "\">\n";
+            for (int column = 0; column < columnCount; column++)
+            {
+                xml << "<column size=\"" << percentage(columnCount) << "\"><textblock id=\"text_" << row << "_" << column
+                    << "\" fontsize=\"small\" alignment=\"justify\" key=\"large_text_" << (row * columnCount + column) << "\"/></column>\n";
+            }
+            xml << "</row>\n";
+        }
+        xml << "</grid>\n</layout>\n";
+
+        writeFile(directory, scenario.layoutFilepath, xml.str());
+        scenario.elementCount = rowCount * columnCount + 1;
+        return scenario;
+    }
+
+    // Empty layout with many floating frames of small brick
+    Scenario generateFloatingFrames(std::string directory, int frameCount)
+    {
+        Scenario scenario;
+        scenario.name = "floating_frames";
+        scenario.layoutFilepath = "floating_frames.xeyegui";
+        scenario.brickFilepath = "floating_frame.beyegui";
+        scenario.floatingFrameCount = frameCount;
+
+        writeFile(directory, scenario.layoutFilepath,
+            "<layout stylesheet=\"bench.seyegui\">\n<blank/>\n</layout>\n");
+
+        writeFile(directory, scenario.brickFilepath,
+            "<grid>\n"
+            "<row size=\"50%\"><column size=\"50%\"><circlebutton id=\"circle\"/></column><column size=\"50%\"><boxbutton id=\"box\"/></column></row>\n"
+            "<row size=\"50%\"><column size=\"50%\"><textblock id=\"text\" content=\"Frame\"/></column><column size=\"50%\"><sensor id=\"sensor\"/></column></row>\n"
+            "</grid>\n");
+
+        scenario.elementCount = 1 + 5 * frameCount;
+        return scenario;
+    }
+
+    // Grid with side times side blocks, each using one of many styles. Side must be power of two
+    Scenario generateManyStyles(std::string directory, int side, int styleCount)
+    {
+        Scenario scenario;
+        scenario.name = "many_styles";
+        scenario.layoutFilepath = "many_styles.xeyegui";
+
+        std::ostringstream stylesheet;
+        stylesheet << "default\n{\n\tcolor = 0xFFFFFFFF\n}\n";
+        for (int i = 0; i < styleCount; i++)
+        {
+            stylesheet << "style_" << i << "\n{\n\tbackground-color = 0x" << std::hex << (0x10101080 + (i % 0x40) * 0x01020300) << std::dec << "\n}\n";
+        }
+        writeFile(directory, "many_styles.seyegui", stylesheet.str());
+
+        std::ostringstream xml;
+        xml << "<layout stylesheet=\"many_styles.seyegui\">\n<grid>\n";
+        for (int row = 0; row < side; row++)
+        {
+            xml << "<row size=\"" << percentage(side) << "\">\n";
+            for (int column = 0; column < side; column++)
+            {
+                xml << "<column size=\"" << percentage(side) << "\"><block id=\"block_" << row << "_" << column
+                    << "\" style=\"style_" << ((row * side + column) % styleCount) << "\"/></column>\n";
+            }
+            xml << "</row>\n";
+        }
+        xml << "</grid>\n</layout>\n";
+
+        writeFile(directory, scenario.layoutFilepath, xml.str());
+        scenario.elementCount = side * side + 1;
+        return scenario;
+    }
+
+    // Grid with side times side text blocks, each showing one of many entries of localization. Side must be power of two
+    Scenario generateManyKeys(std::string directory, int side, int keyCount)
+    {
+        Scenario scenario;
+        scenario.name = "many_keys";
+        scenario.layoutFilepath = "many_keys.xeyegui";
+        scenario.localizationFilepath = "many_keys.leyegui";
+
+        std::ostringstream localization;
+        for (int i = 0; i < keyCount; i++)
+        {
+            localization << "key_" << i << " = Entry number " << i << " of many localized entries\n";
+        }
+        writeFile(directory, scenario.localizationFilepath, localization.str());
+
+        std::ostringstream xml;
+        xml << "<layout stylesheet=\"bench.seyegui\">\n<grid>\n";
+        for (int row = 0; row < side; row++)
+        {
+            xml << "<row size=\"" << percentage(side) << "\">\n";
+            for (int column = 0; column < side; column++)
+            {
+                xml << "<column size=\"" << percentage(side) << "\"><textblock id=\"text_" << row << "_" << column
+                    << "\" fontsize=\"small\" key=\"key_" << (((row * side + column) * 7919) % keyCount) << "\"/></column>\n";
+            }
+            xml << "</row>\n";
+        }
+        xml << "</grid>\n</layout>\n";
+
+        writeFile(directory, scenario.layoutFilepath, xml.str());
+        scenario.elementCount = side * side + 1;
+        scenario.lookupKeyCount = keyCount;
+        return scenario;
+    }
+
+    // Time per lookup of all keys in localization, first lookup converts value
+    void measureLookups(const Scenario& rScenario, Result& rResult)
+    {
+        typedef std::chrono::high_resolution_clock Clock;
+        std::unique_ptr<eyegui::LocalizationStore> upStore = eyegui::localization_parser::parse(rScenario.localizationFilepath);
+
+        std::vector<std::string> keys;
+        for (int i = 0; i < rScenario.lookupKeyCount; i++)
+        {
+            keys.push_back("key_" + std::to_string(((long long)i * 7919) % rScenario.lookupKeyCount));
+        }
+
+        const int rounds = 10;
+        size_t characterCount = 0;
+        for (int round = 0; round <= rounds; round++)
+        {
+            Clock::time_point start = Clock::now();
+            for (const std::string& rKey : keys)
+            {
+                std::u16string const * pValue = upStore->find(rKey);
+                characterCount += pValue != NULL ? pValue->size() : 0;
+            }
+            double nanoseconds = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (double)keys.size();
+            if (round == 0)
+            {
+                rResult.firstLookupNanoseconds = nanoseconds;
+            }
+            else
+            {
+                rResult.lookupNanoseconds += nanoseconds / (double)rounds;
+            }
+        }
+
+        // Keep compiler from dropping lookups
+        if (characterCount == 0)
+        {
+            std::cerr << "No localization found for keys" << std::endl;
+        }
+    }
+
+    // Callbacks
+    void printError(std::string message)
+    {
+        std::cerr << message << std::endl;
+    }
+
+    void printWarning(std::string message)
+    {
+        std::cerr << message << std::endl;
+    }
+
+    // Run scenario in headless context
+    Result run(const Scenario& rScenario, eyegui::HeadlessContext* pContext, std::string fontFilepath, int frameCount, bool layerCaching, bool parallelUpdate)
+    {
+        typedef std::chrono::high_resolution_clock Clock;
+        Result result;
+        double memoryBefore = getResidentMemory();
+
+        // Construction loads font and localization
+        Clock::time_point start = Clock::now();
+        eyegui::GUIBuilder guiBuilder;
+        guiBuilder.width = BENCH_WIDTH;
+        guiBuilder.height = BENCH_HEIGHT;
+        guiBuilder.fontFilepath = fontFilepath;
+        guiBuilder.localizationFilepath = rScenario.localizationFilepath;
+        eyegui::GUI* pGUI = guiBuilder.construct();
+        result.constructMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        eyegui::setLayerCaching(pGUI, layerCaching);
+        eyegui::setParallelUpdate(pGUI, parallelUpdate);
+
+        // Parsing happens when layout and bricks are added
+        start = Clock::now();
+        eyegui::Layout* pLayout = eyegui::addLayout(pGUI, rScenario.layoutFilepath);
+        for (int i = 0; i < rScenario.floatingFrameCount; i++)
+        {
+            std::map<std::string, std::string> idMapper;
+            std::string prefix = "frame_" + std::to_string(i) + "_";
+            idMapper["circle"] = prefix + "circle";
+            idMapper["box"] = prefix + "box";
+            idMapper["text"] = prefix + "text";
+            idMapper["sensor"] = prefix + "sensor";
+
+            // Frames are spread over screen and overlap
+            float x = (float)((i * 7) % 16) / 20.0f;
+            float y = (float)((i * 3) % 16) / 20.0f;
+            eyegui::addFloatingFrameWithBrick(pLayout, rScenario.brickFilepath, x, y, 0.2f, 0.2f, idMapper);
+        }
+        result.parseMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        // Gaze wanders over screen
+        eyegui::Input input;
+        std::vector<double> updates;
+        std::vector<double> draws;
+        for (int frame = -BENCH_WARMUP_FRAMES; frame < frameCount; frame++)
+        {
+            input.gazeX = (int)(BENCH_WIDTH * (0.5f + 0.45f * std::sin(frame * 0.031f)));
+            input.gazeY = (int)(BENCH_HEIGHT * (0.5f + 0.45f * std::cos(frame * 0.017f)));
+
+            start = Clock::now();
+            eyegui::updateGUI(pGUI, BENCH_TPF, input);
+            Clock::time_point end = Clock::now();
+            double updateMilliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+
+            eyegui::clearHeadlessContext(pContext);
+            eyegui::finishHeadlessContext(pContext);
+            start = Clock::now();
+            eyegui::drawGUI(pGUI);
+            eyegui::finishHeadlessContext(pContext);
+            end = Clock::now();
+            double drawMilliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+
+            if (frame >= 0)
+            {
+                updates.push_back(updateMilliseconds);
+                draws.push_back(drawMilliseconds);
+            }
+        }
+        result.memoryMegabytes = (getResidentMemory() - memoryBefore) / (1024.0 * 1024.0);
+        result.cachedElements = eyegui::getCountOfCachedElements(pGUI);
+
+        // Relayout after resizing, time per frame skips waiting for resizing
+        const int sizes[2][2] = { { BENCH_WIDTH / 2, BENCH_HEIGHT / 2 }, { BENCH_WIDTH, BENCH_HEIGHT } };
+        for (int i = 0; i < 2; i++)
+        {
+            eyegui::resizeGUI(pGUI, sizes[i][0], sizes[i][1]);
+            start = Clock::now();
+            eyegui::updateGUI(pGUI, 1.0f, input); // Resizing of GUI
+            eyegui::updateGUI(pGUI, BENCH_TPF, input); // Resizing of layouts and frames
+            result.relayoutMilliseconds += std::chrono::duration<double, std::milli>(Clock::now() - start).count() / 2.0;
+        }
+
+        eyegui::terminateGUI(pGUI);
+
+        // Lookups without GUI
+        if (rScenario.lookupKeyCount > 0)
+        {
+            measureLookups(rScenario, result);
+        }
+
+        // Statistics
+        calculateStatistics(updates, result.updateMean, result.updateP99);
+        calculateStatistics(draws, result.drawMean, result.drawP99);
+        double frameMilliseconds = result.updateMean + result.drawMean;
+        result.framesPerSecond = frameMilliseconds > 0 ? 1000.0 / frameMilliseconds : 0;
+
+        return result;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // Parse arguments
+    std::string directory = "eyeGUI_bench";
+    std::string fontFilepath = "";
+    std::string scenarioFilter = "";
+    std::string csvFilepath = "";
+    int frameCount = 300;
+    float scale = 1.0f;
+    bool layerCaching = false;
+    bool parallelUpdate = false;
+    for (int i = 1; i < argc - 1; i += 2)
+    {
+        std::string argument = argv[i];
+        if (argument == "--out")
+        {
+            directory = argv[i + 1];
+        }
+        else if (argument == "--font")
+        {
+            fontFilepath = argv[i + 1];
+        }
+        else if (argument == "--frames")
+        {
+            frameCount = std::max(1, std::stoi(argv[i + 1]));
+        }
+        else if (argument == "--scale")
+        {
+            scale = std::max(0.01f, std::stof(argv[i + 1]));
+        }
+        else if (argument == "--scenario")
+        {
+            scenarioFilter = argv[i + 1];
+        }
+        else if (argument == "--csv")
+        {
+            csvFilepath = argv[i + 1];
+        }
+        else if (argument == "--layer-caching")
+        {
+            layerCaching = std::string(argv[i + 1]) != "0";
+        }
+        else if (argument == "--parallel-update")
+        {
+            parallelUpdate = std::string(argv[i + 1]) != "0";
+        }
+        else
+        {
+            std::cerr << "Usage: eyeGUI_bench [--out <dir>] [--font <ttf>] [--frames <count>] [--scale <factor>] [--scenario <name>] [--csv <file>] [--layer-caching <0|1>] [--parallel-update <0|1>]" << std::endl;
+            return 1;
+        }
+    }
+
+    eyegui::setErrorCallback(&printError);
+    eyegui::setWarningCallback(&printWarning);
+
+    // Generate files
+    createDirectory(directory);
+    writeFile(directory, "bench.seyegui", "default\n{\n\tcolor = 0xFFFFFFFF\n\tbackground-color = 0x20202080\n}\n");
+    std::string guiFontFilepath = "";
+    if (fontFilepath != "" && copyFont(fontFilepath, directory))
+    {
+        guiFontFilepath = "bench.ttf";
+    }
+
+    // Side of grid is kept power of two, so that relative sizes sum up exactly
+    int gridSide = 1 << std::max(1, (int)std::round(std::log2(64.0f * std::sqrt(scale))));
+
+    std::vector<Scenario> scenarios;
+    scenarios.push_back(generateDeepStack(directory, std::max(1, (int)(64 * scale))));
+    scenarios.push_back(generateWideGrid(directory, gridSide));
+    scenarios.push_back(generateLargeText(directory, std::max(1, (int)(1000 * scale))));
+    scenarios.push_back(generateFloatingFrames(directory, std::max(1, (int)(64 * scale))));
+    scenarios.push_back(generateManyStyles(directory, gridSide, std::max(1, (int)(256 * scale))));
+    scenarios.push_back(generateManyKeys(directory, gridSide, std::max(1, (int)(50000 * scale))));
+
+    // Headless context shared by all scenarios
+    eyegui::HeadlessContext* pContext = eyegui::createHeadlessContext(BENCH_WIDTH, BENCH_HEIGHT);
+    if (!eyegui::isHeadlessContextValid(pContext))
+    {
+        eyegui::terminateHeadlessContext(pContext);
+        return 1;
+    }
+    std::cout << "Renderer: " << eyegui::getRendererOfHeadlessContext(pContext) << std::endl;
+    eyegui::setRootFilepath(directory + "/");
+
+    // CSV output
+    std::ofstream csv;
+    if (csvFilepath != "")
+    {
+        csv.open(csvFilepath.c_str(), std::ios::out | std::ios::trunc);
+        csv << "scenario,elements,construct_ms,parse_ms,relayout_ms,update_mean_ms,update_p99_ms,update_per_element_us,draw_mean_ms,draw_p99_ms,fps,memory_mb,cached_elements,first_lookup_ns,lookup_ns" << std::endl;
+    }
+
+    for (const Scenario& rScenario : scenarios)
+    {
+        if (scenarioFilter != "" && scenarioFilter != rScenario.name)
+        {
+            continue;
+        }
+
+        Result result = run(rScenario, pContext, guiFontFilepath, frameCount, layerCaching, parallelUpdate);
+        double perElement = 1000.0 * result.updateMean / (double)rScenario.elementCount;
+
+        std::cout << rScenario.name << " (" << rScenario.elementCount << " elements)" << std::endl
+            << "  construct " << result.constructMilliseconds << " ms, parse " << result.parseMilliseconds << " ms, relayout " << result.relayoutMilliseconds << " ms" << std::endl
+            << "  update mean " << result.updateMean << " ms, p99 " << result.updateP99 << " ms, " << perElement << " us per element" << std::endl
+            << "  draw mean " << result.drawMean << " ms, p99 " << result.drawP99 << " ms" << std::endl
+            << "  " << result.framesPerSecond << " fps, memory +" << result.memoryMegabytes << " MB" << std::endl
+            << "  " << result.cachedElements << " elements drawn from layers" << std::endl;
+        if (rScenario.lookupKeyCount > 0)
+        {
+            std::cout << "  lookup first " << result.firstLookupNanoseconds << " ns, again " << result.lookupNanoseconds << " ns per key" << std::endl;
+        }
+
+        if (csv.is_open())
+        {
+            csv << rScenario.name << "," << rScenario.elementCount << ","
+                << result.constructMilliseconds << "," << result.parseMilliseconds << "," << result.relayoutMilliseconds << ","
+                << result.updateMean << "," << result.updateP99 << "," << perElement << ","
+                << result.drawMean << "," << result.drawP99 << ","
+                << result.framesPerSecond << "," << result.memoryMegabytes << "," << result.cachedElements << ","
+                << result.firstLookupNanoseconds << "," << result.lookupNanoseconds << std::endl;
+        }
+    }
+
+    eyegui::terminateHeadlessContext(pContext);
+    return 0;
+}
@@ -0,0 +1,364 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Runs layout for some frames in a headless OpenGL context with fixed time
+// per frame and fixed gaze, captures the final frame and compares it with a
+// reference image. Pixels differ if one color channel differs more than
+// tolerance, alpha is not compared since it depends on blending. Comparison
+// fails if more pixels than allowed differ. Images are written as
+// uncompressed TGA, references may be any format stb_image reads. Mean time
+// of drawing with asynchronous capture is reported to measure optimizations.
+// With partial redraw, frames are drawn into the framebuffer of the context
+// instead, which is kept between frames while the damaged areas are cleared
+// before drawing, like an application would do it. The final frame is read
+// from there and must match a complete drawing of the same frame.
+// Usage: eyeGUI_capture <layout> [--root <path>] [--font <ttf>] [--localization <file>] [--size <w>x<h>]
+//                       [--frames <count>] [--gaze <x>,<y>] [--out <tga>]
+//                       [--reference <image>] [--tolerance <0-255>]
+//                       [--max-differing <fraction>] [--diff <tga>]
+//                       [--layer-caching <0|1>] [--partial-redraw <0|1>]
+// Exit code is 0 if capture matches or no reference is given, 2 on mismatch.
+
+#include "include/eyeGUI.h"
+#include "include/eyeGUIHeadless.h"
+#include "externals/stb/stb_image.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Time per frame given to GUI
+    const float CAPTURE_TPF = 1.0f / 60.0f;
+
+    // Result of comparison
+    struct Comparison
+    {
+        int differingPixels = 0;
+        int maximumDifference = 0;
+        double meanDifference = 0;
+    };
+
+    // Write RGBA pixels with top row first as uncompressed TGA
+    bool writeTGA(std::string filepath, const eyegui::FrameCapture& rCapture)
+    {
+        std::ofstream file(filepath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            std::cerr << "Could not write image: " << filepath << std::endl;
+            return false;
+        }
+
+        // Header for true color image with alpha and origin at top left
+        unsigned char header[18] = { 0 };
+        header[2] = 2;
+        header[12] = (unsigned char)(rCapture.width & 0xFF);
+        header[13] = (unsigned char)((rCapture.width >> 8) & 0xFF);
+        header[14] = (unsigned char)(rCapture.height & 0xFF);
+        header[15] = (unsigned char)((rCapture.height >> 8) & 0xFF);
+        header[16] = 32;
+        header[17] = 0x28;
+        file.write((const char*)header, sizeof(header));
+
+        // TGA stores blue, green, red and alpha
+        std::vector<unsigned char> pixels(rCapture.pixels.size());
+        for (size_t i = 0; i + 3 < pixels.size(); i += 4)
+        {
+            pixels[i] = rCapture.pixels[i + 2];
+            pixels[i + 1] = rCapture.pixels[i + 1];
+            pixels[i + 2] = rCapture.pixels[i];
+            pixels[i + 3] = rCapture.pixels[i + 3];
+        }
+        file.write((const char*)pixels.data(), pixels.size());
+        return file.good();
+    }
+
+    // Read image as RGBA with top row first
+    bool readImage(std::string filepath, eyegui::FrameCapture& rImage)
+    {
+        // Library flips images for textures, which is not wanted here
+        stbi_set_flip_vertically_on_load(false);
+        int channelCount = 0;
+        unsigned char* pData = stbi_load(filepath.c_str(), &rImage.width, &rImage.height, &channelCount, 4);
+        if (pData == NULL)
+        {
+            std::cerr << "Could not read image: " << filepath << std::endl;
+            return false;
+        }
+        rImage.pixels.assign(pData, pData + rImage.width * rImage.height * 4);
+        stbi_image_free(pData);
+        return true;
+    }
+
+    // Compare colors of capture with reference, optionally filling image of differences
+    Comparison compare(const eyegui::FrameCapture& rCapture, const eyegui::FrameCapture& rReference, int tolerance, eyegui::FrameCapture& rDiff)
+    {
+        Comparison comparison;
+        rDiff.width = rCapture.width;
+        rDiff.height = rCapture.height;
+        rDiff.pixels.resize(rCapture.pixels.size());
+
+        double sum = 0;
+        for (size_t i = 0; i + 3 < rCapture.pixels.size(); i += 4)
+        {
+            int pixelDifference = 0;
+            for (size_t j = 0; j < 3; j++)
+            {
+                int difference = std::abs((int)rCapture.pixels[i + j] - (int)rReference.pixels[i + j]);
+                pixelDifference = std::max(pixelDifference, difference);
+                sum += difference;
+            }
+            comparison.maximumDifference = std::max(comparison.maximumDifference, pixelDifference);
+
+            // Differing pixels are red, others are dimmed reference
+            bool differs = pixelDifference > tolerance;
+            if (differs)
+            {
+                comparison.differingPixels++;
+            }
+            unsigned char gray = (unsigned char)((rReference.pixels[i] + rReference.pixels[i + 1] + rReference.pixels[i + 2]) / 12);
+            rDiff.pixels[i] = differs ? 255 : gray;
+            rDiff.pixels[i + 1] = differs ? 0 : gray;
+            rDiff.pixels[i + 2] = differs ? 0 : gray;
+            rDiff.pixels[i + 3] = 255;
+        }
+        if (!rCapture.pixels.empty())
+        {
+            comparison.meanDifference = sum / (double)((rCapture.pixels.size() / 4) * 3);
+        }
+        return comparison;
+    }
+
+    // Callbacks for errors and warnings
+    void printError(std::string message)
+    {
+        std::cerr << message << std::endl;
+    }
+
+    void printWarning(std::string message)
+    {
+        std::cerr << message << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const std::string usage =
+        "Usage: eyeGUI_capture <layout> [--root <path>] [--font <ttf>] [--localization <file>] [--size <w>x<h>] [--frames <count>] [--gaze <x>,<y>] "
+        "[--out <tga>] [--reference <image>] [--tolerance <0-255>] [--max-differing <fraction>] [--diff <tga>] "
+        "[--layer-caching <0|1>] [--partial-redraw <0|1>]";
+    if (argc < 2 || (argc % 2) != 0)
+    {
+        std::cerr << usage << std::endl;
+        return 1;
+    }
+
+    // Parse arguments
+    std::string layoutFilepath = argv[1];
+    std::string rootFilepath = "";
+    std::string fontFilepath = "";
+    std::string localizationFilepath = "";
+    std::string outFilepath = "";
+    std::string referenceFilepath = "";
+    std::string diffFilepath = "";
+    int width = 1280;
+    int height = 720;
+    int frameCount = 60;
+    int tolerance = 2;
+    double maxDiffering = 0;
+    bool layerCaching = false;
+    bool partialRedraw = false;
+    eyegui::Input input;
+    input.gazeX = -1000; // Gaze away from screen by default
+    input.gazeY = -1000;
+    for (int i = 2; i < argc - 1; i += 2)
+    {
+        std::string argument = argv[i];
+        std::string value = argv[i + 1];
+        if (argument == "--root")
+        {
+            rootFilepath = value;
+        }
+        else if (argument == "--font")
+        {
+            fontFilepath = value;
+        }
+        else if (argument == "--localization")
+        {
+            localizationFilepath = value;
+        }
+        else if (argument == "--size" && value.find('x') != std::string::npos)
+        {
+            width = std::max(1, std::atoi(value.substr(0, value.find('x')).c_str()));
+            height = std::max(1, std::atoi(value.substr(value.find('x') + 1).c_str()));
+        }
+        else if (argument == "--frames")
+        {
+            frameCount = std::max(1, std::atoi(value.c_str()));
+        }
+        else if (argument == "--gaze" && value.find(',') != std::string::npos)
+        {
+            input.gazeX = std::atoi(value.substr(0, value.find(',')).c_str());
+            input.gazeY = std::atoi(value.substr(value.find(',') + 1).c_str());
+        }
+        else if (argument == "--out")
+        {
+            outFilepath = value;
+        }
+        else if (argument == "--reference")
+        {
+            referenceFilepath = value;
+        }
+        else if (argument == "--tolerance")
+        {
+            tolerance = std::max(0, std::min(255, std::atoi(value.c_str())));
+        }
+        else if (argument == "--max-differing")
+        {
+            maxDiffering = std::max(0.0, std::atof(value.c_str()));
+        }
+        else if (argument == "--diff")
+        {
+            diffFilepath = value;
+        }
+        else if (argument == "--layer-caching")
+        {
+            layerCaching = value != "0";
+        }
+        else if (argument == "--partial-redraw")
+        {
+            partialRedraw = value != "0";
+        }
+        else
+        {
+            std::cerr << usage << std::endl;
+            return 1;
+        }
+    }
+
+    eyegui::setErrorCallback(&printError);
+    eyegui::setWarningCallback(&printWarning);
+
+    // Headless context must exist before GUI
+    eyegui::HeadlessContext* pContext = eyegui::createHeadlessContext(width, height);
+    if (!eyegui::isHeadlessContextValid(pContext))
+    {
+        eyegui::terminateHeadlessContext(pContext);
+        return 1;
+    }
+    std::cout << "Renderer: " << eyegui::getRendererOfHeadlessContext(pContext) << std::endl;
+    eyegui::setRootFilepath(rootFilepath);
+
+    eyegui::GUIBuilder guiBuilder;
+    guiBuilder.width = width;
+    guiBuilder.height = height;
+    guiBuilder.fontFilepath = fontFilepath;
+    guiBuilder.localizationFilepath = localizationFilepath;
+    eyegui::GUI* pGUI = guiBuilder.construct();
+    eyegui::addLayout(pGUI, layoutFilepath);
+    eyegui::setLayerCaching(pGUI, layerCaching);
+    eyegui::setPartialRedraw(pGUI, partialRedraw);
+
+    // Frames are captured asynchronously like an application would do it
+    typedef std::chrono::high_resolution_clock Clock;
+    eyegui::FrameCapture capture;
+    double drawMilliseconds = 0;
+    eyegui::clearHeadlessContext(pContext);
+    for (int frame = 0; frame < frameCount; frame++)
+    {
+        eyegui::updateGUI(pGUI, CAPTURE_TPF, input);
+        Clock::time_point start = Clock::now();
+        if (partialRedraw)
+        {
+            // Background is restored where GUI draws again
+            eyegui::clearHeadlessContext(pContext, eyegui::getDamageRects(pGUI));
+            eyegui::drawGUI(pGUI);
+            eyegui::finishHeadlessContext(pContext);
+        }
+        else
+        {
+            eyegui::captureFrame(pGUI, capture, false);
+        }
+        drawMilliseconds += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+    std::cout << (partialRedraw ? "Draw with partial redraw: " : "Draw with asynchronous capture: ")
+        << (drawMilliseconds / (double)frameCount) << " ms per frame" << std::endl;
+    std::cout << "Elements drawn from layers: " << eyegui::getCountOfCachedElements(pGUI) << std::endl;
+
+    // Final frame is waited for
+    bool captured = eyegui::captureFrame(pGUI, capture, true);
+    if (captured && partialRedraw)
+    {
+        // Accumulated areas must give the same frame as complete drawing
+        eyegui::FrameCapture accumulated;
+        eyegui::readHeadlessContext(pContext, accumulated);
+        eyegui::FrameCapture diff;
+        Comparison comparison = compare(accumulated, capture, tolerance, diff);
+        std::cout << "Pixels differing from complete drawing: " << comparison.differingPixels
+            << ", maximum difference: " << comparison.maximumDifference << std::endl;
+        if (comparison.differingPixels > 0)
+        {
+            if (diffFilepath != "")
+            {
+                writeTGA(diffFilepath, diff);
+            }
+            eyegui::terminateGUI(pGUI);
+            eyegui::terminateHeadlessContext(pContext);
+            std::cout << "Mismatch" << std::endl;
+            return 2;
+        }
+        capture = accumulated;
+    }
+    eyegui::terminateGUI(pGUI);
+    eyegui::terminateHeadlessContext(pContext);
+    if (!captured)
+    {
+        std::cerr << "Frame could not be captured" << std::endl;
+        return 1;
+    }
+
+    if (outFilepath != "" && !writeTGA(outFilepath, capture))
+    {
+        return 1;
+    }
+
+    // Comparison with reference
+    if (referenceFilepath == "")
+    {
+        return 0;
+    }
+    eyegui::FrameCapture reference;
+    if (!readImage(referenceFilepath, reference))
+    {
+        return 1;
+    }
+    if (reference.width != capture.width || reference.height != capture.height)
+    {
+        std::cout << "Mismatch: reference has size " << reference.width << "x" << reference.height
+            << ", capture has size " << capture.width << "x" << capture.height << std::endl;
+        return 2;
+    }
+
+    eyegui::FrameCapture diff;
+    Comparison comparison = compare(capture, reference, tolerance, diff);
+    double differingFraction = (double)comparison.differingPixels / (double)(capture.width * capture.height);
+    std::cout << "Differing pixels: " << comparison.differingPixels << " (" << (100.0 * differingFraction) << " %)"
+        << ", maximum difference: " << comparison.maximumDifference
+        << ", mean difference: " << comparison.meanDifference << std::endl;
+    if (diffFilepath != "")
+    {
+        writeTGA(diffFilepath, diff);
+    }
+
+    bool match = differingFraction <= maxDiffering;
+    std::cout << (match ? "Match" : "Mismatch") << std::endl;
+    return match ? 0 : 2;
+}
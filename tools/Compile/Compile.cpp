@@ -0,0 +1,77 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Compiles layouts, bricks and stylesheets ahead of time. Compiled files are
+// written next to the source files and used by eyeGUI instead of parsing the
+// source, as long as the source was not changed afterwards. No OpenGL context
+// is necessary.
+// Usage: eyeGUI_compile [--root <path>] <file> [<file> ...]
+// Exit code is 0 if all files were compiled, 1 otherwise.
+
+#include "include/eyeGUI.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Print errors of parsing
+    void printError(std::string message)
+    {
+        std::cerr << message << std::endl;
+    }
+
+    // Print warnings of parsing
+    void printWarning(std::string message)
+    {
+        std::cerr << message << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    // Collect arguments
+    std::vector<std::string> filepaths;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string argument = argv[i];
+        if (argument == "--root" && i + 1 < argc)
+        {
+            eyegui::setRootFilepath(argv[++i]);
+        }
+        else
+        {
+            filepaths.push_back(argument);
+        }
+    }
+
+    if (filepaths.empty())
+    {
+        std::cerr << "Usage: eyeGUI_compile [--root <path>] <file> [<file> ...]" << std::endl;
+        return 1;
+    }
+
+    eyegui::setErrorCallback(&printError);
+    eyegui::setWarningCallback(&printWarning);
+
+    // Compile all files, even if one fails
+    int failed = 0;
+    for (const std::string& rFilepath : filepaths)
+    {
+        if (eyegui::compileFile(rFilepath))
+        {
+            std::cout << "Compiled " << rFilepath << std::endl;
+        }
+        else
+        {
+            std::cout << "Failed " << rFilepath << std::endl;
+            failed++;
+        }
+    }
+
+    return failed == 0 ? 0 : 1;
+}
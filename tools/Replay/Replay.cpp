@@ -0,0 +1,1014 @@
+//============================================================================
+// Distributed under the MIT License. (See accompanying file LICENSE
+// or copy at https://github.com/raphaelmenges/eyeGUI/blob/master/src/LICENSE)
+//============================================================================
+
+// Author: Raphael Menges (https://github.com/raphaelmenges)
+// Replays log recorded by eyeGUI (see recordingFilepath of GUIBuilder) in a
+// headless OpenGL context and reports timings of update and draw per frame
+// as well as count of frames, which have changed anything and need redraw.
+// Usage: eyeGUI_replay <log> [--root <path>] [--csv <file>] [--repeat <count>]
+
+#include "include/eyeGUI.h"
+#include "include/eyeGUIHeadless.h"
+#include "src/Utilities/InputRecorder.h"
+#include "externals/utfcpp/source/utf8.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Reader for binary log
+    class LogReader
+    {
+    public:
+
+        LogReader(std::string filepath) : mFile(filepath.c_str(), std::ios::in | std::ios::binary) {}
+
+        bool isOpen() const
+        {
+            return mFile.is_open();
+        }
+
+        bool isGood() const
+        {
+            return mFile.good();
+        }
+
+        bool readType(eyegui::InputRecordType& rType)
+        {
+            unsigned char value = 0;
+            if (!mFile.read((char*)&value, sizeof(value)))
+            {
+                return false;
+            }
+            rType = (eyegui::InputRecordType)value;
+            return true;
+        }
+
+        int readInt()
+        {
+            int value = 0;
+            mFile.read((char*)&value, sizeof(value));
+            return value;
+        }
+
+        unsigned int readUInt()
+        {
+            unsigned int value = 0;
+            mFile.read((char*)&value, sizeof(value));
+            return value;
+        }
+
+        float readFloat()
+        {
+            float value = 0;
+            mFile.read((char*)&value, sizeof(value));
+            return value;
+        }
+
+        double readDouble()
+        {
+            double value = 0;
+            mFile.read((char*)&value, sizeof(value));
+            return value;
+        }
+
+        bool readBool()
+        {
+            unsigned char value = 0;
+            mFile.read((char*)&value, sizeof(value));
+            return value != 0;
+        }
+
+        std::string readString()
+        {
+            unsigned int length = readUInt();
+            std::string value(length, '\0');
+            if (length > 0)
+            {
+                mFile.read(&value[0], length);
+            }
+            return value;
+        }
+
+        std::map<std::string, std::string> readIdMapper()
+        {
+            std::map<std::string, std::string> idMapper;
+            unsigned int count = readUInt();
+            for (unsigned int i = 0; i < count; i++)
+            {
+                std::string key = readString();
+                idMapper[key] = readString();
+            }
+            return idMapper;
+        }
+
+    private:
+
+        std::ifstream mFile;
+    };
+
+    // Timings of one frame
+    struct FrameTiming
+    {
+        double updateMilliseconds = 0;
+        double drawMilliseconds = 0;
+        bool redraw = false;
+    };
+
+    // Print minimum, mean, 99th percentile and maximum
+    void printStatistics(std::string name, std::vector<double> values)
+    {
+        if (values.empty())
+        {
+            return;
+        }
+
+        std::sort(values.begin(), values.end());
+        double sum = 0;
+        for (double value : values)
+        {
+            sum += value;
+        }
+        size_t p99Index = std::min(values.size() - 1, (size_t)(0.99 * (double)values.size()));
+
+        std::cout << name
+            << " min " << values.front()
+            << " ms, mean " << sum / (double)values.size()
+            << " ms, p99 " << values[p99Index]
+            << " ms, max " << values.back() << " ms" << std::endl;
+    }
+
+    // Whether record starts with index of layout
+    bool isLayoutRecord(eyegui::InputRecordType type)
+    {
+        switch (type)
+        {
+        case eyegui::InputRecordType::REMOVE_LAYOUT:
+        case eyegui::InputRecordType::MOVE_LAYOUT_TO_FRONT:
+        case eyegui::InputRecordType::MOVE_LAYOUT_TO_BACK:
+        case eyegui::InputRecordType::SET_INPUT_USAGE_OF_LAYOUT:
+        case eyegui::InputRecordType::SET_VISIBILITY_OF_LAYOUT:
+        case eyegui::InputRecordType::SET_ELEMENT_ACTIVITY:
+        case eyegui::InputRecordType::SET_CONTENT_OF_TEXT_BLOCK:
+        case eyegui::InputRecordType::SET_KEY_OF_TEXT_BLOCK:
+        case eyegui::InputRecordType::HIT_BUTTON:
+        case eyegui::InputRecordType::PENETRATE_SENSOR:
+        case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_BRICK:
+        case eyegui::InputRecordType::ADD_FLOATING_FRAME_WITH_BRICK:
+        case eyegui::InputRecordType::SET_VISIBILITY_OF_FLOATING_FRAME:
+        case eyegui::InputRecordType::REMOVE_FLOATING_FRAME:
+        case eyegui::InputRecordType::SET_POSITION_OF_FLOATING_FRAME:
+        case eyegui::InputRecordType::SET_SIZE_OF_FLOATING_FRAME:
+        case eyegui::InputRecordType::SET_ELEMENT_DIMMING:
+        case eyegui::InputRecordType::SET_ELEMENT_MARKING:
+        case eyegui::InputRecordType::SET_STYLE_OF_ELEMENT:
+        case eyegui::InputRecordType::SET_ELEMENT_HIDING:
+        case eyegui::InputRecordType::HIGHLIGHT_INTERACTIVE_ELEMENT:
+        case eyegui::InputRecordType::SET_VALUE_OF_STYLE_ATTRIBUTE:
+        case eyegui::InputRecordType::SET_ICON_OF_ICON_INTERACTIVE_ELEMENT:
+        case eyegui::InputRecordType::INTERACT_WITH_INTERACTIVE_ELEMENT:
+        case eyegui::InputRecordType::SELECT_INTERACTIVE_ELEMENT:
+        case eyegui::InputRecordType::DESELECT_INTERACTIVE_ELEMENT:
+        case eyegui::InputRecordType::INTERACT_WITH_SELECTED_INTERACTIVE_ELEMENT:
+        case eyegui::InputRecordType::SELECT_NEXT_INTERACTIVE_ELEMENT:
+        case eyegui::InputRecordType::BUTTON_DOWN:
+        case eyegui::InputRecordType::BUTTON_UP:
+        case eyegui::InputRecordType::SET_FAST_TYPING_OF_KEYBOARD:
+        case eyegui::InputRecordType::SET_CASE_OF_KEYBOARD:
+        case eyegui::InputRecordType::SET_KEYMAP_OF_KEYBOARD:
+        case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_BLOCK:
+        case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_PICTURE:
+        case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_BLANK:
+        case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_CIRCLE_BUTTON:
+        case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_BOX_BUTTON:
+        case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_SENSOR:
+        case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_TEXT_BLOCK:
+        case eyegui::InputRecordType::TRANSLATE_FLOATING_FRAME:
+        case eyegui::InputRecordType::SCALE_FLOATING_FRAME:
+        case eyegui::InputRecordType::MOVE_FLOATING_FRAME_TO_FRONT:
+        case eyegui::InputRecordType::MOVE_FLOATING_FRAME_TO_BACK:
+        case eyegui::InputRecordType::SET_DICTIONARY_OF_KEYBOARD:
+        case eyegui::InputRecordType::SET_WORD_OF_KEYBOARD:
+        case eyegui::InputRecordType::SET_CONTENT_OF_TEXT_EDIT:
+        case eyegui::InputRecordType::ADD_CONTENT_AT_CURSOR_IN_TEXT_EDIT:
+        case eyegui::InputRecordType::DELETE_CONTENT_AT_CURSOR_IN_TEXT_EDIT:
+        case eyegui::InputRecordType::MOVE_CURSOR_OVER_LETTERS_IN_TEXT_EDIT:
+        case eyegui::InputRecordType::MOVE_CURSOR_OVER_LINES_IN_TEXT_EDIT:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // Convert utf-8 string of log
+    std::u16string toUTF16(const std::string& rValue)
+    {
+        std::u16string value;
+        utf8::utf8to16(rValue.begin(), rValue.end(), back_inserter(value));
+        return value;
+    }
+
+    // Callbacks
+    void printError(std::string message)
+    {
+        std::cerr << message << std::endl;
+    }
+
+    void printWarning(std::string message)
+    {
+        std::cerr << message << std::endl;
+    }
+
+    // Replay log once and append timings of frames
+    bool replay(std::string logFilepath, std::string rootFilepath, bool overrideRoot, std::vector<FrameTiming>& rFrames)
+    {
+        LogReader reader(logFilepath);
+        if (!reader.isOpen())
+        {
+            std::cerr << "Could not open log: " << logFilepath << std::endl;
+            return false;
+        }
+
+        // Header, records of older versions are still known
+        unsigned int magic = reader.readUInt();
+        unsigned int version = reader.readUInt();
+        if (magic != eyegui::INPUT_LOG_MAGIC || version == 0 || version > eyegui::INPUT_LOG_VERSION)
+        {
+            std::cerr << "File is no log of this version of eyeGUI: " << logFilepath << std::endl;
+            return false;
+        }
+        std::string recordedRootFilepath = reader.readString();
+        eyegui::setRootFilepath(overrideRoot ? rootFilepath : recordedRootFilepath);
+
+        eyegui::GUIBuilder guiBuilder;
+        guiBuilder.width = reader.readInt();
+        guiBuilder.height = reader.readInt();
+        guiBuilder.fontFilepath = reader.readString();
+        guiBuilder.characterSet = (eyegui::CharacterSet)reader.readInt();
+        guiBuilder.localizationFilepath = reader.readString();
+        guiBuilder.vectorGraphicsDPI = reader.readFloat();
+        guiBuilder.fontTallSize = reader.readFloat();
+        guiBuilder.fontMediumSize = reader.readFloat();
+        guiBuilder.fontSmallSize = reader.readFloat();
+
+        // Context and GUI
+        eyegui::HeadlessContext* pContext = eyegui::createHeadlessContext(guiBuilder.width, guiBuilder.height);
+        if (!eyegui::isHeadlessContextValid(pContext))
+        {
+            eyegui::terminateHeadlessContext(pContext);
+            return false;
+        }
+        eyegui::GUI* pGUI = guiBuilder.construct();
+
+        // Layouts in order of adding
+        std::vector<eyegui::Layout*> layouts;
+
+        // Go over records
+        typedef std::chrono::high_resolution_clock Clock;
+        eyegui::InputRecordType type;
+        while (reader.readType(type))
+        {
+            // Layout of record if any
+            eyegui::Layout* pLayout = NULL;
+
+            switch (type)
+            {
+            case eyegui::InputRecordType::UPDATE:
+            {
+                float tpf = reader.readFloat();
+                eyegui::Input input;
+                input.gazeX = reader.readInt();
+                input.gazeY = reader.readInt();
+                input.gazeUsed = reader.readBool();
+                input.instantInteraction = reader.readBool();
+
+                Clock::time_point start = Clock::now();
+                eyegui::updateGUI(pGUI, tpf, input);
+                Clock::time_point end = Clock::now();
+
+                // Update starts new frame
+                FrameTiming frame;
+                frame.updateMilliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+                frame.redraw = eyegui::needsRedraw(pGUI);
+                rFrames.push_back(frame);
+                break;
+            }
+            case eyegui::InputRecordType::GAZE_SAMPLE:
+            {
+                float gazeX = reader.readFloat();
+                float gazeY = reader.readFloat();
+                double timestamp = reader.readDouble();
+                eyegui::pushGazeSample(pGUI, gazeX, gazeY, timestamp);
+                break;
+            }
+            case eyegui::InputRecordType::DRAW:
+            {
+                eyegui::clearHeadlessContext(pContext);
+                eyegui::finishHeadlessContext(pContext);
+
+                // Include execution by OpenGL
+                Clock::time_point start = Clock::now();
+                eyegui::drawGUI(pGUI);
+                eyegui::finishHeadlessContext(pContext);
+                Clock::time_point end = Clock::now();
+
+                if (!rFrames.empty())
+                {
+                    rFrames.back().drawMilliseconds += std::chrono::duration<double, std::milli>(end - start).count();
+                }
+                break;
+            }
+            case eyegui::InputRecordType::RESIZE:
+            {
+                int width = reader.readInt();
+                int height = reader.readInt();
+                eyegui::resizeHeadlessContext(pContext, width, height);
+                eyegui::resizeGUI(pGUI, width, height);
+                break;
+            }
+            case eyegui::InputRecordType::ADD_LAYOUT:
+            {
+                std::string filepath = reader.readString();
+                bool visible = reader.readBool();
+                layouts.push_back(eyegui::addLayout(pGUI, filepath, visible));
+                break;
+            }
+            case eyegui::InputRecordType::LOAD_CONFIG:
+                eyegui::loadConfig(pGUI, reader.readString());
+                break;
+            case eyegui::InputRecordType::SWITCH_LOCALIZATION:
+                eyegui::switchLocalization(pGUI, reader.readString());
+                break;
+            case eyegui::InputRecordType::SET_VALUE_OF_CONFIG_ATTRIBUTE:
+            {
+                std::string attribute = reader.readString();
+                eyegui::setValueOfConfigAttribute(pGUI, attribute, reader.readString());
+                break;
+            }
+            case eyegui::InputRecordType::SET_GAZE_VISUALIZATION_DRAWING:
+                eyegui::setGazeVisualizationDrawing(pGUI, reader.readBool());
+                break;
+            case eyegui::InputRecordType::PREFETCH_IMAGE:
+                eyegui::prefetchImage(pGUI, reader.readString());
+                break;
+            case eyegui::InputRecordType::INVALIDATE_BRICK:
+                eyegui::invalidateBrick(pGUI, reader.readString());
+                break;
+            case eyegui::InputRecordType::INVALIDATE_ALL_BRICKS:
+                eyegui::invalidateAllBricks(pGUI);
+                break;
+            case eyegui::InputRecordType::INVALIDATE_STYLESHEET:
+                eyegui::invalidateStylesheet(pGUI, reader.readString());
+                break;
+            case eyegui::InputRecordType::INVALIDATE_ALL_STYLESHEETS:
+                eyegui::invalidateAllStylesheets(pGUI);
+                break;
+            case eyegui::InputRecordType::SET_PROFILING:
+            {
+                bool enabled = reader.readBool();
+                eyegui::setProfiling(pGUI, enabled, reader.readBool());
+                break;
+            }
+            case eyegui::InputRecordType::SET_LAYER_CACHING:
+                eyegui::setLayerCaching(pGUI, reader.readBool());
+                break;
+            case eyegui::InputRecordType::SET_PARTIAL_REDRAW:
+                eyegui::setPartialRedraw(pGUI, reader.readBool());
+                break;
+            case eyegui::InputRecordType::SET_RENDER_SNAPSHOTS:
+                eyegui::setRenderSnapshots(pGUI, reader.readBool());
+                break;
+            case eyegui::InputRecordType::SET_PARALLEL_UPDATE:
+                eyegui::setParallelUpdate(pGUI, reader.readBool());
+                break;
+            default:
+            {
+                // Replay of unknown record would differ from recorded session
+                if (!isLayoutRecord(type))
+                {
+                    std::cerr << "Log contains unknown record: " << (int)type << std::endl;
+                    eyegui::terminateGUI(pGUI);
+                    eyegui::terminateHeadlessContext(pContext);
+                    return false;
+                }
+
+                // Remaining records start with index of layout
+                int index = reader.readInt();
+                if (index >= 0 && index < (int)layouts.size())
+                {
+                    pLayout = layouts[index];
+                }
+                break;
+            }
+            }
+
+            // Records which refer to layout
+            switch (type)
+            {
+            case eyegui::InputRecordType::REMOVE_LAYOUT:
+                if (pLayout != NULL)
+                {
+                    eyegui::removeLayout(pGUI, pLayout);
+                }
+                break;
+            case eyegui::InputRecordType::MOVE_LAYOUT_TO_FRONT:
+                if (pLayout != NULL)
+                {
+                    eyegui::moveLayoutToFront(pGUI, pLayout);
+                }
+                break;
+            case eyegui::InputRecordType::MOVE_LAYOUT_TO_BACK:
+                if (pLayout != NULL)
+                {
+                    eyegui::moveLayoutToBack(pGUI, pLayout);
+                }
+                break;
+            case eyegui::InputRecordType::SET_INPUT_USAGE_OF_LAYOUT:
+            {
+                bool useInput = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::setInputUsageOfLayout(pLayout, useInput);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_VISIBILITY_OF_LAYOUT:
+            {
+                bool visible = reader.readBool();
+                bool reset = reader.readBool();
+                bool fade = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::setVisibilityOfLayout(pLayout, visible, reset, fade);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_ELEMENT_ACTIVITY:
+            {
+                std::string id = reader.readString();
+                bool active = reader.readBool();
+                bool fade = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::setElementActivity(pLayout, id, active, fade);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_CONTENT_OF_TEXT_BLOCK:
+            {
+                std::string id = reader.readString();
+                std::string content = reader.readString();
+                if (pLayout != NULL)
+                {
+                    eyegui::setContentOfTextBlock(pLayout, id, content);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_KEY_OF_TEXT_BLOCK:
+            {
+                std::string id = reader.readString();
+                std::string key = reader.readString();
+                if (pLayout != NULL)
+                {
+                    eyegui::setKeyOfTextBlock(pLayout, id, key);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::HIT_BUTTON:
+            {
+                std::string id = reader.readString();
+                if (pLayout != NULL)
+                {
+                    eyegui::hitButton(pLayout, id);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::PENETRATE_SENSOR:
+            {
+                std::string id = reader.readString();
+                float amount = reader.readFloat();
+                if (pLayout != NULL)
+                {
+                    eyegui::penetrateSensor(pLayout, id, amount);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_BRICK:
+            {
+                std::string id = reader.readString();
+                std::string filepath = reader.readString();
+                std::map<std::string, std::string> idMapper = reader.readIdMapper();
+                bool fade = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::replaceElementWithBrick(pLayout, id, filepath, idMapper, fade);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::ADD_FLOATING_FRAME_WITH_BRICK:
+            {
+                std::string filepath = reader.readString();
+                float relativePositionX = reader.readFloat();
+                float relativePositionY = reader.readFloat();
+                float relativeSizeX = reader.readFloat();
+                float relativeSizeY = reader.readFloat();
+                std::map<std::string, std::string> idMapper = reader.readIdMapper();
+                bool visible = reader.readBool();
+                bool fade = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::addFloatingFrameWithBrick(pLayout, filepath, relativePositionX, relativePositionY, relativeSizeX, relativeSizeY, idMapper, visible, fade);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_VISIBILITY_OF_FLOATING_FRAME:
+            {
+                unsigned int frameIndex = reader.readUInt();
+                bool visible = reader.readBool();
+                bool reset = reader.readBool();
+                bool fade = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::setVisibilityOFloatingfFrame(pLayout, frameIndex, visible, reset, fade);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::REMOVE_FLOATING_FRAME:
+            {
+                unsigned int frameIndex = reader.readUInt();
+                bool fade = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::removeFloatingFrame(pLayout, frameIndex, fade);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_POSITION_OF_FLOATING_FRAME:
+            {
+                unsigned int frameIndex = reader.readUInt();
+                float relativePositionX = reader.readFloat();
+                float relativePositionY = reader.readFloat();
+                if (pLayout != NULL)
+                {
+                    eyegui::setPositionOfFloatingFrame(pLayout, frameIndex, relativePositionX, relativePositionY);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_SIZE_OF_FLOATING_FRAME:
+            {
+                unsigned int frameIndex = reader.readUInt();
+                float relativeSizeX = reader.readFloat();
+                float relativeSizeY = reader.readFloat();
+                if (pLayout != NULL)
+                {
+                    eyegui::setSizeOfFloatingFrame(pLayout, frameIndex, relativeSizeX, relativeSizeY);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_ELEMENT_DIMMING:
+            {
+                std::string id = reader.readString();
+                bool dimming = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::setElementDimming(pLayout, id, dimming);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_ELEMENT_MARKING:
+            {
+                std::string id = reader.readString();
+                bool marking = reader.readBool();
+                int depth = reader.readInt();
+                if (pLayout != NULL)
+                {
+                    eyegui::setElementMarking(pLayout, id, marking, depth);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_STYLE_OF_ELEMENT:
+            {
+                std::string id = reader.readString();
+                std::string style = reader.readString();
+                if (pLayout != NULL)
+                {
+                    eyegui::setStyleOfElement(pLayout, id, style);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_ELEMENT_HIDING:
+            {
+                std::string id = reader.readString();
+                bool hidden = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::setElementHiding(pLayout, id, hidden);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::HIGHLIGHT_INTERACTIVE_ELEMENT:
+            {
+                std::string id = reader.readString();
+                bool doHighlight = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::highlightInteractiveElement(pLayout, id, doHighlight);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_VALUE_OF_STYLE_ATTRIBUTE:
+            {
+                std::string styleName = reader.readString();
+                std::string attribute = reader.readString();
+                float r = reader.readFloat();
+                float g = reader.readFloat();
+                float b = reader.readFloat();
+                float a = reader.readFloat();
+                if (pLayout != NULL)
+                {
+                    eyegui::setValueOfStyleAttribute(pLayout, styleName, attribute, r, g, b, a);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_ICON_OF_ICON_INTERACTIVE_ELEMENT:
+            {
+                std::string id = reader.readString();
+                std::string iconFilepath = reader.readString();
+                if (pLayout != NULL)
+                {
+                    eyegui::setIconOfIconInteractiveElement(pLayout, id, iconFilepath);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::INTERACT_WITH_INTERACTIVE_ELEMENT:
+            {
+                std::string id = reader.readString();
+                if (pLayout != NULL)
+                {
+                    eyegui::interactWithInteractiveElement(pLayout, id);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SELECT_INTERACTIVE_ELEMENT:
+            {
+                std::string id = reader.readString();
+                if (pLayout != NULL)
+                {
+                    eyegui::selectInteractiveElement(pLayout, id);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::DESELECT_INTERACTIVE_ELEMENT:
+                if (pLayout != NULL)
+                {
+                    eyegui::deselectInteractiveElement(pLayout);
+                }
+                break;
+            case eyegui::InputRecordType::INTERACT_WITH_SELECTED_INTERACTIVE_ELEMENT:
+                if (pLayout != NULL)
+                {
+                    eyegui::interactWithSelectedInteractiveElement(pLayout);
+                }
+                break;
+            case eyegui::InputRecordType::SELECT_NEXT_INTERACTIVE_ELEMENT:
+                if (pLayout != NULL)
+                {
+                    eyegui::selectNextInteractiveElement(pLayout);
+                }
+                break;
+            case eyegui::InputRecordType::BUTTON_DOWN:
+            case eyegui::InputRecordType::BUTTON_UP:
+            {
+                std::string id = reader.readString();
+                bool immediately = reader.readBool();
+                if (pLayout != NULL && type == eyegui::InputRecordType::BUTTON_DOWN)
+                {
+                    eyegui::buttonDown(pLayout, id, immediately);
+                }
+                else if (pLayout != NULL)
+                {
+                    eyegui::buttonUp(pLayout, id, immediately);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_FAST_TYPING_OF_KEYBOARD:
+            {
+                std::string id = reader.readString();
+                bool useFastTyping = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::setFastTypingOfKeyboard(pLayout, id, useFastTyping);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_CASE_OF_KEYBOARD:
+            {
+                std::string id = reader.readString();
+                eyegui::KeyboardCase keyboardCase = (eyegui::KeyboardCase)reader.readInt();
+                if (pLayout != NULL)
+                {
+                    eyegui::setCaseOfKeyboard(pLayout, id, keyboardCase);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_KEYMAP_OF_KEYBOARD:
+            {
+                std::string id = reader.readString();
+                unsigned int keymapIndex = reader.readUInt();
+                if (pLayout != NULL)
+                {
+                    eyegui::setKeymapOfKeyboard(pLayout, id, keymapIndex);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_BLOCK:
+            {
+                std::string id = reader.readString();
+                bool consumeInput = reader.readBool();
+                std::string backgroundFilepath = reader.readString();
+                eyegui::ImageAlignment backgroundAlignment = (eyegui::ImageAlignment)reader.readInt();
+                bool fade = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::replaceElementWithBlock(pLayout, id, consumeInput, backgroundFilepath, backgroundAlignment, fade);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_PICTURE:
+            {
+                std::string id = reader.readString();
+                std::string filepath = reader.readString();
+                eyegui::ImageAlignment alignment = (eyegui::ImageAlignment)reader.readInt();
+                bool fade = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::replaceElementWithPicture(pLayout, id, filepath, alignment, fade);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_BLANK:
+            {
+                std::string id = reader.readString();
+                bool fade = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::replaceElementWithBlank(pLayout, id, fade);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_CIRCLE_BUTTON:
+            case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_BOX_BUTTON:
+            {
+                std::string id = reader.readString();
+                std::string iconFilepath = reader.readString();
+                bool isSwitch = reader.readBool();
+                bool fade = reader.readBool();
+                if (pLayout != NULL && type == eyegui::InputRecordType::REPLACE_ELEMENT_WITH_CIRCLE_BUTTON)
+                {
+                    eyegui::replaceElementWithCircleButton(pLayout, id, iconFilepath, isSwitch, fade);
+                }
+                else if (pLayout != NULL)
+                {
+                    eyegui::replaceElementWithBoxButton(pLayout, id, iconFilepath, isSwitch, fade);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_SENSOR:
+            {
+                std::string id = reader.readString();
+                std::string iconFilepath = reader.readString();
+                bool fade = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::replaceElementWithSensor(pLayout, id, iconFilepath, fade);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::REPLACE_ELEMENT_WITH_TEXT_BLOCK:
+            {
+                std::string id = reader.readString();
+                bool consumeInput = reader.readBool();
+                eyegui::FontSize fontSize = (eyegui::FontSize)reader.readInt();
+                eyegui::TextFlowAlignment alignment = (eyegui::TextFlowAlignment)reader.readInt();
+                eyegui::TextFlowVerticalAlignment verticalAlignment = (eyegui::TextFlowVerticalAlignment)reader.readInt();
+                std::string content = reader.readString();
+                float innerBorder = reader.readFloat();
+                float textScale = reader.readFloat();
+                std::string key = reader.readString();
+                std::string backgroundFilepath = reader.readString();
+                eyegui::ImageAlignment backgroundAlignment = (eyegui::ImageAlignment)reader.readInt();
+                bool fade = reader.readBool();
+                if (pLayout != NULL)
+                {
+                    eyegui::replaceElementWithTextBlock(pLayout, id, consumeInput, fontSize, alignment, verticalAlignment, toUTF16(content), innerBorder, textScale, key, backgroundFilepath, backgroundAlignment, fade);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::TRANSLATE_FLOATING_FRAME:
+            {
+                unsigned int frameIndex = reader.readUInt();
+                float translateX = reader.readFloat();
+                float translateY = reader.readFloat();
+                if (pLayout != NULL)
+                {
+                    eyegui::translateFloatingFrame(pLayout, frameIndex, translateX, translateY);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SCALE_FLOATING_FRAME:
+            {
+                unsigned int frameIndex = reader.readUInt();
+                float scaleX = reader.readFloat();
+                float scaleY = reader.readFloat();
+                if (pLayout != NULL)
+                {
+                    eyegui::scaleFloatingFrame(pLayout, frameIndex, scaleX, scaleY);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::MOVE_FLOATING_FRAME_TO_FRONT:
+            {
+                unsigned int frameIndex = reader.readUInt();
+                if (pLayout != NULL)
+                {
+                    eyegui::moveFloatingFrameToFront(pLayout, frameIndex);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::MOVE_FLOATING_FRAME_TO_BACK:
+            {
+                unsigned int frameIndex = reader.readUInt();
+                if (pLayout != NULL)
+                {
+                    eyegui::moveFloatingFrameToBack(pLayout, frameIndex);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_DICTIONARY_OF_KEYBOARD:
+            {
+                std::string id = reader.readString();
+                std::string filepath = reader.readString();
+                if (pLayout != NULL)
+                {
+                    eyegui::setDictionaryOfKeyboard(pLayout, id, filepath);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_WORD_OF_KEYBOARD:
+            {
+                std::string id = reader.readString();
+                std::string word = reader.readString();
+                if (pLayout != NULL)
+                {
+                    eyegui::setWordOfKeyboard(pLayout, id, word);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::SET_CONTENT_OF_TEXT_EDIT:
+            {
+                std::string id = reader.readString();
+                std::string content = reader.readString();
+                if (pLayout != NULL)
+                {
+                    eyegui::setContentOfTextEdit(pLayout, id, content);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::ADD_CONTENT_AT_CURSOR_IN_TEXT_EDIT:
+            {
+                std::string id = reader.readString();
+                std::string content = reader.readString();
+                if (pLayout != NULL)
+                {
+                    eyegui::addContentAtCursorInTextEdit(pLayout, id, content);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::DELETE_CONTENT_AT_CURSOR_IN_TEXT_EDIT:
+            {
+                std::string id = reader.readString();
+                int letterCount = reader.readInt();
+                if (pLayout != NULL)
+                {
+                    eyegui::deleteContentAtCursorInTextEdit(pLayout, id, letterCount);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::MOVE_CURSOR_OVER_LETTERS_IN_TEXT_EDIT:
+            {
+                std::string id = reader.readString();
+                int letterCount = reader.readInt();
+                if (pLayout != NULL)
+                {
+                    eyegui::moveCursorOverLettersInTextEdit(pLayout, id, letterCount);
+                }
+                break;
+            }
+            case eyegui::InputRecordType::MOVE_CURSOR_OVER_LINES_IN_TEXT_EDIT:
+            {
+                std::string id = reader.readString();
+                int lineCount = reader.readInt();
+                if (pLayout != NULL)
+                {
+                    eyegui::moveCursorOverLinesInTextEdit(pLayout, id, lineCount);
+                }
+                break;
+            }
+            default:
+                // Handled above
+                break;
+            }
+
+            if (!reader.isGood())
+            {
+                std::cerr << "Log ends within record" << std::endl;
+                break;
+            }
+        }
+
+        eyegui::terminateGUI(pGUI);
+        eyegui::terminateHeadlessContext(pContext);
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: eyeGUI_replay <log> [--root <path>] [--csv <file>] [--repeat <count>]" << std::endl;
+        return 1;
+    }
+
+    // Parse arguments
+    std::string logFilepath = argv[1];
+    std::string rootFilepath = "";
+    bool overrideRoot = false;
+    std::string csvFilepath = "";
+    int repeat = 1;
+    for (int i = 2; i < argc - 1; i += 2)
+    {
+        std::string argument = argv[i];
+        if (argument == "--root")
+        {
+            rootFilepath = argv[i + 1];
+            overrideRoot = true;
+        }
+        else if (argument == "--csv")
+        {
+            csvFilepath = argv[i + 1];
+        }
+        else if (argument == "--repeat")
+        {
+            repeat = std::max(1, std::stoi(argv[i + 1]));
+        }
+    }
+
+    eyegui::setErrorCallback(&printError);
+    eyegui::setWarningCallback(&printWarning);
+
+    // Replay
+    std::vector<FrameTiming> frames;
+    for (int i = 0; i < repeat; i++)
+    {
+        if (!replay(logFilepath, rootFilepath, overrideRoot, frames))
+        {
+            return 1;
+        }
+    }
+
+    // Per frame output
+    if (csvFilepath != "")
+    {
+        std::ofstream csv(csvFilepath.c_str());
+        csv << "frame,update_ms,draw_ms,redraw" << std::endl;
+        for (size_t i = 0; i < frames.size(); i++)
+        {
+            csv << i << "," << frames[i].updateMilliseconds << "," << frames[i].drawMilliseconds << "," << (frames[i].redraw ? 1 : 0) << std::endl;
+        }
+    }
+
+    // Summary
+    std::vector<double> updateTimes;
+    std::vector<double> drawTimes;
+    size_t redrawCount = 0;
+    for (const FrameTiming& rFrame : frames)
+    {
+        updateTimes.push_back(rFrame.updateMilliseconds);
+        drawTimes.push_back(rFrame.drawMilliseconds);
+        redrawCount += rFrame.redraw ? 1 : 0;
+    }
+    std::cout << "Frames: " << frames.size() << ", needing redraw: " << redrawCount << std::endl;
+    printStatistics("Update:", updateTimes);
+    printStatistics("Draw:", drawTimes);
+
+    return 0;
+}